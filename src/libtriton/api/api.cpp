@@ -434,7 +434,7 @@ namespace triton {
     if (this->symbolic == nullptr)
       throw triton::exceptions::API("API::initEngines(): No enough memory.");
 
-    this->solver = new(std::nothrow) triton::engines::solver::SolverEngine();
+    this->solver = new(std::nothrow) triton::engines::solver::SolverEngine(this->modes);
     if (this->solver == nullptr)
       throw triton::exceptions::API("API::initEngines(): No enough memory.");
 
@@ -488,6 +488,8 @@ namespace triton {
   bool API::processing(triton::arch::Instruction& inst) {
     this->checkArchitecture();
     this->arch.disassembly(inst);
+    if (this->solver)
+      this->solver->setQueryAddress(inst.getAddress());
     return this->irBuilder->buildSemantics(inst);
   }
 
@@ -856,6 +858,18 @@ namespace triton {
   }
 
 
+  triton::ast::SharedAbstractNode API::getPathConstraintsAst(triton::usize count) {
+    this->checkSymbolic();
+    return this->symbolic->getPathConstraintsAst(count);
+  }
+
+
+  triton::ast::SharedAbstractNode API::getFlippedPathConstraintsAst(triton::usize index) {
+    this->checkSymbolic();
+    return this->symbolic->getFlippedPathConstraintsAst(index);
+  }
+
+
   void API::addPathConstraint(const triton::arch::Instruction& inst, const triton::engines::symbolic::SharedSymbolicExpression& expr) {
     this->checkSymbolic();
     this->symbolic->addPathConstraint(inst, expr);
@@ -940,19 +954,91 @@ namespace triton {
   }
 
 
+  std::map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> API::forwardSliceExpressions(const triton::engines::symbolic::SharedSymbolicExpression& expr) const {
+    this->checkSymbolic();
+    return this->symbolic->forwardSliceExpressions(expr);
+  }
+
+
+  std::map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> API::forwardSliceExpressions(const triton::engines::symbolic::SharedSymbolicVariable& symVar) const {
+    this->checkSymbolic();
+    return this->symbolic->forwardSliceExpressions(symVar);
+  }
+
+
+  std::vector<triton::engines::symbolic::PathConstraint> API::forwardSlicePathConstraints(const triton::engines::symbolic::SharedSymbolicExpression& expr) const {
+    this->checkSymbolic();
+    return this->symbolic->forwardSlicePathConstraints(expr);
+  }
+
+
+  std::vector<triton::engines::symbolic::PathConstraint> API::forwardSlicePathConstraints(const triton::engines::symbolic::SharedSymbolicVariable& symVar) const {
+    this->checkSymbolic();
+    return this->symbolic->forwardSlicePathConstraints(symVar);
+  }
+
+
   std::list<triton::engines::symbolic::SharedSymbolicExpression> API::getTaintedSymbolicExpressions(void) const {
     this->checkSymbolic();
     return this->symbolic->getTaintedSymbolicExpressions();
   }
 
 
+  triton::engines::symbolic::SymbolicExpressionView<std::set<triton::usize>> API::getTaintedSymbolicExpressionsView(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getTaintedSymbolicExpressionsView();
+  }
+
+
+  triton::engines::symbolic::SymbolicExpressionView<std::vector<triton::usize>> API::getSymbolicExpressionsAtAddress(triton::uint64 addr) const {
+    this->checkSymbolic();
+    return this->symbolic->getSymbolicExpressionsAtAddress(addr);
+  }
+
+
+  triton::engines::symbolic::SymbolicExpressionView<std::vector<triton::usize>> API::getSymbolicExpressionsOfKind(triton::engines::symbolic::expression_e kind) const {
+    this->checkSymbolic();
+    return this->symbolic->getSymbolicExpressionsOfKind(kind);
+  }
+
+
+  void API::setMemoryBudget(triton::usize bytes) {
+    this->checkSymbolic();
+    this->symbolic->setMemoryBudget(bytes);
+  }
+
+
+  triton::usize API::getMemoryBudget(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getMemoryBudget();
+  }
+
+
+  triton::usize API::getEstimatedMemory(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getEstimatedMemory();
+  }
+
+
+  void API::enforceMemoryBudget(void) {
+    this->checkSymbolic();
+    this->symbolic->enforceMemoryBudget();
+  }
+
+
+  const triton::engines::symbolic::EvictionStatistics& API::getEvictionStatistics(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getEvictionStatistics();
+  }
+
+
   std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> API::getSymbolicExpressions(void) const {
     this->checkSymbolic();
     return this->symbolic->getSymbolicExpressions();
   }
 
 
-  const std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable>& API::getSymbolicVariables(void) const {
+  const triton::engines::symbolic::SymbolicTable<triton::engines::symbolic::SharedSymbolicVariable>& API::getSymbolicVariables(void) const {
     this->checkSymbolic();
     return this->symbolic->getSymbolicVariables();
   }
@@ -991,27 +1077,149 @@ namespace triton {
   }
 
 
+  void API::setSmtLibSolver(const std::vector<std::string>& command) {
+    this->checkSolver();
+    this->solver->setSmtLibSolver(command);
+  }
+
+
   bool API::isSolverValid(void) const {
     this->checkSolver();
     return this->solver->isValid();
   }
 
 
-  std::map<triton::uint32, triton::engines::solver::SolverModel> API::getModel(const triton::ast::SharedAbstractNode& node) const {
+  std::map<triton::uint32, triton::engines::solver::SolverModel> API::getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, const triton::engines::solver::SolverLimits& limits) const {
+    this->checkSolver();
+    return this->solver->getModel(node, status, limits);
+  }
+
+
+  std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> API::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, const triton::engines::solver::SolverLimits& limits) const {
+    this->checkSolver();
+    return this->solver->getModels(node, limit, status, limits);
+  }
+
+
+  bool API::isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, const triton::engines::solver::SolverLimits& limits) const {
+    this->checkSolver();
+    return this->solver->isSat(node, status, limits);
+  }
+
+
+  std::map<triton::uint32, triton::engines::solver::SolverModel> API::getFlippedPathConstraintsModel(triton::usize index, triton::engines::solver::status_e* status, bool* optimistic) {
+    this->checkSymbolic();
+    this->checkSolver();
+
+    const auto& path = this->symbolic->getPathConstraints();
+    if (index >= path.size())
+      throw triton::exceptions::API("API::getFlippedPathConstraintsModel(): Out of range.");
+
+    return this->solver->getOptimisticModel(path, index, this->astCtxt.lnot(path[index].getTakenPathConstraintAst()), optimistic, status);
+  }
+
+
+  bool API::isFlippedPathConstraintsSat(triton::usize index, triton::engines::solver::status_e* status) {
+    this->checkSymbolic();
+    this->checkSolver();
+
+    const auto& path = this->symbolic->getPathConstraints();
+    if (index >= path.size())
+      throw triton::exceptions::API("API::isFlippedPathConstraintsSat(): Out of range.");
+
+    return this->solver->isIncrementalSat(path, index, this->astCtxt.lnot(path[index].getTakenPathConstraintAst()), status);
+  }
+
+
+  std::vector<triton::uint512> API::getPathValues(const triton::ast::SharedAbstractNode& node, triton::usize limit, triton::engines::solver::status_e* status) {
+    this->checkSymbolic();
+    this->checkSolver();
+
+    const auto& path = this->symbolic->getPathConstraints();
+    return this->solver->getValues(path, path.size(), node, limit, status);
+  }
+
+
+  triton::uint512 API::getPathMinValue(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status) {
+    this->checkSymbolic();
+    this->checkSolver();
+
+    const auto& path = this->symbolic->getPathConstraints();
+    return this->solver->getMinValue(path, path.size(), node, status);
+  }
+
+
+  triton::uint512 API::getPathMaxValue(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status) {
+    this->checkSymbolic();
+    this->checkSolver();
+
+    const auto& path = this->symbolic->getPathConstraints();
+    return this->solver->getMaxValue(path, path.size(), node, status);
+  }
+
+
+  void API::setSolverLimits(const triton::engines::solver::SolverLimits& limits) {
+    this->checkSolver();
+    this->solver->setLimits(limits);
+  }
+
+
+  const triton::engines::solver::SolverLimits& API::getSolverLimits(void) const {
+    this->checkSolver();
+    return this->solver->getLimits();
+  }
+
+
+  void API::interruptSolver(void) {
+    this->checkSolver();
+    this->solver->interrupt();
+  }
+
+
+  std::map<triton::usize, std::map<triton::uint32, triton::engines::solver::SolverModel>> API::solveAllBranchFlips(triton::usize maxThreads, triton::uint32 timeout, const triton::engines::solver::BranchFlipCallback& callback) {
+    std::vector<std::pair<triton::usize, triton::ast::SharedAbstractNode>> flips;
+
+    this->checkSymbolic();
+    this->checkSolver();
+
+    /* The queries are built here, the workers do not touch the AST context */
+    const auto& path = this->symbolic->getPathConstraints();
+    for (triton::usize index = 0; index < path.size(); index++) {
+      if (path[index].isMultipleBranches())
+        flips.push_back(std::make_pair(index, this->astCtxt.lnot(path[index].getTakenPathConstraintAst())));
+    }
+
+    return this->solver->solveBranchFlips(path, flips, maxThreads, timeout, callback);
+  }
+
+
+  void API::setSolverPortfolio(const std::vector<triton::engines::solver::SolverConfiguration>& configurations) {
     this->checkSolver();
-    return this->solver->getModel(node);
+    this->solver->setPortfolio(configurations);
   }
 
 
-  std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> API::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit) const {
+  const std::vector<triton::engines::solver::SolverConfiguration>& API::getSolverPortfolio(void) const {
     this->checkSolver();
-    return this->solver->getModels(node, limit);
+    return this->solver->getPortfolio();
   }
 
 
-  bool API::isSat(const triton::ast::SharedAbstractNode& node) const {
+  const std::vector<triton::usize>& API::getSolverPortfolioWins(void) const {
     this->checkSolver();
-    return this->solver->isSat(node);
+    return this->solver->getPortfolioWins();
+  }
+
+
+  const std::string& API::getSolverPortfolioWinner(void) const {
+    this->checkSolver();
+    return this->solver->getPortfolioWinner();
+  }
+
+
+  void API::resetSolverSession(void) {
+    this->checkSolver();
+    this->solver->resetIncrementalSession();
   }
 
 
@@ -1037,6 +1245,132 @@ namespace triton {
   }
 
 
+  void API::setSolverCacheCapacity(triton::usize capacity) {
+    this->checkSolver();
+    this->solver->setCacheCapacity(capacity);
+  }
+
+
+  triton::usize API::getSolverCacheCapacity(void) const {
+    this->checkSolver();
+    return this->solver->getCacheCapacity();
+  }
+
+
+  const triton::engines::solver::SolverCacheStatistics& API::getSolverCacheStatistics(void) const {
+    this->checkSolver();
+    return this->solver->getCacheStatistics();
+  }
+
+
+  void API::clearSolverCache(void) {
+    this->checkSolver();
+    this->solver->clearCache();
+  }
+
+
+  void API::openSolverPersistentCache(const std::string& path, triton::usize maxSize) {
+    this->checkSolver();
+    this->solver->openPersistentCache(path, maxSize);
+  }
+
+
+  void API::closeSolverPersistentCache(void) {
+    this->checkSolver();
+    this->solver->closePersistentCache();
+  }
+
+
+  bool API::isSolverPersistentCacheOpened(void) const {
+    this->checkSolver();
+    return this->solver->isPersistentCacheOpened();
+  }
+
+
+  const triton::engines::solver::PersistentSolverCacheStatistics& API::getSolverPersistentCacheStatistics(void) const {
+    this->checkSolver();
+    return this->solver->getPersistentCacheStatistics();
+  }
+
+
+  void API::startSolverRecording(const std::string& path) {
+    this->checkSolver();
+    this->solver->startRecording(path);
+  }
+
+
+  void API::stopSolverRecording(void) {
+    this->checkSolver();
+    this->solver->stopRecording();
+  }
+
+
+  bool API::isSolverRecording(void) const {
+    this->checkSolver();
+    return this->solver->isRecording();
+  }
+
+
+  void API::setSolverLocalSearchBudget(triton::usize budget) {
+    this->checkSolver();
+    this->solver->setLocalSearchBudget(budget);
+  }
+
+
+  triton::usize API::getSolverLocalSearchBudget(void) const {
+    this->checkSolver();
+    return this->solver->getLocalSearchBudget();
+  }
+
+
+  const triton::engines::solver::LocalSearchStatistics& API::getSolverLocalSearchStatistics(void) const {
+    this->checkSolver();
+    return this->solver->getLocalSearchStatistics();
+  }
+
+
+  const triton::engines::solver::IntervalSolverStatistics& API::getSolverIntervalStatistics(void) const {
+    this->checkSolver();
+    return this->solver->getIntervalSolverStatistics();
+  }
+
+
+  void API::setSolverModelPoolCapacity(triton::usize capacity) {
+    this->checkSolver();
+    this->solver->setModelPoolCapacity(capacity);
+  }
+
+
+  triton::usize API::getSolverModelPoolCapacity(void) const {
+    this->checkSolver();
+    return this->solver->getModelPoolCapacity();
+  }
+
+
+  const triton::engines::solver::ModelPoolStatistics& API::getSolverModelPoolStatistics(void) const {
+    this->checkSolver();
+    return this->solver->getModelPoolStatistics();
+  }
+
+
+  const triton::engines::solver::QueryPreprocessorStatistics& API::getSolverPreprocessingStatistics(void) const {
+    this->checkSolver();
+    return this->solver->getPreprocessorStatistics();
+  }
+
+
+  void API::setSolverOptimisticStrategy(triton::engines::solver::optimistic_e strategy) {
+    this->checkSolver();
+    this->solver->setOptimisticStrategy(strategy);
+  }
+
+
+  triton::engines::solver::optimistic_e API::getSolverOptimisticStrategy(void) const {
+    this->checkSolver();
+    return this->solver->getOptimisticStrategy();
+  }
+
+
 
   /* Taint engine API ============================================================================== */
 
@@ -1052,12 +1386,18 @@ namespace triton {
   }
 
 
-  const std::set<triton::uint64>& API::getTaintedMemory(void) const {
+  std::set<triton::uint64> API::getTaintedMemory(void) const {
     this->checkTaint();
     return this->taint->getTaintedMemory();
   }
 
 
+  std::vector<std::pair<triton::uint64, triton::uint64>> API::getTaintedMemoryRanges(void) const {
+    this->checkTaint();
+    return this->taint->getTaintedMemoryRanges();
+  }
+
+
   std::set<const triton::arch::Register*> API::getTaintedRegisters(void) const {
     this->checkTaint();
     return this->taint->getTaintedRegisters();
@@ -1094,6 +1434,12 @@ namespace triton {
   }
 
 
+  bool API::isMemoryRangeTainted(triton::uint64 addr, triton::uint64 size) const {
+    this->checkTaint();
+    return this->taint->isMemoryRangeTainted(addr, size);
+  }
+
+
   bool API::isRegisterTainted(const triton::arch::Register& reg) const {
     this->checkTaint();
     return this->taint->isRegisterTainted(reg);
@@ -1132,12 +1478,42 @@ namespace triton {
   }
 
 
+  bool API::taintMemoryRange(triton::uint64 addr, triton::uint64 size) {
+    this->checkTaint();
+    return this->taint->taintMemoryRange(addr, size);
+  }
+
+
   bool API::taintRegister(const triton::arch::Register& reg) {
     this->checkTaint();
     return this->taint->taintRegister(reg);
   }
 
 
+  bool API::taintMemoryWithLabel(const triton::arch::MemoryAccess& mem, triton::uint32 label) {
+    this->checkTaint();
+    return this->taint->taintMemoryWithLabel(mem, label);
+  }
+
+
+  bool API::taintRegisterWithLabel(const triton::arch::Register& reg, triton::uint32 label) {
+    this->checkTaint();
+    return this->taint->taintRegisterWithLabel(reg, label);
+  }
+
+
+  std::vector<triton::uint32> API::getMemoryTaintLabels(const triton::arch::MemoryAccess& mem) const {
+    this->checkTaint();
+    return this->taint->getMemoryTaintLabels(mem);
+  }
+
+
+  std::vector<triton::uint32> API::getRegisterTaintLabels(const triton::arch::Register& reg) const {
+    this->checkTaint();
+    return this->taint->getRegisterTaintLabels(reg);
+  }
+
+
   bool API::untaintMemory(triton::uint64 addr) {
     this->checkTaint();
     return this->taint->untaintMemory(addr);
@@ -1150,6 +1526,12 @@ namespace triton {
   }
 
 
+  bool API::untaintMemoryRange(triton::uint64 addr, triton::uint64 size) {
+    this->checkTaint();
+    return this->taint->untaintMemoryRange(addr, size);
+  }
+
+
   bool API::untaintRegister(const triton::arch::Register& reg) {
     this->checkTaint();
     return this->taint->untaintRegister(reg);
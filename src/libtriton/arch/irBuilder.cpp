@@ -220,6 +220,15 @@ namespace triton {
         /* Symbolic Expressions */
         this->removeSymbolicExpressions(inst);
       }
+
+      // ----------------------------------------------------------------------
+
+      /* Index the remaining symbolic expressions (instruction address and taint) */
+      this->symbolicEngine->indexInstructionExpressions(inst);
+
+      /* Release the least recently used expressions if the memory budget is exceeded */
+      if (this->symbolicEngine->isEnabled())
+        this->symbolicEngine->enforceMemoryBudget();
     }
 
 
@@ -2246,7 +2246,7 @@ namespace triton {
 
     void VariableNode::init(void) {
       this->size        = this->symVar->getSize();
-      this->eval        = ctxt.getVariableValue(this->symVar->getName()) & this->getBitvectorMask();
+      this->eval        = ctxt.getVariableValue(this->symVar->getId()) & this->getBitvectorMask();
       this->symbolized  = true;
 
       /* Init parents */
@@ -24,12 +24,14 @@ namespace triton {
     AstContext::AstContext(const AstContext& other)
       : modes(other.modes),
         astRepresentation(other.astRepresentation),
-        valueMapping(other.valueMapping) {
+        valueMapping(other.valueMapping),
+        variableNames(other.variableNames) {
     }
 
 
     AstContext::~AstContext() {
       this->valueMapping.clear();
+      this->variableNames.clear();
     }
 
 
@@ -37,6 +39,7 @@ namespace triton {
       this->astRepresentation = other.astRepresentation;
       this->modes = other.modes;
       this->valueMapping = other.valueMapping;
+      this->variableNames = other.variableNames;
       return *this;
     }
 
@@ -712,9 +715,9 @@ namespace triton {
 
     SharedAbstractNode AstContext::variable(const triton::engines::symbolic::SharedSymbolicVariable& symVar) {
       // try to get node from variable pool
-      auto it = this->valueMapping.find(symVar->getName());
-      if (it != this->valueMapping.end()) {
-        auto& node = it->second.first;
+      triton::usize id = symVar->getId();
+      if (id < this->valueMapping.size() && this->valueMapping[id].first != nullptr) {
+        auto& node = this->valueMapping[id].first;
 
         if (node->getBitvectorSize() != symVar->getSize())
           throw triton::exceptions::Ast("Node builders - Missmatching variable size.");
@@ -726,7 +729,7 @@ namespace triton {
       else {
         // if not found, create a new variable node
         SharedAbstractNode node = std::make_shared<VariableNode>(symVar, *this);
-        this->initVariable(symVar->getName(), 0, node);
+        this->initVariable(symVar, 0, node);
         if (node == nullptr)
           throw triton::exceptions::Ast("Node builders - Not enough memory");
         node->init();
@@ -750,37 +753,64 @@ namespace triton {
     }
 
 
-    void AstContext::initVariable(const std::string& name, const triton::uint512& value, const SharedAbstractNode& node) {
-      auto it = this->valueMapping.find(name);
-      if (it == this->valueMapping.end())
-        this->valueMapping.insert(std::make_pair(name, std::make_pair(node, value)));
-      else
+    void AstContext::initVariable(const triton::engines::symbolic::SharedSymbolicVariable& symVar, const triton::uint512& value, const SharedAbstractNode& node) {
+      triton::usize id = symVar->getId();
+
+      if (id >= this->valueMapping.size())
+        this->valueMapping.resize(id + 1);
+
+      if (this->valueMapping[id].first != nullptr)
         throw triton::exceptions::Ast("Ast variable already initialized");
+
+      this->valueMapping[id] = std::make_pair(node, value);
+      this->variableNames[symVar->getName()] = id;
+    }
+
+
+    void AstContext::updateVariable(const triton::engines::symbolic::SharedSymbolicVariable& symVar, const triton::uint512& value) {
+      triton::usize id = symVar->getId();
+
+      if (id >= this->valueMapping.size() || this->valueMapping[id].first == nullptr)
+        throw triton::exceptions::Ast("AstContext::updateVariable(): Variable doesn't exists");
+
+      auto& kv = this->valueMapping[id];
+      kv.second = value;
+      kv.first->init();
     }
 
 
     void AstContext::updateVariable(const std::string& name, const triton::uint512& value) {
-      auto& kv = this->valueMapping.at(name);
+      auto it = this->variableNames.find(name);
+      if (it == this->variableNames.end())
+        throw triton::exceptions::Ast("AstContext::updateVariable(): Variable doesn't exists");
+
+      auto& kv = this->valueMapping[it->second];
       kv.second = value;
       kv.first->init();
     }
 
 
     SharedAbstractNode AstContext::getVariableNode(const std::string& name) {
-      auto it = this->valueMapping.find(name);
-      if (it == this->valueMapping.end())
+      auto it = this->variableNames.find(name);
+      if (it == this->variableNames.end())
         return nullptr;
       else
-        return it->second.first;
+        return this->valueMapping[it->second].first;
+    }
+
+
+    const triton::uint512& AstContext::getVariableValue(triton::usize varId) const {
+      if (varId >= this->valueMapping.size() || this->valueMapping[varId].first == nullptr)
+        throw triton::exceptions::Ast("AstContext::getVariableValue(): Variable doesn't exists");
+      return this->valueMapping[varId].second;
     }
 
 
     const triton::uint512& AstContext::getVariableValue(const std::string& varName) const {
-      try {
-        return this->valueMapping.at(varName).second;
-      } catch (const std::out_of_range&) {
+      auto it = this->variableNames.find(varName);
+      if (it == this->variableNames.end())
         throw triton::exceptions::Ast("AstContext::getVariableValue(): Variable doesn't exists");
-      }
+      return this->valueMapping[it->second].second;
     }
 
 
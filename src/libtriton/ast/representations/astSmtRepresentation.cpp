@@ -5,6 +5,8 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <cctype>
+
 #include <triton/astSmtRepresentation.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/symbolicExpression.hpp>
@@ -20,6 +22,29 @@ namespace triton {
       }
 
 
+      /* A simple symbol is a non-empty sequence of letters, digits and ~!@$%^&*_-+=<>.?/ which does not start with a digit */
+      std::string AstSmtRepresentation::getSymbol(const std::string& name) {
+        static const std::string extra = "~!@$%^&*_-+=<>.?/";
+        bool simple = !name.empty() && !std::isdigit(static_cast<unsigned char>(name[0]));
+
+        for (char c : name) {
+          if (!simple)
+            break;
+          simple = std::isalnum(static_cast<unsigned char>(c)) || extra.find(c) != std::string::npos;
+        }
+
+        if (simple)
+          return name;
+
+        std::string ret = "|";
+        for (char c : name)
+          ret += (c == '|' || c == '\\') ? '_' : c;
+        ret += "|";
+
+        return ret;
+      }
+
+
       /* Representation dispatcher from an abstract node */
       std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::AbstractNode* node) {
         switch (node->getType()) {
@@ -332,7 +357,7 @@ namespace triton {
         if (var->getAlias().empty())
           stream << "(declare-fun " << var->getName() << " () (_ BitVec " << var->getSize() << "))";
         else
-          stream << "(declare-fun " << var->getAlias() << " () (_ BitVec " << var->getSize() << "))";
+          stream << "(declare-fun " << AstSmtRepresentation::getSymbol(var->getAlias()) << " () (_ BitVec " << var->getSize() << "))";
         return stream;
       }
 
@@ -445,7 +470,7 @@ namespace triton {
         if (node->getSymbolicVariable()->getAlias().empty())
           stream << node->getSymbolicVariable()->getName();
         else
-          stream << node->getSymbolicVariable()->getAlias();
+          stream << AstSmtRepresentation::getSymbol(node->getSymbolicVariable()->getAlias());
         return stream;
       }
 
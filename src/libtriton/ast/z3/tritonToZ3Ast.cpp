@@ -42,17 +42,83 @@ namespace triton {
     }
 
 
+    z3::context& TritonToZ3Ast::getContext(void) {
+      return this->context;
+    }
+
+
+    /* Post-order traversal converting only the nodes which have not been translated yet. References are unrolled. */
     z3::expr TritonToZ3Ast::convert(const triton::ast::SharedAbstractNode& node) {
-      std::unordered_map<triton::ast::SharedAbstractNode, z3::expr> results;
-      std::deque<triton::ast::SharedAbstractNode> nodes;
+      std::vector<std::pair<triton::ast::SharedAbstractNode, bool>> worklist;
+
+      if (node == nullptr)
+        throw triton::exceptions::AstTranslations("TritonToZ3Ast::convert(): node cannot be null.");
+
+      worklist.push_back(std::make_pair(node, false));
+      while (!worklist.empty()) {
+        triton::ast::SharedAbstractNode current = worklist.back().first;
+
+        if (this->translations.find(current) != this->translations.end()) {
+          worklist.pop_back();
+          continue;
+        }
+
+        if (!worklist.back().second) {
+          worklist.back().second = true;
+          for (const auto& child : current->getChildren()) {
+            if (this->translations.find(child) == this->translations.end())
+              worklist.push_back(std::make_pair(child, false));
+          }
+          if (current->getType() == REFERENCE_NODE) {
+            const auto& ast = reinterpret_cast<triton::ast::ReferenceNode*>(current.get())->getSymbolicExpression()->getAst();
+            if (this->translations.find(ast) == this->translations.end())
+              worklist.push_back(std::make_pair(ast, false));
+          }
+          continue;
+        }
+
+        worklist.pop_back();
 
-      triton::ast::nodesExtraction(&nodes, node, true /* unroll*/, true /* revert */);
+        /* The new variables and translations belong to the innermost scope */
+        if (!this->scopes.empty() && current->getType() == VARIABLE_NODE) {
+          const std::string& name = reinterpret_cast<triton::ast::VariableNode*>(current.get())->getSymbolicVariable()->getName();
+          if (this->variables.find(name) == this->variables.end())
+            this->scopes.back().variables.push_back(name);
+        }
 
-      for (auto&& n : nodes) {
-        results.insert(std::make_pair(n, this->do_convert(n, &results)));
+        this->translations.insert(std::make_pair(current, this->do_convert(current, &this->translations)));
+        if (!this->scopes.empty())
+          this->scopes.back().nodes.push_back(current);
       }
 
-      return results.at(node);
+      return this->translations.at(node);
+    }
+
+
+    void TritonToZ3Ast::push(void) {
+      this->scopes.push_back(Scope());
+    }
+
+
+    void TritonToZ3Ast::pop(void) {
+      if (this->scopes.empty())
+        throw triton::exceptions::AstTranslations("TritonToZ3Ast::pop(): No scope to pop.");
+
+      for (const auto& node : this->scopes.back().nodes)
+        this->translations.erase(node);
+
+      for (const auto& name : this->scopes.back().variables)
+        this->variables.erase(name);
+
+      this->scopes.pop_back();
+    }
+
+
+    void TritonToZ3Ast::reset(void) {
+      this->scopes.clear();
+      this->symbols.clear();
+      this->translations.clear();
+      this->variables.clear();
     }
 
 
@@ -101,6 +101,12 @@ namespace triton {
         initOperandNamespace(operandDict);
         PyObject* idOperandClass = xPyClass_New(nullptr, operandDict, xPyString_FromString("OPERAND"));
 
+        /* Create the OPTIMISTIC namespace ============================================================ */
+
+        PyObject* optimisticDict = xPyDict_New();
+        initOptimisticNamespace(optimisticDict);
+        PyObject* idOptimisticClass = xPyClass_New(nullptr, optimisticDict, xPyString_FromString("OPTIMISTIC"));
+
         /* Create the OPTIMIZATION namespace ========================================================= */
         
         PyObject* modeDict = xPyDict_New();
@@ -125,6 +131,12 @@ namespace triton {
         initShiftsNamespace(shiftsDict);
         PyObject* idShiftsClass = xPyClass_New(nullptr, shiftsDict, xPyString_FromString("SHIFT"));
 
+        /* Create the SOLVER_STATE namespace ========================================================== */
+
+        PyObject* solverStateDict = xPyDict_New();
+        initSolverStateNamespace(solverStateDict);
+        PyObject* idSolverStateClass = xPyClass_New(nullptr, solverStateDict, xPyString_FromString("SOLVER_STATE"));
+
         /* Create the SYMBOLIC namespace ============================================================== */
 
         PyObject* symbolicDict = xPyDict_New();
@@ -164,9 +176,11 @@ namespace triton {
         PyModule_AddObject(triton::bindings::python::tritonModule, "MODE",                idModeClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "OPCODE",              idOpcodesClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "OPERAND",             idOperandClass);
+        PyModule_AddObject(triton::bindings::python::tritonModule, "OPTIMISTIC",          idOptimisticClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "PREFIX",              idPrefixesClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "REG",                 idRegClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "SHIFT",               idShiftsClass);
+        PyModule_AddObject(triton::bindings::python::tritonModule, "SOLVER_STATE",        idSolverStateClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "SYMBOLIC",            idSymbolicClass);
         #if defined(__unix__) || defined(__APPLE__)
         PyModule_AddObject(triton::bindings::python::tritonModule, "SYSCALL64",           idSyscallsClass64);
@@ -40,6 +40,11 @@ Enabled, Triton will reduces the depth of the trees using classical arithmetic o
 - **MODE.CONCRETIZE_UNDEFINED_REGISTERS**<br>
 Enabled, Triton will concretize every registers tagged as undefined (see #750).
 
+- **MODE.CONSTRAINTS_INDEPENDENCE**<br>
+Enabled, the solver splits a conjunction into clusters of constraints which do not share symbolic variables. Only the clusters
+which are not satisfied by the current concrete values are sent to the solver, and the model is completed with the concrete
+values of the variables of the other clusters.
+
 - **MODE.ONLY_ON_SYMBOLIZED**<br>
 Enabled, Triton will perform symbolic execution only on symbolized expressions.
 
@@ -49,9 +54,38 @@ Enabled, Triton will perform symbolic execution only on tainted instructions.
 - **MODE.PC_TRACKING_SYMBOLIC**<br>
 Enabled, Triton will track path constraints only if they are symbolized. This mode is enabled by default.
 
+- **MODE.SOLVER_INTERVALS**<br>
+Enabled, the queries made of conjunctions of comparisons between linear combinations of variables (range checks, switch
+tables, parsers) and of any constraint on a single byte are decided by bounds propagation on the domains of the variables,
+without the solver. The other queries are sent to the solver.
+
+- **MODE.SOLVER_LOCAL_SEARCH**<br>
+Enabled, the solver first looks for a model with a cheap local search starting from the current concrete values (gradient
+steps and bit flips on the variables, see `setSolverLocalSearchBudget()`). The query is sent to the solver if the search
+fails.
+
+- **MODE.SOLVER_MODEL_COMPLETION**<br>
+Enabled, the models returned by `getModel()` and `getModels()` hold a value for every variable of the query: the variables the
+solver left unassigned (their value does not matter) get their current concrete value.
+
+- **MODE.SOLVER_MODEL_REUSE**<br>
+Enabled, a query is first evaluated with the current concrete values of its variables, then with the recently found models
+(see `setSolverModelPoolCapacity()`). The first assignment which satisfies the query is returned without calling the solver.
+
+- **MODE.SOLVER_PREPROCESSING**<br>
+Enabled, a query is rewritten before the solver: its duplicated constraints are removed, the variables fixed by an equality with
+a constant (or by a range reduced to a single value) are substituted by their value in the other constraints, and only the
+strongest unsigned bounds of each variable are kept. The substituted variables are added back to the model (see
+`getSolverPreprocessingStatistics()`).
+
 - **MODE.SYMBOLIZE_INDEX_ROTATION**<br>
 Enabled, Triton will symbolize the index of rotation for `bvror` and `bvrol` nodes. This mode increases the complexity of solving.
 
+- **MODE.TAINT_LABELS**<br>
+Enabled, the taint engine propagates with the taint the set of labels which flow into each tainted byte and register (see
+`taintMemoryWithLabel()` and `getMemoryTaintLabels()`). A label is an integer, e.g. the offset of an input byte. The sets are
+interned, an assignment copies the set of its source and a union merges the sets of its operands.
+
 - **MODE.TAINT_THROUGH_POINTERS**<br>
 Enabled, the taint is spread if an index pointer is already tainted (see #725).
 */
@@ -66,10 +100,17 @@ namespace triton {
         xPyDict_SetItemString(modeDict, "ALIGNED_MEMORY",                 PyLong_FromUint32(triton::modes::ALIGNED_MEMORY));
         xPyDict_SetItemString(modeDict, "AST_OPTIMIZATIONS",              PyLong_FromUint32(triton::modes::AST_OPTIMIZATIONS));
         xPyDict_SetItemString(modeDict, "CONCRETIZE_UNDEFINED_REGISTERS", PyLong_FromUint32(triton::modes::CONCRETIZE_UNDEFINED_REGISTERS));
+        xPyDict_SetItemString(modeDict, "CONSTRAINTS_INDEPENDENCE",       PyLong_FromUint32(triton::modes::CONSTRAINTS_INDEPENDENCE));
         xPyDict_SetItemString(modeDict, "ONLY_ON_SYMBOLIZED",             PyLong_FromUint32(triton::modes::ONLY_ON_SYMBOLIZED));
         xPyDict_SetItemString(modeDict, "ONLY_ON_TAINTED",                PyLong_FromUint32(triton::modes::ONLY_ON_TAINTED));
         xPyDict_SetItemString(modeDict, "PC_TRACKING_SYMBOLIC",           PyLong_FromUint32(triton::modes::PC_TRACKING_SYMBOLIC));
+        xPyDict_SetItemString(modeDict, "SOLVER_INTERVALS",               PyLong_FromUint32(triton::modes::SOLVER_INTERVALS));
+        xPyDict_SetItemString(modeDict, "SOLVER_LOCAL_SEARCH",            PyLong_FromUint32(triton::modes::SOLVER_LOCAL_SEARCH));
+        xPyDict_SetItemString(modeDict, "SOLVER_MODEL_COMPLETION",        PyLong_FromUint32(triton::modes::SOLVER_MODEL_COMPLETION));
+        xPyDict_SetItemString(modeDict, "SOLVER_MODEL_REUSE",             PyLong_FromUint32(triton::modes::SOLVER_MODEL_REUSE));
+        xPyDict_SetItemString(modeDict, "SOLVER_PREPROCESSING",           PyLong_FromUint32(triton::modes::SOLVER_PREPROCESSING));
         xPyDict_SetItemString(modeDict, "SYMBOLIZE_INDEX_ROTATION",       PyLong_FromUint32(triton::modes::SYMBOLIZE_INDEX_ROTATION));
+        xPyDict_SetItemString(modeDict, "TAINT_LABELS",                   PyLong_FromUint32(triton::modes::TAINT_LABELS));
         xPyDict_SetItemString(modeDict, "TAINT_THROUGH_POINTERS",         PyLong_FromUint32(triton::modes::TAINT_THROUGH_POINTERS));
       }
 
@@ -0,0 +1,61 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <triton/pythonBindings.hpp>
+#include <triton/pythonUtils.hpp>
+#include <triton/pythonXFunctions.hpp>
+#include <triton/solverEnums.hpp>
+
+
+
+/*! \page py_OPTIMISTIC_page OPTIMISTIC
+    \brief [**python api**] All information about the OPTIMISTIC python namespace.
+
+\tableofcontents
+
+\section OPTIMISTIC_py_description Description
+<hr>
+
+The OPTIMISTIC namespace contains the fallbacks of a flipped branch whose query is unsat or unanswered (see
+`setSolverOptimisticStrategy()` and `getFlippedPathConstraintsModel()`). The model of a fallback only satisfies
+a part of the path, the input must be validated by re-execution.
+
+\subsection OPTIMISTIC_py_example Example
+
+~~~~~~~~~~~~~{.py}
+>>> ctx.setSolverOptimisticStrategy(OPTIMISTIC.DEPENDENT)
+>>> model, optimistic = ctx.getFlippedPathConstraintsModel(index, False, True)
+~~~~~~~~~~~~~
+
+\section OPTIMISTIC_py_api Python API - Items of the OPTIMISTIC namespace
+<hr>
+
+- **OPTIMISTIC.DEPENDENT**<br>
+Falls back to the negated branch and the path constraints sharing a variable with it, then to the negated branch alone.
+
+- **OPTIMISTIC.DISABLED**<br>
+Only complete models are returned.
+
+- **OPTIMISTIC.LAST**<br>
+Falls back to the negated branch alone.
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      void initOptimisticNamespace(PyObject* optimisticDict) {
+        xPyDict_SetItemString(optimisticDict, "DEPENDENT", PyLong_FromUint32(triton::engines::solver::OPTIMISTIC_DEPENDENT));
+        xPyDict_SetItemString(optimisticDict, "DISABLED",  PyLong_FromUint32(triton::engines::solver::OPTIMISTIC_DISABLED));
+        xPyDict_SetItemString(optimisticDict, "LAST",      PyLong_FromUint32(triton::engines::solver::OPTIMISTIC_LAST));
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
@@ -55,6 +55,12 @@ Builds the instruction semantics. Returns true if the instruction is supported.
 - <b>void clearPathConstraints(void)</b><br>
 Clears the logical conjunction vector of path constraints.
 
+- <b>void clearSolverCache(void)</b><br>
+Removes all the entries of the solver cache and resets its statistics.
+
+- <b>void closeSolverPersistentCache(void)</b><br>
+Closes the persistent cache of the solver answers.
+
 - <b>void concretizeAllMemory(void)</b><br>
 Concretizes all symbolic memory references.
 
@@ -103,9 +109,25 @@ Enables or disables the symbolic execution engine.
 - <b>void enableTaintEngine(bool flag)</b><br>
 Enables or disables the taint engine.
 
+- <b>void enforceMemoryBudget(void)</b><br>
+Concretizes the registers and memory cells holding the least recently used symbolic expressions, which are not reachable
+from the path constraints, until the estimated memory is under the memory budget.
+
 - <b>integer evaluateAstViaZ3(\ref py_AstNode_page node)</b><br>
 Evaluates an AST via Z3 and returns the symbolic value.
 
+- <b>dict forwardSliceExpressions(\ref py_SymbolicExpression_page expr)</b><br>
+Returns all symbolic expressions depending on `expr` (forward slice), `expr` included, as a dictionary of {integer SymExprId : \ref py_SymbolicExpression_page expr}.
+
+- <b>dict forwardSliceExpressions(\ref py_SymbolicVariable_page symVar)</b><br>
+Returns all symbolic expressions depending on `symVar` (forward slice) as a dictionary of {integer SymExprId : \ref py_SymbolicExpression_page expr}.
+
+- <b>[\ref py_PathConstraint_page, ...] forwardSlicePathConstraints(\ref py_SymbolicExpression_page expr)</b><br>
+Returns the path constraints depending on `expr`.
+
+- <b>[\ref py_PathConstraint_page, ...] forwardSlicePathConstraints(\ref py_SymbolicVariable_page symVar)</b><br>
+Returns the path constraints depending on `symVar`.
+
 - <b>[\ref py_Register_page, ...] getAllRegisters(void)</b><br>
 Returns the list of all registers. Each item of this list is a \ref py_Register_page.
 
@@ -133,6 +155,26 @@ Returns the concrete value of a register.
 - <b>integer getConcreteVariableValue(\ref py_SymbolicVariable_page symVar)</b><br>
 Returns the concrete value of a symbolic variable.
 
+- <b>integer getEstimatedMemory(void)</b><br>
+Returns the estimated memory (in bytes) used by the symbolic expressions.
+
+- <b>dict getEvictionStatistics(void)</b><br>
+Returns the statistics of the memory budget eviction as a dictionary of {string name : integer value}. The keys are
+`passes`, `evictedRegisters`, `evictedMemoryCells`, `releasedExpressions` and `releasedBytes`.
+
+- <b>\ref py_AstNode_page getFlippedPathConstraintsAst(integer index)</b><br>
+Returns the logical conjunction AST of the `index` first path constraints and of the negation of the constraint `index`.
+It is the query to flip the branch `index` of the path.
+
+- <b>dict getFlippedPathConstraintsModel(integer index, bool status=False, bool optimistic=False)</b><br>
+Computes a model of the path constraints before `index` and of the negation of the constraint `index`, as a dictionary of
+{integer symVarId : \ref py_SolverModel_page model}. With z3, the path constraints are asserted incrementally into a solver
+session kept across queries, so flipping the branches of a long trace does not translate and assert the whole path each time.
+If the query is unsat or unanswered, the fallbacks of the \ref py_OPTIMISTIC_page strategy are solved (see setSolverOptimisticStrategy()).
+If `status` is true, the \ref py_SOLVER_STATE_page of the query is appended to the result, and if `optimistic` is true, a boolean
+telling if the model only satisfies a part of the path (it must then be validated, e.g. by re-execution). With any of them, the
+result is a tuple starting with the model.
+
 - <b>integer getGprBitSize(void)</b><br>
 Returns the size in bit of the General Purpose Registers.
 
@@ -145,11 +187,24 @@ Returns the AST corresponding to the \ref py_Immediate_page.
 - <b>\ref py_AstNode_page getMemoryAst(\ref py_MemoryAccess_page mem)</b><br>
 Returns the AST corresponding to the \ref py_MemoryAccess_page with the SSA form.
 
-- <b>dict getModel(\ref py_AstNode_page node)</b><br>
+- <b>integer getMemoryBudget(void)</b><br>
+Returns the memory budget (in bytes) of the symbolic expressions. 0 means unlimited.
+
+- <b>[integer, ...] getMemoryTaintLabels(integer addr)</b><br>
+Returns the labels (sorted) which flow into a tainted address (see `MODE.TAINT_LABELS`).
+
+- <b>[integer, ...] getMemoryTaintLabels(\ref py_MemoryAccess_page mem)</b><br>
+Returns the labels (sorted) which flow into the bytes of a tainted memory (see `MODE.TAINT_LABELS`).
+
+- <b>dict getModel(\ref py_AstNode_page node, bool status=False, integer timeout=0, integer memoryLimit=0, integer conflictLimit=0)</b><br>
 Computes and returns a model as a dictionary of {integer symVarId : \ref py_SolverModel_page model} from a symbolic constraint.
+The `timeout` (in milliseconds), `memoryLimit` (in megabytes) and `conflictLimit` bound the query, 0 keeps the limits of the context
+(see setSolverLimits()). An empty model means unsat or no answer: if `status` is true, returns a tuple of the model and of the
+\ref py_SOLVER_STATE_page of the query.
 
-- <b>[dict, ...] getModels(\ref py_AstNode_page node, integer limit)</b><br>
-Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned.
+- <b>[dict, ...] getModels(\ref py_AstNode_page node, integer limit, bool status=False, integer timeout=0, integer memoryLimit=0, integer conflictLimit=0)</b><br>
+Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned. The other arguments
+are the same as getModel().
 
 - <b>\ref py_Register_page getParentRegister(\ref py_Register_page reg)</b><br>
 Returns the parent \ref py_Register_page from a \ref py_Register_page.
@@ -163,18 +218,95 @@ Returns the logical conjunction vector of path constraints as list of \ref py_Pa
 - <b>\ref py_AstNode_page getPathConstraintsAst(void)</b><br>
 Returns the logical conjunction AST of path constraints.
 
+- <b>\ref py_AstNode_page getPathConstraintsAst(integer count)</b><br>
+Returns the logical conjunction AST of the `count` first path constraints. The conjunction is cached, so asking again for a prefix is free.
+
+- <b>integer getPathMaxValue(\ref py_AstNode_page node, bool status=False)</b><br>
+Returns the greatest (unsigned) value of a bitvector expression under the path constraints, found by a binary search on an incremental
+solver session. If `status` is true, returns a tuple of the value and of the \ref py_SOLVER_STATE_page of the search. On a timeout, the
+best value found so far is returned.
+
+- <b>integer getPathMinValue(\ref py_AstNode_page node, bool status=False)</b><br>
+Returns the smallest (unsigned) value of a bitvector expression under the path constraints, found by a binary search on an incremental
+solver session. If `status` is true, returns a tuple of the value and of the \ref py_SOLVER_STATE_page of the search. On a timeout, the
+best value found so far is returned.
+
+- <b>[integer, ...] getPathValues(\ref py_AstNode_page node, integer limit, bool status=False)</b><br>
+Enumerates up to `limit` distinct values of a bitvector expression under the path constraints, e.g. the targets of an indirect jump
+or the addresses of a symbolic pointer. Each value found is excluded by a single disequality on the expression, so the inputs are free
+to change anywhere else, and the queries run on an incremental solver session. If `status` is true, returns a tuple of the values and
+of the \ref py_SOLVER_STATE_page of the enumeration (`SAT` once all the values, or `limit` of them, are found).
+
 - <b>\ref py_Register_page getRegister(\ref py_REG_page id)</b><br>
 Returns the \ref py_Register_page class corresponding to a \ref py_REG_page id.
 
 - <b>\ref py_AstNode_page getRegisterAst(\ref py_Register_page reg)</b><br>
 Returns the AST corresponding to the \ref py_Register_page with the SSA form.
 
+- <b>[integer, ...] getRegisterTaintLabels(\ref py_Register_page reg)</b><br>
+Returns the labels (sorted) which flow into a tainted register (see `MODE.TAINT_LABELS`).
+
+- <b>integer getSolverCacheCapacity(void)</b><br>
+Returns the maximum number of entries of the solver cache.
+
+- <b>dict getSolverCacheStatistics(void)</b><br>
+Returns the statistics of the solver cache as a dictionary of {string name : integer value}. The keys are `hits`,
+`unsatSupersetHits`, `satSubsetHits`, `misses` and `evictions`.
+
+- <b>dict getSolverIntervalStatistics(void)</b><br>
+Returns the statistics of the interval solver (see `MODE.SOLVER_INTERVALS`) as a dictionary of {string name : integer value}.
+The keys are `queries` (submitted), `sat` and `unsat` (decided without the solver).
+
+- <b>dict getSolverLimits(void)</b><br>
+Returns the limits of the queries of the context as a dictionary of {string name : integer value}. The keys are `timeout` (in
+milliseconds), `memory` (in megabytes) and `conflicts`. 0 means no limit.
+
+- <b>integer getSolverLocalSearchBudget(void)</b><br>
+Returns the maximum number of evaluations of a query by the local search.
+
+- <b>dict getSolverLocalSearchStatistics(void)</b><br>
+Returns the statistics of the local search as a dictionary of {string name : integer value}. The keys are `queries`,
+`solved` and `evaluations`.
+
+- <b>integer getSolverModelPoolCapacity(void)</b><br>
+Returns the maximum number of recent models tried before the solver.
+
+- <b>dict getSolverModelPoolStatistics(void)</b><br>
+Returns the statistics of the concrete values and recent models tried before the solver (see `MODE.SOLVER_MODEL_REUSE`) as
+a dictionary of {string name : integer value}. The keys are `queries`, `concreteHits` and `poolHits`.
+
+- <b>\ref py_OPTIMISTIC_page getSolverOptimisticStrategy(void)</b><br>
+Returns the fallbacks of the flipped branches whose query is unsat or unanswered.
+
+- <b>dict getSolverPersistentCacheStatistics(void)</b><br>
+Returns the statistics of the persistent cache of the solver answers as a dictionary of {string name : integer value}.
+The keys are `hits`, `misses`, `corruptedRecords` and `compactions`.
+
+- <b>[dict, ...] getSolverPortfolio(void)</b><br>
+Returns the configurations raced by the portfolio mode as a list of dictionaries with the keys `name`, `tactic` and `seed`.
+
+- <b>string getSolverPortfolioWinner(void)</b><br>
+Returns the name of the configuration which answered the last query raced by the portfolio mode.
+
+- <b>[integer, ...] getSolverPortfolioWins(void)</b><br>
+Returns the number of wins of each configuration of the portfolio, in the order of getSolverPortfolio().
+
+- <b>dict getSolverPreprocessingStatistics(void)</b><br>
+Returns the statistics of the rewriting of the queries before the solver (see `MODE.SOLVER_PREPROCESSING`) as a dictionary of
+{string name : integer value}. The keys are `queries`, `duplicates`, `substitutions`, `implied` and `answered`.
+
 - <b>\ref py_SymbolicExpression_page getSymbolicExpressionFromId(integer symExprId)</b><br>
 Returns the symbolic expression corresponding to an id.
 
 - <b>dict getSymbolicExpressions(void)</b><br>
 Returns all symbolic expressions as a dictionary of {integer SymExprId : \ref py_SymbolicExpression_page expr}.
 
+- <b>[\ref py_SymbolicExpression_page, ...] getSymbolicExpressionsAtAddress(integer addr)</b><br>
+Returns the symbolic expressions created by the instructions executed at `addr`.
+
+- <b>[\ref py_SymbolicExpression_page, ...] getSymbolicExpressionsOfKind(\ref py_SYMBOLIC_page kind)</b><br>
+Returns the symbolic expressions of a kind (`SYMBOLIC.MEMORY_EXPRESSION`, `SYMBOLIC.REGISTER_EXPRESSION` or `SYMBOLIC.VOLATILE_EXPRESSION`).
+
 - <b>dict getSymbolicMemory(void)</b><br>
 Returns the map of symbolic memory as {integer address : \ref py_SymbolicExpression_page expr}.
 
@@ -208,21 +340,36 @@ Returns all symbolic variable as a dictionary of {integer SymVarId : \ref py_Sym
 - <b>[integer, ...] getTaintedMemory(void)</b><br>
 Returns the list of all tainted addresses.
 
+- <b>[(integer addr, integer size), ...] getTaintedMemoryRanges(void)</b><br>
+Returns the tainted memory as a list of coalesced ranges, sorted by address. Unlike `getTaintedMemory()`, the
+size of the list depends on the number of ranges, not on the number of tainted bytes.
+
 - <b>[\ref py_Register_page, ...] getTaintedRegisters(void)</b><br>
-Returns the list of all tainted registers.
+Returns the list of all tainted registers (the parent registers which have at least one tainted byte).
 
 - <b>[\ref py_SymbolicExpression_page, ...] getTaintedSymbolicExpressions(void)</b><br>
 Returns the list of all tainted symbolic expressions.
 
+- <b>void interruptSolver(void)</b><br>
+Interrupts the query being solved from another thread. The query answers \ref py_SOLVER_STATE_page `INTERRUPTED` (see getModel()).
+
 - <b>bool isArchitectureValid(void)</b><br>
 Returns true if the architecture is valid.
 
 - <b>bool isFlag(\ref py_Register_page reg)</b><br>
 Returns true if the register is a flag.
 
+- <b>bool isFlippedPathConstraintsSat(integer index, bool status=False)</b><br>
+Returns true if the path constraints before `index` and the negation of the constraint `index` are satisfiable. Uses the
+same incremental solver session as getFlippedPathConstraintsModel(). If `status` is true, returns a tuple of the answer and
+of the \ref py_SOLVER_STATE_page of the query.
+
 - <b>bool isMemoryMapped(integer baseAddr, integer size=1)</b><br>
 Returns true if the range `[baseAddr:size]` is mapped into the internal memory representation.
 
+- <b>bool isMemoryRangeTainted(integer addr, integer size)</b><br>
+Returns true if one of the `size` bytes from `addr` is tainted. The range can be larger than a \ref py_MemoryAccess_page.
+
 - <b>bool isMemorySymbolized(integer addr)</b><br>
 Returns true if the memory cell expression contains a symbolic variable.
 
@@ -245,13 +392,20 @@ Returns true if the register is a register (see also isFlag()).
 Returns true if the register expression contains a symbolic variable.
 
 - <b>bool isRegisterTainted(\ref py_Register_page reg)</b><br>
-Returns true if the register is tainted.
+Returns true if one of the bytes of the register is tainted. The taint of the registers is byte-precise, tainting `ah` does not taint `al`.
 
 - <b>bool isRegisterValid(\ref py_Register_page reg)</b><br>
 Returns true if the register is valid.
 
-- <b>bool isSat(\ref py_AstNode_page node)</b><br>
-Returns true if an expression is satisfiable.
+- <b>bool isSat(\ref py_AstNode_page node, bool status=False, integer timeout=0, integer memoryLimit=0, integer conflictLimit=0)</b><br>
+Returns true if an expression is satisfiable. The arguments are the same as getModel(): if `status` is true, returns a tuple of
+the answer and of the \ref py_SOLVER_STATE_page of the query.
+
+- <b>bool isSolverPersistentCacheOpened(void)</b><br>
+Returns true if a persistent cache of the solver answers is opened.
+
+- <b>bool isSolverRecording(void)</b><br>
+Returns true if the solver queries are recorded (see startSolverRecording()).
 
 - <b>bool isSymbolicEngineEnabled(void)</b><br>
 Returns true if the symbolic execution engine is enabled.
@@ -268,6 +422,11 @@ Returns a new symbolic expression. Note that if there are simplification passes
 - <b>\ref py_SymbolicVariable_page newSymbolicVariable(integer varSize, string comment)</b><br>
 Returns a new symbolic variable.
 
+- <b>void openSolverPersistentCache(string path, integer maxSize=64MB)</b><br>
+Opens (or creates) a persistent cache of the solver answers. The cache is an append-only log which may be shared across
+runs and processes. Queries are matched up to the numbering of their variables. The log is compacted past `maxSize` bytes.
+The processes sharing it synchronize through the `path.lock` file, created next to the log.
+
 - <b>bool processing(\ref py_Instruction_page inst)</b><br>
 Processes an instruction and updates engines according to the instruction semantics. Returns true if the instruction is supported. You must define an architecture before.
 
@@ -280,6 +439,9 @@ Removes a recorded callback.
 - <b>void reset(void)</b><br>
 Resets everything.
 
+- <b>void resetSolverSession(void)</b><br>
+Releases the incremental solver session.
+
 - <b>void setArchitecture(\ref py_ARCH_page arch)</b><br>
 Initializes an architecture. This function must be called before any call to the rest of the API.
 
@@ -309,6 +471,42 @@ the symbolic state (if it exists). You should probably use the concretize functi
 - <b>void setConcreteVariableValue(\ref py_SymbolicVariable_page symVar, integer value)</b><br>
 Sets the concrete value of a symbolic variable.
 
+- <b>void setMemoryBudget(integer bytes)</b><br>
+Sets the memory budget (in bytes) of the symbolic expressions. 0 means unlimited. Past the budget, the least recently
+used expressions which are not reachable from the path constraints are concretized and released after each processed instruction.
+
+- <b>void setSmtLibSolver([string, ...] command)</b><br>
+Replaces the solver by an external solver process which speaks SMT-LIB v2 on its standard input and output, e.g.
+`["z3", "-in"]`, `["cvc5", "--incremental"]` or `["bitwuzla"]`. The process is kept alive across the queries, each one is asserted
+between a `push` and a `pop`. A query which times out or is interrupted kills the process, which is restarted by the next query, so
+a crash or a memory blowup of the solver does not take the analysis down. Only available on Unix-like systems.
+
+- <b>void setSolverCacheCapacity(integer capacity)</b><br>
+Sets the maximum number of entries of the solver cache. 0 (the default) disables the cache.
+
+- <b>void setSolverLimits(integer timeout, integer memoryLimit=0, integer conflictLimit=0)</b><br>
+Sets the limits of the queries of the context: the `timeout` (in milliseconds) of each check, the `memoryLimit` (in megabytes) and
+the `conflictLimit` of each check. 0 means no limit. A query which reaches a limit answers an empty model and its status tells why.
+
+- <b>void setSolverLocalSearchBudget(integer budget)</b><br>
+Sets the maximum number of evaluations of a query by the local search (1000 by default). The search is enabled with
+`MODE.SOLVER_LOCAL_SEARCH`.
+
+- <b>void setSolverModelPoolCapacity(integer capacity)</b><br>
+Sets the maximum number of recent models tried before the solver (16 by default). With 0, only the concrete values are tried.
+
+- <b>void setSolverOptimisticStrategy(\ref py_OPTIMISTIC_page strategy)</b><br>
+Sets the fallbacks of the flipped branches whose query is unsat or unanswered (`OPTIMISTIC.DISABLED` by default).
+When the path constraints before a branch and its negation cannot be solved, getFlippedPathConstraintsModel() solves the negation with
+the path constraints sharing a variable with it (`OPTIMISTIC.DEPENDENT`), then the negation alone. Such models often reach the new
+branch anyway, at a fraction of the cost of the whole query.
+
+- <b>void setSolverPortfolio([dict, ...] configurations)</b><br>
+Sets the configurations raced by the portfolio mode. Each configuration is a dictionary with a `name` and optionally a z3
+`tactic` (e.g. `qfbv`, the default solver if absent) and a random `seed`. With at least two configurations, each query is
+solved by all of them in parallel threads, the first answer wins and the others are interrupted. An empty list disables
+the portfolio mode.
+
 - <b>bool setTaintMemory(\ref py_MemoryAccess_page mem, bool flag)</b><br>
 Sets the targeted memory as tainted or not. Returns true if the memory is still tainted.
 
@@ -322,6 +520,22 @@ set to True, Triton will use z3 to simplify the given `node` before to call its
 - <b>dict sliceExpressions(\ref py_SymbolicExpression_page expr)</b><br>
 Slices expressions from a given one (backward slicing) and returns all symbolic expressions as a dictionary of {integer SymExprId : \ref py_SymbolicExpression_page expr}.
 
+- <b>dict solveAllBranchFlips(integer maxThreads=0, integer timeout=0, function callback=None)</b><br>
+Solves the flip of every multiple-branch path constraint (the taken constraints before it and its negation) and returns
+a dictionary of {integer pathConstraintIndex : dict model}. With z3, the flips are solved concurrently by `maxThreads` workers
+(0 means one less than the number of cores) in independent z3 contexts and `timeout` (in milliseconds, 0 means none) bounds
+each query. The optional `callback(index, model)` is called as soon as each model is computed. An empty model means
+unsat or timeout. The workers still read the ASTs of the path while the callback runs, so the callback must not modify the
+context (no processing, no new path constraint, no setAst). interruptSolver() stops the workers.
+
+- <b>void startSolverRecording(string path)</b><br>
+Starts appending the solver queries to the capture file `path`. Each query is written as a SMT-LIB script with its kind, the address
+of the instruction being processed, its status and the time spent to answer. A capture can be replayed offline against several solver
+configurations by the `triton-solver-bench` tool.
+
+- <b>void stopSolverRecording(void)</b><br>
+Stops recording the solver queries.
+
 - <b>bool taintAssignmentMemoryImmediate(\ref py_MemoryAccess_page memDst)</b><br>
 Taints `memDst` with an assignment - `memDst` is untained. Returns true if the `memDst` is still tainted.
 
@@ -350,9 +564,25 @@ Taints an address. Returns true if the address is tainted.
 - <b>bool taintMemory(\ref py_MemoryAccess_page mem)</b><br>
 Taints a memory. Returns true if the memory is tainted.
 
+- <b>bool taintMemoryRange(integer addr, integer size)</b><br>
+Taints the `size` bytes from `addr` (e.g. an input buffer) at once. Returns true if the range is tainted.
+
+- <b>bool taintMemoryWithLabel(integer addr, integer label)</b><br>
+Taints an address and adds a label (e.g. the offset of the input byte) to its set of labels. The labels are propagated with the
+taint when `MODE.TAINT_LABELS` is enabled. Returns TAINTED if the address has been tainted correctly. Otherwise it returns the last
+defined state.
+
+- <b>bool taintMemoryWithLabel(\ref py_MemoryAccess_page mem, integer label)</b><br>
+Taints a memory and adds a label to the set of labels of each of its bytes. The labels are propagated with the taint when
+`MODE.TAINT_LABELS` is enabled. Returns TAINTED if the memory has been tainted correctly. Otherwise it returns the last defined state.
+
 - <b>bool taintRegister(\ref py_Register_page reg)</b><br>
 Taints a register. Returns true if the register is tainted.
 
+- <b>bool taintRegisterWithLabel(\ref py_Register_page reg, integer label)</b><br>
+Taints a register and adds a label to its set of labels. The labels are propagated with the taint when `MODE.TAINT_LABELS` is
+enabled. Returns TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
+
 - <b>bool taintUnionMemoryImmediate(\ref py_MemoryAccess_page memDst)</b><br>
 Taints `memDst` with an union - `memDst` does not changes. Returns true if `memDst` is tainted.
 
@@ -384,6 +614,9 @@ Untaints an address. Returns true if the address is still tainted.
 - <b>bool untaintMemory(\ref py_MemoryAccess_page mem)</b><br>
 Untaints a memory. Returns true if the memory is still tainted.
 
+- <b>bool untaintMemoryRange(integer addr, integer size)</b><br>
+Untaints the `size` bytes from `addr` at once. Returns true if the range is still tainted.
+
 - <b>bool untaintRegister(\ref py_Register_page reg)</b><br>
 Untaints a register. Returns true if the register is still tainted.
 
@@ -395,6 +628,21 @@ namespace triton {
   namespace bindings {
     namespace python {
 
+      //! Releases the GIL for the lifetime of the guard, it is taken back whatever the way the scope is left.
+      class ReleasedGil {
+        private:
+          PyThreadState* state;
+
+        public:
+          ReleasedGil() : state(PyEval_SaveThread()) {
+          }
+
+          ~ReleasedGil() {
+            PyEval_RestoreThread(this->state);
+          }
+      };
+
+
       static void TritonContext_dealloc(PyObject* self) {
         if (((TritonContext_Object*)self)->ref == false)
           delete PyTritonContext_AsTritonContext(self);
@@ -770,6 +1018,32 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_clearSolverCache(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->clearSolverCache();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_closeSolverPersistentCache(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->closeSolverPersistentCache();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_concretizeAllMemory(PyObject* self, PyObject* noarg) {
         try {
           PyTritonContext_AsTritonContext(self)->concretizeAllMemory();
@@ -1144,6 +1418,19 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_enforceMemoryBudget(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->enforceMemoryBudget();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_evaluateAstViaZ3(PyObject* self, PyObject* node) {
         if (!PyAstNode_Check(node))
           return PyErr_Format(PyExc_TypeError, "evaluateAstViaZ3(): Expects a AstNode as argument.");
@@ -1160,6 +1447,61 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_forwardSliceExpressions(PyObject* self, PyObject* obj) {
+        PyObject* ret = nullptr;
+
+        try {
+          std::map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> exprs;
+
+          if (PySymbolicExpression_Check(obj))
+            exprs = PyTritonContext_AsTritonContext(self)->forwardSliceExpressions(PySymbolicExpression_AsSymbolicExpression(obj));
+
+          else if (PySymbolicVariable_Check(obj))
+            exprs = PyTritonContext_AsTritonContext(self)->forwardSliceExpressions(PySymbolicVariable_AsSymbolicVariable(obj));
+
+          else
+            return PyErr_Format(PyExc_TypeError, "forwardSliceExpressions(): Expects a SymbolicExpression or a SymbolicVariable as argument.");
+
+          ret = xPyDict_New();
+          for (auto it = exprs.begin(); it != exprs.end(); it++)
+            xPyDict_SetItem(ret, PyLong_FromUsize(it->first), PySymbolicExpression(it->second));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_forwardSlicePathConstraints(PyObject* self, PyObject* obj) {
+        PyObject* ret = nullptr;
+
+        try {
+          std::vector<triton::engines::symbolic::PathConstraint> pcs;
+          triton::uint32 index = 0;
+
+          if (PySymbolicExpression_Check(obj))
+            pcs = PyTritonContext_AsTritonContext(self)->forwardSlicePathConstraints(PySymbolicExpression_AsSymbolicExpression(obj));
+
+          else if (PySymbolicVariable_Check(obj))
+            pcs = PyTritonContext_AsTritonContext(self)->forwardSlicePathConstraints(PySymbolicVariable_AsSymbolicVariable(obj));
+
+          else
+            return PyErr_Format(PyExc_TypeError, "forwardSlicePathConstraints(): Expects a SymbolicExpression or a SymbolicVariable as argument.");
+
+          ret = xPyList_New(pcs.size());
+          for (auto it = pcs.begin(); it != pcs.end(); it++)
+            PyList_SetItem(ret, index++, PyPathConstraint(*it));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* TritonContext_getAllRegisters(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
 
@@ -1279,6 +1621,99 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_getEstimatedMemory(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getEstimatedMemory());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getEvictionStatistics(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          const auto& stats = PyTritonContext_AsTritonContext(self)->getEvictionStatistics();
+
+          ret = xPyDict_New();
+          xPyDict_SetItem(ret, xPyString_FromString("passes"),              PyLong_FromUsize(stats.passes));
+          xPyDict_SetItem(ret, xPyString_FromString("evictedRegisters"),    PyLong_FromUsize(stats.evictedRegisters));
+          xPyDict_SetItem(ret, xPyString_FromString("evictedMemoryCells"),  PyLong_FromUsize(stats.evictedMemoryCells));
+          xPyDict_SetItem(ret, xPyString_FromString("releasedExpressions"), PyLong_FromUsize(stats.releasedExpressions));
+          xPyDict_SetItem(ret, xPyString_FromString("releasedBytes"),       PyLong_FromUsize(stats.releasedBytes));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getFlippedPathConstraintsAst(PyObject* self, PyObject* index) {
+        if (!PyLong_Check(index) && !PyInt_Check(index))
+          return PyErr_Format(PyExc_TypeError, "getFlippedPathConstraintsAst(): Expects an integer as argument.");
+
+        try {
+          return PyAstNode(PyTritonContext_AsTritonContext(self)->getFlippedPathConstraintsAst(PyLong_AsUsize(index)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getFlippedPathConstraintsModel(PyObject* self, PyObject* args) {
+        triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+        bool optimistic = false;
+        PyObject* ret   = nullptr;
+        PyObject* index = nullptr;
+        PyObject* wantStatus = nullptr;
+        PyObject* wantOptimistic = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOO", &index, &wantStatus, &wantOptimistic);
+
+        if (index == nullptr || (!PyLong_Check(index) && !PyInt_Check(index)))
+          return PyErr_Format(PyExc_TypeError, "getFlippedPathConstraintsModel(): Expects an integer as first argument.");
+
+        if (wantStatus != nullptr && !PyBool_Check(wantStatus))
+          return PyErr_Format(PyExc_TypeError, "getFlippedPathConstraintsModel(): Expects a boolean as second argument.");
+
+        if (wantOptimistic != nullptr && !PyBool_Check(wantOptimistic))
+          return PyErr_Format(PyExc_TypeError, "getFlippedPathConstraintsModel(): Expects a boolean as third argument.");
+
+        try {
+          ret = xPyDict_New();
+          auto model = PyTritonContext_AsTritonContext(self)->getFlippedPathConstraintsModel(PyLong_AsUsize(index), &status, &optimistic);
+          for (auto it = model.begin(); it != model.end(); it++) {
+            xPyDict_SetItem(ret, PyLong_FromUint32(it->first), PySolverModel(it->second));
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        bool withStatus     = (wantStatus != nullptr && PyObject_IsTrue(wantStatus));
+        bool withOptimistic = (wantOptimistic != nullptr && PyObject_IsTrue(wantOptimistic));
+
+        if (withStatus || withOptimistic) {
+          PyObject* tuple = xPyTuple_New(1 + withStatus + withOptimistic);
+          Py_ssize_t item = 0;
+          PyTuple_SetItem(tuple, item++, ret);
+          if (withStatus)
+            PyTuple_SetItem(tuple, item++, PyLong_FromUint32(status));
+          if (withOptimistic)
+            PyTuple_SetItem(tuple, item++, PyBool_FromLong(optimistic));
+          return tuple;
+        }
+
+        return ret;
+      }
+
+
       static PyObject* TritonContext_getGprBitSize(PyObject* self, PyObject* noarg) {
         try {
           return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->getGprBitSize());
@@ -1325,34 +1760,119 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_getModel(PyObject* self, PyObject* node) {
+      static PyObject* TritonContext_getMemoryBudget(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getMemoryBudget());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getMemoryTaintLabels(PyObject* self, PyObject* mem) {
         PyObject* ret = nullptr;
 
-        if (!PyAstNode_Check(node))
-          return PyErr_Format(PyExc_TypeError, "getModel(): Expects a AstNode as argument.");
+        try {
+          std::vector<triton::uint32> labels;
+
+          if (PyMemoryAccess_Check(mem))
+            labels = PyTritonContext_AsTritonContext(self)->getMemoryTaintLabels(*PyMemoryAccess_AsMemoryAccess(mem));
+
+          else if (PyLong_Check(mem) || PyInt_Check(mem))
+            labels = PyTritonContext_AsTritonContext(self)->getMemoryTaintLabels(triton::arch::MemoryAccess(PyLong_AsUint64(mem), BYTE_SIZE));
+
+          else
+            return PyErr_Format(PyExc_TypeError, "getMemoryTaintLabels(): Expects a MemoryAccess or an integer as argument.");
+
+          ret = xPyList_New(labels.size());
+          for (triton::usize index = 0; index < labels.size(); index++)
+            PyList_SetItem(ret, index, PyLong_FromUint32(labels[index]));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getModel(PyObject* self, PyObject* args) {
+        std::map<triton::uint32, triton::engines::solver::SolverModel> model;
+        triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+        triton::engines::solver::SolverLimits limits;
+        PyObject* ret           = nullptr;
+        PyObject* node          = nullptr;
+        PyObject* wantStatus    = nullptr;
+        PyObject* timeout       = nullptr;
+        PyObject* memoryLimit   = nullptr;
+        PyObject* conflictLimit = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOOOO", &node, &wantStatus, &timeout, &memoryLimit, &conflictLimit);
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "getModel(): Expects a AstNode as first argument.");
+
+        if (wantStatus != nullptr && !PyBool_Check(wantStatus))
+          return PyErr_Format(PyExc_TypeError, "getModel(): Expects a boolean as second argument.");
+
+        if ((timeout != nullptr && !PyLong_Check(timeout) && !PyInt_Check(timeout)) ||
+            (memoryLimit != nullptr && !PyLong_Check(memoryLimit) && !PyInt_Check(memoryLimit)) ||
+            (conflictLimit != nullptr && !PyLong_Check(conflictLimit) && !PyInt_Check(conflictLimit)))
+          return PyErr_Format(PyExc_TypeError, "getModel(): Expects integers as limits.");
+
+        if (timeout != nullptr)
+          limits.timeout = PyLong_AsUint32(timeout);
+
+        if (memoryLimit != nullptr)
+          limits.memory = PyLong_AsUint32(memoryLimit);
+
+        if (conflictLimit != nullptr)
+          limits.conflicts = PyLong_AsUint32(conflictLimit);
+
+        triton::API* api = PyTritonContext_AsTritonContext(self);
+        triton::ast::SharedAbstractNode query = PyAstNode_AsAstNode(node);
 
         try {
-          ret = xPyDict_New();
-          auto model = PyTritonContext_AsTritonContext(self)->getModel(PyAstNode_AsAstNode(node));
-          for (auto it = model.begin(); it != model.end(); it++) {
-            xPyDict_SetItem(ret, PyLong_FromUint32(it->first), PySolverModel(it->second));
-          }
+          /* The GIL is released so that another thread may interrupt the solver */
+          ReleasedGil released;
+          model = api->getModel(query, &status, limits);
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
+        ret = xPyDict_New();
+        for (auto it = model.begin(); it != model.end(); it++) {
+          xPyDict_SetItem(ret, PyLong_FromUint32(it->first), PySolverModel(it->second));
+        }
+
+        if (wantStatus != nullptr && PyObject_IsTrue(wantStatus)) {
+          PyObject* tuple = xPyTuple_New(2);
+          PyTuple_SetItem(tuple, 0, ret);
+          PyTuple_SetItem(tuple, 1, PyLong_FromUint32(status));
+          return tuple;
+        }
+
         return ret;
       }
 
 
       static PyObject* TritonContext_getModels(PyObject* self, PyObject* args) {
-        PyObject* ret   = nullptr;
-        PyObject* node  = nullptr;
-        PyObject* limit = nullptr;
+        std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> models;
+        triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+        triton::engines::solver::SolverLimits limits;
+        PyObject* ret           = nullptr;
+        PyObject* node          = nullptr;
+        PyObject* limit         = nullptr;
+        PyObject* wantStatus    = nullptr;
+        PyObject* timeout       = nullptr;
+        PyObject* memoryLimit   = nullptr;
+        PyObject* conflictLimit = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &node, &limit);
+        PyArg_ParseTuple(args, "|OOOOOO", &node, &limit, &wantStatus, &timeout, &memoryLimit, &conflictLimit);
 
         if (node == nullptr || !PyAstNode_Check(node))
           return PyErr_Format(PyExc_TypeError, "getModels(): Expects a AstNode as first argument.");
@@ -1360,8 +1880,37 @@ namespace triton {
         if (limit == nullptr || (!PyLong_Check(limit) && !PyInt_Check(limit)))
           return PyErr_Format(PyExc_TypeError, "getModels(): Expects an integer as second argument.");
 
+        if (wantStatus != nullptr && !PyBool_Check(wantStatus))
+          return PyErr_Format(PyExc_TypeError, "getModels(): Expects a boolean as third argument.");
+
+        if ((timeout != nullptr && !PyLong_Check(timeout) && !PyInt_Check(timeout)) ||
+            (memoryLimit != nullptr && !PyLong_Check(memoryLimit) && !PyInt_Check(memoryLimit)) ||
+            (conflictLimit != nullptr && !PyLong_Check(conflictLimit) && !PyInt_Check(conflictLimit)))
+          return PyErr_Format(PyExc_TypeError, "getModels(): Expects integers as limits.");
+
+        if (timeout != nullptr)
+          limits.timeout = PyLong_AsUint32(timeout);
+
+        if (memoryLimit != nullptr)
+          limits.memory = PyLong_AsUint32(memoryLimit);
+
+        if (conflictLimit != nullptr)
+          limits.conflicts = PyLong_AsUint32(conflictLimit);
+
+        triton::API* api = PyTritonContext_AsTritonContext(self);
+        triton::ast::SharedAbstractNode query = PyAstNode_AsAstNode(node);
+        triton::uint32 count = PyLong_AsUint32(limit);
+
+        try {
+          /* The GIL is released so that another thread may interrupt the solver */
+          ReleasedGil released;
+          models = api->getModels(query, count, &status, limits);
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
         try {
-          auto models = PyTritonContext_AsTritonContext(self)->getModels(PyAstNode_AsAstNode(node), PyLong_AsUint32(limit));
           triton::uint32 index = 0;
 
           ret = xPyList_New(models.size());
@@ -1380,6 +1929,13 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
+        if (wantStatus != nullptr && PyObject_IsTrue(wantStatus)) {
+          PyObject* tuple = xPyTuple_New(2);
+          PyTuple_SetItem(tuple, 0, ret);
+          PyTuple_SetItem(tuple, 1, PyLong_FromUint32(status));
+          return tuple;
+        }
+
         return ret;
       }
 
@@ -1423,13 +1979,131 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_getPathConstraintsAst(PyObject* self, PyObject* noarg) {
+      static PyObject* TritonContext_getPathConstraintsAst(PyObject* self, PyObject* args) {
+        PyObject* count = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|O", &count);
+
         try {
-          return PyAstNode(PyTritonContext_AsTritonContext(self)->getPathConstraintsAst());
-        }
+          if (count == nullptr)
+            return PyAstNode(PyTritonContext_AsTritonContext(self)->getPathConstraintsAst());
+
+          if (PyLong_Check(count) || PyInt_Check(count))
+            return PyAstNode(PyTritonContext_AsTritonContext(self)->getPathConstraintsAst(PyLong_AsUsize(count)));
+
+          return PyErr_Format(PyExc_TypeError, "getPathConstraintsAst(): Expects an integer or nothing as argument.");
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getPathMaxValue(PyObject* self, PyObject* args) {
+        triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+        triton::uint512 value = 0;
+        PyObject* node       = nullptr;
+        PyObject* wantStatus = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &node, &wantStatus);
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "getPathMaxValue(): Expects a AstNode as first argument.");
+
+        if (wantStatus != nullptr && !PyBool_Check(wantStatus))
+          return PyErr_Format(PyExc_TypeError, "getPathMaxValue(): Expects a boolean as second argument.");
+
+        try {
+          value = PyTritonContext_AsTritonContext(self)->getPathMaxValue(PyAstNode_AsAstNode(node), &status);
+        }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
+        if (wantStatus != nullptr && PyObject_IsTrue(wantStatus)) {
+          PyObject* tuple = xPyTuple_New(2);
+          PyTuple_SetItem(tuple, 0, PyLong_FromUint512(value));
+          PyTuple_SetItem(tuple, 1, PyLong_FromUint32(status));
+          return tuple;
+        }
+
+        return PyLong_FromUint512(value);
+      }
+
+
+      static PyObject* TritonContext_getPathMinValue(PyObject* self, PyObject* args) {
+        triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+        triton::uint512 value = 0;
+        PyObject* node       = nullptr;
+        PyObject* wantStatus = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &node, &wantStatus);
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "getPathMinValue(): Expects a AstNode as first argument.");
+
+        if (wantStatus != nullptr && !PyBool_Check(wantStatus))
+          return PyErr_Format(PyExc_TypeError, "getPathMinValue(): Expects a boolean as second argument.");
+
+        try {
+          value = PyTritonContext_AsTritonContext(self)->getPathMinValue(PyAstNode_AsAstNode(node), &status);
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        if (wantStatus != nullptr && PyObject_IsTrue(wantStatus)) {
+          PyObject* tuple = xPyTuple_New(2);
+          PyTuple_SetItem(tuple, 0, PyLong_FromUint512(value));
+          PyTuple_SetItem(tuple, 1, PyLong_FromUint32(status));
+          return tuple;
+        }
+
+        return PyLong_FromUint512(value);
+      }
+
+
+      static PyObject* TritonContext_getPathValues(PyObject* self, PyObject* args) {
+        triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+        std::vector<triton::uint512> values;
+        PyObject* node       = nullptr;
+        PyObject* limit      = nullptr;
+        PyObject* wantStatus = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOO", &node, &limit, &wantStatus);
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "getPathValues(): Expects a AstNode as first argument.");
+
+        if (limit == nullptr || (!PyLong_Check(limit) && !PyInt_Check(limit)))
+          return PyErr_Format(PyExc_TypeError, "getPathValues(): Expects an integer as second argument.");
+
+        if (wantStatus != nullptr && !PyBool_Check(wantStatus))
+          return PyErr_Format(PyExc_TypeError, "getPathValues(): Expects a boolean as third argument.");
+
+        try {
+          values = PyTritonContext_AsTritonContext(self)->getPathValues(PyAstNode_AsAstNode(node), PyLong_AsUsize(limit), &status);
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        PyObject* ret = xPyList_New(values.size());
+        for (triton::usize index = 0; index < values.size(); index++)
+          PyList_SetItem(ret, index, PyLong_FromUint512(values[index]));
+
+        if (wantStatus != nullptr && PyObject_IsTrue(wantStatus)) {
+          PyObject* tuple = xPyTuple_New(2);
+          PyTuple_SetItem(tuple, 0, ret);
+          PyTuple_SetItem(tuple, 1, PyLong_FromUint32(status));
+          return tuple;
+        }
+
+        return ret;
       }
 
 
@@ -1463,6 +2137,257 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_getRegisterTaintLabels(PyObject* self, PyObject* reg) {
+        PyObject* ret = nullptr;
+
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "getRegisterTaintLabels(): Expects a Register as argument.");
+
+        try {
+          std::vector<triton::uint32> labels = PyTritonContext_AsTritonContext(self)->getRegisterTaintLabels(*PyRegister_AsRegister(reg));
+
+          ret = xPyList_New(labels.size());
+          for (triton::usize index = 0; index < labels.size(); index++)
+            PyList_SetItem(ret, index, PyLong_FromUint32(labels[index]));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getSolverCacheCapacity(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getSolverCacheCapacity());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSolverCacheStatistics(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          const auto& stats = PyTritonContext_AsTritonContext(self)->getSolverCacheStatistics();
+
+          ret = xPyDict_New();
+          xPyDict_SetItem(ret, xPyString_FromString("hits"),              PyLong_FromUsize(stats.hits));
+          xPyDict_SetItem(ret, xPyString_FromString("unsatSupersetHits"), PyLong_FromUsize(stats.unsatSupersetHits));
+          xPyDict_SetItem(ret, xPyString_FromString("satSubsetHits"),     PyLong_FromUsize(stats.satSubsetHits));
+          xPyDict_SetItem(ret, xPyString_FromString("misses"),            PyLong_FromUsize(stats.misses));
+          xPyDict_SetItem(ret, xPyString_FromString("evictions"),         PyLong_FromUsize(stats.evictions));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getSolverIntervalStatistics(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          const auto& stats = PyTritonContext_AsTritonContext(self)->getSolverIntervalStatistics();
+
+          ret = xPyDict_New();
+          xPyDict_SetItem(ret, xPyString_FromString("queries"), PyLong_FromUsize(stats.queries));
+          xPyDict_SetItem(ret, xPyString_FromString("sat"),     PyLong_FromUsize(stats.sat));
+          xPyDict_SetItem(ret, xPyString_FromString("unsat"),   PyLong_FromUsize(stats.unsat));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getSolverLimits(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          const auto& limits = PyTritonContext_AsTritonContext(self)->getSolverLimits();
+          ret = xPyDict_New();
+          xPyDict_SetItem(ret, xPyString_FromString("timeout"),   PyLong_FromUint32(limits.timeout));
+          xPyDict_SetItem(ret, xPyString_FromString("memory"),    PyLong_FromUint32(limits.memory));
+          xPyDict_SetItem(ret, xPyString_FromString("conflicts"), PyLong_FromUint32(limits.conflicts));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getSolverLocalSearchBudget(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getSolverLocalSearchBudget());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSolverLocalSearchStatistics(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          const auto& stats = PyTritonContext_AsTritonContext(self)->getSolverLocalSearchStatistics();
+
+          ret = xPyDict_New();
+          xPyDict_SetItem(ret, xPyString_FromString("queries"),     PyLong_FromUsize(stats.queries));
+          xPyDict_SetItem(ret, xPyString_FromString("solved"),      PyLong_FromUsize(stats.solved));
+          xPyDict_SetItem(ret, xPyString_FromString("evaluations"), PyLong_FromUsize(stats.evaluations));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getSolverModelPoolCapacity(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getSolverModelPoolCapacity());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSolverModelPoolStatistics(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          const auto& stats = PyTritonContext_AsTritonContext(self)->getSolverModelPoolStatistics();
+
+          ret = xPyDict_New();
+          xPyDict_SetItem(ret, xPyString_FromString("queries"),      PyLong_FromUsize(stats.queries));
+          xPyDict_SetItem(ret, xPyString_FromString("concreteHits"), PyLong_FromUsize(stats.concreteHits));
+          xPyDict_SetItem(ret, xPyString_FromString("poolHits"),     PyLong_FromUsize(stats.poolHits));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getSolverOptimisticStrategy(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->getSolverOptimisticStrategy());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSolverPersistentCacheStatistics(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          const auto& stats = PyTritonContext_AsTritonContext(self)->getSolverPersistentCacheStatistics();
+
+          ret = xPyDict_New();
+          xPyDict_SetItem(ret, xPyString_FromString("hits"),             PyLong_FromUsize(stats.hits));
+          xPyDict_SetItem(ret, xPyString_FromString("misses"),           PyLong_FromUsize(stats.misses));
+          xPyDict_SetItem(ret, xPyString_FromString("corruptedRecords"), PyLong_FromUsize(stats.corruptedRecords));
+          xPyDict_SetItem(ret, xPyString_FromString("compactions"),      PyLong_FromUsize(stats.compactions));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getSolverPortfolio(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          const auto& portfolio = PyTritonContext_AsTritonContext(self)->getSolverPortfolio();
+          triton::usize index = 0;
+
+          ret = xPyList_New(portfolio.size());
+          for (const auto& config : portfolio) {
+            PyObject* item = xPyDict_New();
+            xPyDict_SetItem(item, xPyString_FromString("name"),   xPyString_FromString(config.name.c_str()));
+            xPyDict_SetItem(item, xPyString_FromString("tactic"), xPyString_FromString(config.tactic.c_str()));
+            xPyDict_SetItem(item, xPyString_FromString("seed"),   PyLong_FromUint32(config.seed));
+            PyList_SetItem(ret, index++, item);
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getSolverPortfolioWinner(PyObject* self, PyObject* noarg) {
+        try {
+          return xPyString_FromString(PyTritonContext_AsTritonContext(self)->getSolverPortfolioWinner().c_str());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSolverPortfolioWins(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          const auto& wins = PyTritonContext_AsTritonContext(self)->getSolverPortfolioWins();
+          triton::usize index = 0;
+
+          ret = xPyList_New(wins.size());
+          for (const auto& count : wins)
+            PyList_SetItem(ret, index++, PyLong_FromUsize(count));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getSolverPreprocessingStatistics(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          const auto& stats = PyTritonContext_AsTritonContext(self)->getSolverPreprocessingStatistics();
+
+          ret = xPyDict_New();
+          xPyDict_SetItem(ret, xPyString_FromString("queries"),       PyLong_FromUsize(stats.queries));
+          xPyDict_SetItem(ret, xPyString_FromString("duplicates"),    PyLong_FromUsize(stats.duplicates));
+          xPyDict_SetItem(ret, xPyString_FromString("substitutions"), PyLong_FromUsize(stats.substitutions));
+          xPyDict_SetItem(ret, xPyString_FromString("implied"),       PyLong_FromUsize(stats.implied));
+          xPyDict_SetItem(ret, xPyString_FromString("answered"),      PyLong_FromUsize(stats.answered));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* TritonContext_getSymbolicExpressionFromId(PyObject* self, PyObject* symExprId) {
         if (!PyLong_Check(symExprId) && !PyInt_Check(symExprId))
           return PyErr_Format(PyExc_TypeError, "getSymbolicExpressionFromId(): Expects an integer as argument.");
@@ -1494,6 +2419,56 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_getSymbolicExpressionsAtAddress(PyObject* self, PyObject* addr) {
+        PyObject* ret = nullptr;
+
+        if (!PyLong_Check(addr) && !PyInt_Check(addr))
+          return PyErr_Format(PyExc_TypeError, "getSymbolicExpressionsAtAddress(): Expects an integer as argument.");
+
+        try {
+          std::vector<triton::engines::symbolic::SharedSymbolicExpression> exprs;
+          triton::usize index = 0;
+
+          for (const auto& expr : PyTritonContext_AsTritonContext(self)->getSymbolicExpressionsAtAddress(PyLong_AsUint64(addr)))
+            exprs.push_back(expr);
+
+          ret = xPyList_New(exprs.size());
+          for (const auto& expr : exprs)
+            PyList_SetItem(ret, index++, PySymbolicExpression(expr));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getSymbolicExpressionsOfKind(PyObject* self, PyObject* kind) {
+        PyObject* ret = nullptr;
+
+        if (!PyLong_Check(kind) && !PyInt_Check(kind))
+          return PyErr_Format(PyExc_TypeError, "getSymbolicExpressionsOfKind(): Expects a SYMBOLIC kind as argument.");
+
+        try {
+          std::vector<triton::engines::symbolic::SharedSymbolicExpression> exprs;
+          triton::usize index = 0;
+
+          for (const auto& expr : PyTritonContext_AsTritonContext(self)->getSymbolicExpressionsOfKind(static_cast<triton::engines::symbolic::expression_e>(PyLong_AsUint32(kind))))
+            exprs.push_back(expr);
+
+          ret = xPyList_New(exprs.size());
+          for (const auto& expr : exprs)
+            PyList_SetItem(ret, index++, PySymbolicExpression(expr));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* TritonContext_getSymbolicMemory(PyObject* self, PyObject* args) {
         PyObject* ret  = nullptr;
         PyObject* addr = nullptr;
@@ -1651,6 +2626,29 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_getTaintedMemoryRanges(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+        triton::usize index = 0;
+
+        try {
+          std::vector<std::pair<triton::uint64, triton::uint64>> ranges = PyTritonContext_AsTritonContext(self)->getTaintedMemoryRanges();
+
+          ret = xPyList_New(ranges.size());
+          for (const auto& range : ranges) {
+            PyObject* item = xPyTuple_New(2);
+            PyTuple_SetItem(item, 0, PyLong_FromUint64(range.first));
+            PyTuple_SetItem(item, 1, PyLong_FromUint64(range.second));
+            PyList_SetItem(ret, index++, item);
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* TritonContext_getTaintedRegisters(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
         triton::usize size = 0, index = 0;
@@ -1695,6 +2693,19 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_interruptSolver(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->interruptSolver();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_isArchitectureValid(PyObject* self, PyObject* noarg) {
         try {
           if (PyTritonContext_AsTritonContext(self)->isArchitectureValid() == true)
@@ -1722,6 +2733,41 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_isFlippedPathConstraintsSat(PyObject* self, PyObject* args) {
+        triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+        PyObject* index      = nullptr;
+        PyObject* wantStatus = nullptr;
+        bool sat             = false;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &index, &wantStatus);
+
+        if (index == nullptr || (!PyLong_Check(index) && !PyInt_Check(index)))
+          return PyErr_Format(PyExc_TypeError, "isFlippedPathConstraintsSat(): Expects an integer as first argument.");
+
+        if (wantStatus != nullptr && !PyBool_Check(wantStatus))
+          return PyErr_Format(PyExc_TypeError, "isFlippedPathConstraintsSat(): Expects a boolean as second argument.");
+
+        try {
+          sat = PyTritonContext_AsTritonContext(self)->isFlippedPathConstraintsSat(PyLong_AsUsize(index), &status);
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        if (wantStatus != nullptr && PyObject_IsTrue(wantStatus)) {
+          PyObject* tuple = xPyTuple_New(2);
+          PyTuple_SetItem(tuple, 0, PyBool_FromLong(sat));
+          PyTuple_SetItem(tuple, 1, PyLong_FromUint32(status));
+          return tuple;
+        }
+
+        if (sat == true)
+          Py_RETURN_TRUE;
+        Py_RETURN_FALSE;
+      }
+
+
       static PyObject* TritonContext_isMemoryMapped(PyObject* self, PyObject* args) {
         PyObject* baseAddr        = nullptr;
         PyObject* size            = nullptr;
@@ -1751,6 +2797,30 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_isMemoryRangeTainted(PyObject* self, PyObject* args) {
+        PyObject* addr = nullptr;
+        PyObject* size = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &addr, &size);
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "isMemoryRangeTainted(): Expects an integer as first argument.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "isMemoryRangeTainted(): Expects an integer as second argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isMemoryRangeTainted(PyLong_AsUint64(addr), PyLong_AsUint64(size)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_isMemorySymbolized(PyObject* self, PyObject* mem) {
         try {
           if (PyMemoryAccess_Check(mem)) {
@@ -1857,12 +2927,79 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_isSat(PyObject* self, PyObject* node) {
-        if (!PyAstNode_Check(node))
-          return PyErr_Format(PyExc_TypeError, "isSat(): Expects a AstNode as argument.");
+      static PyObject* TritonContext_isSat(PyObject* self, PyObject* args) {
+        triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+        triton::engines::solver::SolverLimits limits;
+        PyObject* node          = nullptr;
+        PyObject* wantStatus    = nullptr;
+        PyObject* timeout       = nullptr;
+        PyObject* memoryLimit   = nullptr;
+        PyObject* conflictLimit = nullptr;
+        bool sat                = false;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOOOO", &node, &wantStatus, &timeout, &memoryLimit, &conflictLimit);
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "isSat(): Expects a AstNode as first argument.");
+
+        if (wantStatus != nullptr && !PyBool_Check(wantStatus))
+          return PyErr_Format(PyExc_TypeError, "isSat(): Expects a boolean as second argument.");
+
+        if ((timeout != nullptr && !PyLong_Check(timeout) && !PyInt_Check(timeout)) ||
+            (memoryLimit != nullptr && !PyLong_Check(memoryLimit) && !PyInt_Check(memoryLimit)) ||
+            (conflictLimit != nullptr && !PyLong_Check(conflictLimit) && !PyInt_Check(conflictLimit)))
+          return PyErr_Format(PyExc_TypeError, "isSat(): Expects integers as limits.");
+
+        if (timeout != nullptr)
+          limits.timeout = PyLong_AsUint32(timeout);
+
+        if (memoryLimit != nullptr)
+          limits.memory = PyLong_AsUint32(memoryLimit);
+
+        if (conflictLimit != nullptr)
+          limits.conflicts = PyLong_AsUint32(conflictLimit);
+
+        triton::API* api = PyTritonContext_AsTritonContext(self);
+        triton::ast::SharedAbstractNode query = PyAstNode_AsAstNode(node);
+
+        try {
+          /* The GIL is released so that another thread may interrupt the solver */
+          ReleasedGil released;
+          sat = api->isSat(query, &status, limits);
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        if (wantStatus != nullptr && PyObject_IsTrue(wantStatus)) {
+          PyObject* tuple = xPyTuple_New(2);
+          PyTuple_SetItem(tuple, 0, PyBool_FromLong(sat));
+          PyTuple_SetItem(tuple, 1, PyLong_FromUint32(status));
+          return tuple;
+        }
+
+        if (sat == true)
+          Py_RETURN_TRUE;
+        Py_RETURN_FALSE;
+      }
+
 
+      static PyObject* TritonContext_isSolverPersistentCacheOpened(PyObject* self, PyObject* noarg) {
         try {
-          if (PyTritonContext_AsTritonContext(self)->isSat(PyAstNode_AsAstNode(node)) == true)
+          if (PyTritonContext_AsTritonContext(self)->isSolverPersistentCacheOpened() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isSolverRecording(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isSolverRecording() == true)
             Py_RETURN_TRUE;
           Py_RETURN_FALSE;
         }
@@ -1978,6 +3115,34 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_openSolverPersistentCache(PyObject* self, PyObject* args) {
+        PyObject* path    = nullptr;
+        PyObject* maxSize = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &path, &maxSize);
+
+        if (path == nullptr || !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "openSolverPersistentCache(): Expects a string as first argument.");
+
+        if (maxSize != nullptr && !PyLong_Check(maxSize) && !PyInt_Check(maxSize))
+          return PyErr_Format(PyExc_TypeError, "openSolverPersistentCache(): Expects an integer as second argument.");
+
+        try {
+          if (maxSize != nullptr)
+            PyTritonContext_AsTritonContext(self)->openSolverPersistentCache(PyStr_AsString(path), PyLong_AsUsize(maxSize));
+          else
+            PyTritonContext_AsTritonContext(self)->openSolverPersistentCache(PyStr_AsString(path));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_processing(PyObject* self, PyObject* inst) {
         if (!PyInstruction_Check(inst))
           return PyErr_Format(PyExc_TypeError, "processing(): Expects an Instruction as argument.");
@@ -2070,6 +3235,19 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_resetSolverSession(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->resetSolverSession();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_setArchitecture(PyObject* self, PyObject* arg) {
         if (!PyLong_Check(arg) && !PyInt_Check(arg))
           return PyErr_Format(PyExc_TypeError, "setArchitecture(): Expects an ARCH as argument.");
@@ -2272,6 +3450,196 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_setMemoryBudget(PyObject* self, PyObject* bytes) {
+        if (!PyLong_Check(bytes) && !PyInt_Check(bytes))
+          return PyErr_Format(PyExc_TypeError, "setMemoryBudget(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setMemoryBudget(PyLong_AsUsize(bytes));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setSmtLibSolver(PyObject* self, PyObject* command) {
+        std::vector<std::string> arguments;
+
+        if (!PyList_Check(command))
+          return PyErr_Format(PyExc_TypeError, "setSmtLibSolver(): Expects a list of strings as argument.");
+
+        for (Py_ssize_t i = 0; i < PyList_Size(command); i++) {
+          PyObject* item = PyList_GetItem(command, i);
+          if (!PyStr_Check(item))
+            return PyErr_Format(PyExc_TypeError, "setSmtLibSolver(): Expects a list of strings as argument.");
+          arguments.push_back(PyStr_AsString(item));
+        }
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setSmtLibSolver(arguments);
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setSolverCacheCapacity(PyObject* self, PyObject* capacity) {
+        if (!PyLong_Check(capacity) && !PyInt_Check(capacity))
+          return PyErr_Format(PyExc_TypeError, "setSolverCacheCapacity(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setSolverCacheCapacity(PyLong_AsUsize(capacity));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setSolverLimits(PyObject* self, PyObject* args) {
+        triton::engines::solver::SolverLimits limits;
+        PyObject* timeout       = nullptr;
+        PyObject* memoryLimit   = nullptr;
+        PyObject* conflictLimit = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOO", &timeout, &memoryLimit, &conflictLimit);
+
+        if (timeout == nullptr || (!PyLong_Check(timeout) && !PyInt_Check(timeout)))
+          return PyErr_Format(PyExc_TypeError, "setSolverLimits(): Expects an integer as first argument.");
+
+        if (memoryLimit != nullptr && !PyLong_Check(memoryLimit) && !PyInt_Check(memoryLimit))
+          return PyErr_Format(PyExc_TypeError, "setSolverLimits(): Expects an integer as second argument.");
+
+        if (conflictLimit != nullptr && !PyLong_Check(conflictLimit) && !PyInt_Check(conflictLimit))
+          return PyErr_Format(PyExc_TypeError, "setSolverLimits(): Expects an integer as third argument.");
+
+        limits.timeout = PyLong_AsUint32(timeout);
+
+        if (memoryLimit != nullptr)
+          limits.memory = PyLong_AsUint32(memoryLimit);
+
+        if (conflictLimit != nullptr)
+          limits.conflicts = PyLong_AsUint32(conflictLimit);
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setSolverLimits(limits);
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setSolverLocalSearchBudget(PyObject* self, PyObject* budget) {
+        if (!PyLong_Check(budget) && !PyInt_Check(budget))
+          return PyErr_Format(PyExc_TypeError, "setSolverLocalSearchBudget(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setSolverLocalSearchBudget(PyLong_AsUsize(budget));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setSolverModelPoolCapacity(PyObject* self, PyObject* capacity) {
+        if (!PyLong_Check(capacity) && !PyInt_Check(capacity))
+          return PyErr_Format(PyExc_TypeError, "setSolverModelPoolCapacity(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setSolverModelPoolCapacity(PyLong_AsUsize(capacity));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setSolverOptimisticStrategy(PyObject* self, PyObject* strategy) {
+        if (!PyLong_Check(strategy) && !PyInt_Check(strategy))
+          return PyErr_Format(PyExc_TypeError, "setSolverOptimisticStrategy(): Expects an OPTIMISTIC strategy as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setSolverOptimisticStrategy(static_cast<triton::engines::solver::optimistic_e>(PyLong_AsUint32(strategy)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setSolverPortfolio(PyObject* self, PyObject* configurations) {
+        std::vector<triton::engines::solver::SolverConfiguration> portfolio;
+
+        if (!PyList_Check(configurations))
+          return PyErr_Format(PyExc_TypeError, "setSolverPortfolio(): Expects a list of dictionaries as argument.");
+
+        for (Py_ssize_t i = 0; i < PyList_Size(configurations); i++) {
+          PyObject* item = PyList_GetItem(configurations, i);
+          triton::engines::solver::SolverConfiguration config;
+
+          if (!PyDict_Check(item))
+            return PyErr_Format(PyExc_TypeError, "setSolverPortfolio(): Each item of the list must be a dictionary.");
+
+          PyObject* name   = PyDict_GetItemString(item, "name");
+          PyObject* tactic = PyDict_GetItemString(item, "tactic");
+          PyObject* seed   = PyDict_GetItemString(item, "seed");
+
+          if (name == nullptr || !PyStr_Check(name))
+            return PyErr_Format(PyExc_TypeError, "setSolverPortfolio(): Each configuration must have a string name.");
+
+          if (tactic != nullptr && !PyStr_Check(tactic))
+            return PyErr_Format(PyExc_TypeError, "setSolverPortfolio(): The tactic must be a string.");
+
+          if (seed != nullptr && !PyLong_Check(seed) && !PyInt_Check(seed))
+            return PyErr_Format(PyExc_TypeError, "setSolverPortfolio(): The seed must be an integer.");
+
+          config.name = PyStr_AsString(name);
+          if (tactic != nullptr)
+            config.tactic = PyStr_AsString(tactic);
+          if (seed != nullptr)
+            config.seed = PyLong_AsUint32(seed);
+
+          portfolio.push_back(config);
+        }
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setSolverPortfolio(portfolio);
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_setTaintMemory(PyObject* self, PyObject* args) {
         PyObject* mem  = nullptr;
         PyObject* flag = nullptr;
@@ -2366,6 +3734,111 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_solveAllBranchFlips(PyObject* self, PyObject* args) {
+        PyObject* ret        = nullptr;
+        PyObject* maxThreads = nullptr;
+        PyObject* timeout    = nullptr;
+        PyObject* callback   = nullptr;
+        triton::engines::solver::BranchFlipCallback cb = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOO", &maxThreads, &timeout, &callback);
+
+        if (maxThreads != nullptr && !PyLong_Check(maxThreads) && !PyInt_Check(maxThreads))
+          return PyErr_Format(PyExc_TypeError, "solveAllBranchFlips(): Expects an integer as first argument.");
+
+        if (timeout != nullptr && !PyLong_Check(timeout) && !PyInt_Check(timeout))
+          return PyErr_Format(PyExc_TypeError, "solveAllBranchFlips(): Expects an integer as second argument.");
+
+        if (callback != nullptr && callback != Py_None && !PyCallable_Check(callback))
+          return PyErr_Format(PyExc_TypeError, "solveAllBranchFlips(): Expects a function as third argument.");
+
+        /* The callback is called from this thread */
+        if (callback != nullptr && callback != Py_None) {
+          cb = [callback](triton::usize index, const std::map<triton::uint32, triton::engines::solver::SolverModel>& model) {
+            PyObject* dict = xPyDict_New();
+            for (auto it = model.begin(); it != model.end(); it++)
+              xPyDict_SetItem(dict, PyLong_FromUint32(it->first), PySolverModel(it->second));
+
+            PyObject* cbArgs = xPyTuple_New(2);
+            PyTuple_SetItem(cbArgs, 0, PyLong_FromUsize(index));
+            PyTuple_SetItem(cbArgs, 1, dict);
+
+            PyObject* cbRet = PyObject_CallObject(callback, cbArgs);
+            Py_DECREF(cbArgs);
+
+            /* Check the call */
+            if (cbRet == nullptr) {
+              PyObject* type      = nullptr;
+              PyObject* value     = nullptr;
+              PyObject* traceback = nullptr;
+
+              /* Fetch the last exception */
+              PyErr_Fetch(&type, &value, &traceback);
+
+              std::string str = PyStr_AsString(PyObject_Str(value));
+              Py_XDECREF(type);
+              Py_XDECREF(value);
+              Py_XDECREF(traceback);
+              throw triton::exceptions::Callbacks(str);
+            }
+
+            Py_DECREF(cbRet);
+          };
+        }
+
+        try {
+          auto models = PyTritonContext_AsTritonContext(self)->solveAllBranchFlips(
+                          maxThreads != nullptr ? PyLong_AsUsize(maxThreads) : 0,
+                          timeout != nullptr ? PyLong_AsUint32(timeout) : 0,
+                          cb
+                        );
+
+          ret = xPyDict_New();
+          for (const auto& flip : models) {
+            PyObject* model = xPyDict_New();
+            for (auto it = flip.second.begin(); it != flip.second.end(); it++)
+              xPyDict_SetItem(model, PyLong_FromUint32(it->first), PySolverModel(it->second));
+            xPyDict_SetItem(ret, PyLong_FromUsize(flip.first), model);
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_startSolverRecording(PyObject* self, PyObject* path) {
+        if (!PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "startSolverRecording(): Expects a string as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->startSolverRecording(PyStr_AsString(path));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_stopSolverRecording(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->stopSolverRecording();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_taintAssignmentMemoryImmediate(PyObject* self, PyObject* mem) {
         if (!PyMemoryAccess_Check(mem))
           return PyErr_Format(PyExc_TypeError, "taintAssignmentMemoryImmediate(): Expects a MemoryAccess as argument.");
@@ -2514,6 +3987,62 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_taintMemoryRange(PyObject* self, PyObject* args) {
+        PyObject* addr = nullptr;
+        PyObject* size = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &addr, &size);
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "taintMemoryRange(): Expects an integer as first argument.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "taintMemoryRange(): Expects an integer as second argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->taintMemoryRange(PyLong_AsUint64(addr), PyLong_AsUint64(size)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_taintMemoryWithLabel(PyObject* self, PyObject* args) {
+        PyObject* mem   = nullptr;
+        PyObject* label = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &mem, &label);
+
+        if (label == nullptr || (!PyLong_Check(label) && !PyInt_Check(label)))
+          return PyErr_Format(PyExc_TypeError, "taintMemoryWithLabel(): Expects a label as second argument.");
+
+        try {
+          if (mem != nullptr && PyMemoryAccess_Check(mem)) {
+            if (PyTritonContext_AsTritonContext(self)->taintMemoryWithLabel(*PyMemoryAccess_AsMemoryAccess(mem), PyLong_AsUint32(label)) == true)
+              Py_RETURN_TRUE;
+          }
+
+          else if (mem != nullptr && (PyLong_Check(mem) || PyInt_Check(mem))) {
+            if (PyTritonContext_AsTritonContext(self)->taintMemoryWithLabel(triton::arch::MemoryAccess(PyLong_AsUint64(mem), BYTE_SIZE), PyLong_AsUint32(label)) == true)
+              Py_RETURN_TRUE;
+          }
+
+          else
+            return PyErr_Format(PyExc_TypeError, "taintMemoryWithLabel(): Expects a MemoryAccess or an integer as first argument.");
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_RETURN_FALSE;
+      }
+
+
       static PyObject* TritonContext_taintRegister(PyObject* self, PyObject* reg) {
         if (!PyRegister_Check(reg))
           return PyErr_Format(PyExc_TypeError, "taintRegister(): Expects a Register as argument.");
@@ -2529,6 +4058,30 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_taintRegisterWithLabel(PyObject* self, PyObject* args) {
+        PyObject* reg   = nullptr;
+        PyObject* label = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &reg, &label);
+
+        if (reg == nullptr || !PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "taintRegisterWithLabel(): Expects a Register as first argument.");
+
+        if (label == nullptr || (!PyLong_Check(label) && !PyInt_Check(label)))
+          return PyErr_Format(PyExc_TypeError, "taintRegisterWithLabel(): Expects a label as second argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->taintRegisterWithLabel(*PyRegister_AsRegister(reg), PyLong_AsUint32(label)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_taintUnionMemoryImmediate(PyObject* self, PyObject* mem) {
         if (!PyMemoryAccess_Check(mem))
           return PyErr_Format(PyExc_TypeError, "taintUnionMemoryImmediate(): Expects a MemoryAccess as argument.");
@@ -2707,6 +4260,30 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_untaintMemoryRange(PyObject* self, PyObject* args) {
+        PyObject* addr = nullptr;
+        PyObject* size = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &addr, &size);
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "untaintMemoryRange(): Expects an integer as first argument.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "untaintMemoryRange(): Expects an integer as second argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->untaintMemoryRange(PyLong_AsUint64(addr), PyLong_AsUint64(size)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_untaintRegister(PyObject* self, PyObject* reg) {
         if (!PyRegister_Check(reg))
           return PyErr_Format(PyExc_TypeError, "untaintRegister(): Expects a Register as argument.");
@@ -2767,6 +4344,8 @@ namespace triton {
         {"assignSymbolicExpressionToRegister",  (PyCFunction)TritonContext_assignSymbolicExpressionToRegister,     METH_VARARGS,       ""},
         {"buildSemantics",                      (PyCFunction)TritonContext_buildSemantics,                         METH_O,             ""},
         {"clearPathConstraints",                (PyCFunction)TritonContext_clearPathConstraints,                   METH_NOARGS,        ""},
+        {"clearSolverCache",                    (PyCFunction)TritonContext_clearSolverCache,                       METH_NOARGS,        ""},
+        {"closeSolverPersistentCache",          (PyCFunction)TritonContext_closeSolverPersistentCache,             METH_NOARGS,        ""},
         {"concretizeAllMemory",                 (PyCFunction)TritonContext_concretizeAllMemory,                    METH_NOARGS,        ""},
         {"concretizeAllRegister",               (PyCFunction)TritonContext_concretizeAllRegister,                  METH_NOARGS,        ""},
         {"concretizeMemory",                    (PyCFunction)TritonContext_concretizeMemory,                       METH_O,             ""},
@@ -2782,7 +4361,10 @@ namespace triton {
         {"enableMode",                          (PyCFunction)TritonContext_enableMode,                             METH_VARARGS,       ""},
         {"enableSymbolicEngine",                (PyCFunction)TritonContext_enableSymbolicEngine,                   METH_O,             ""},
         {"enableTaintEngine",                   (PyCFunction)TritonContext_enableTaintEngine,                      METH_O,             ""},
+        {"enforceMemoryBudget",                 (PyCFunction)TritonContext_enforceMemoryBudget,                    METH_NOARGS,        ""},
         {"evaluateAstViaZ3",                    (PyCFunction)TritonContext_evaluateAstViaZ3,                       METH_O,             ""},
+        {"forwardSliceExpressions",             (PyCFunction)TritonContext_forwardSliceExpressions,                METH_O,             ""},
+        {"forwardSlicePathConstraints",         (PyCFunction)TritonContext_forwardSlicePathConstraints,            METH_O,             ""},
         {"getAllRegisters",                     (PyCFunction)TritonContext_getAllRegisters,                        METH_NOARGS,        ""},
         {"getArchitecture",                     (PyCFunction)TritonContext_getArchitecture,                        METH_NOARGS,        ""},
         {"getAstContext",                       (PyCFunction)TritonContext_getAstContext,                          METH_NOARGS,        ""},
@@ -2791,20 +4373,46 @@ namespace triton {
         {"getConcreteMemoryValue",              (PyCFunction)TritonContext_getConcreteMemoryValue,                 METH_O,             ""},
         {"getConcreteRegisterValue",            (PyCFunction)TritonContext_getConcreteRegisterValue,               METH_O,             ""},
         {"getConcreteVariableValue",            (PyCFunction)TritonContext_getConcreteVariableValue,               METH_O,             ""},
+        {"getEstimatedMemory",                  (PyCFunction)TritonContext_getEstimatedMemory,                     METH_NOARGS,        ""},
+        {"getEvictionStatistics",               (PyCFunction)TritonContext_getEvictionStatistics,                  METH_NOARGS,        ""},
+        {"getFlippedPathConstraintsAst",        (PyCFunction)TritonContext_getFlippedPathConstraintsAst,           METH_O,             ""},
+        {"getFlippedPathConstraintsModel",      (PyCFunction)TritonContext_getFlippedPathConstraintsModel,         METH_VARARGS,       ""},
         {"getGprBitSize",                       (PyCFunction)TritonContext_getGprBitSize,                          METH_NOARGS,        ""},
         {"getGprSize",                          (PyCFunction)TritonContext_getGprSize,                             METH_NOARGS,        ""},
         {"getImmediateAst",                     (PyCFunction)TritonContext_getImmediateAst,                        METH_O,             ""},
         {"getMemoryAst",                        (PyCFunction)TritonContext_getMemoryAst,                           METH_O,             ""},
-        {"getModel",                            (PyCFunction)TritonContext_getModel,                               METH_O,             ""},
+        {"getMemoryBudget",                     (PyCFunction)TritonContext_getMemoryBudget,                        METH_NOARGS,        ""},
+        {"getMemoryTaintLabels",                (PyCFunction)TritonContext_getMemoryTaintLabels,                   METH_O,             ""},
+        {"getModel",                            (PyCFunction)TritonContext_getModel,                               METH_VARARGS,       ""},
         {"getModels",                           (PyCFunction)TritonContext_getModels,                              METH_VARARGS,       ""},
         {"getParentRegister",                   (PyCFunction)TritonContext_getParentRegister,                      METH_O,             ""},
         {"getParentRegisters",                  (PyCFunction)TritonContext_getParentRegisters,                     METH_NOARGS,        ""},
         {"getPathConstraints",                  (PyCFunction)TritonContext_getPathConstraints,                     METH_NOARGS,        ""},
-        {"getPathConstraintsAst",               (PyCFunction)TritonContext_getPathConstraintsAst,                  METH_NOARGS,        ""},
+        {"getPathConstraintsAst",               (PyCFunction)TritonContext_getPathConstraintsAst,                  METH_VARARGS,       ""},
+        {"getPathMaxValue",                     (PyCFunction)TritonContext_getPathMaxValue,                        METH_VARARGS,       ""},
+        {"getPathMinValue",                     (PyCFunction)TritonContext_getPathMinValue,                        METH_VARARGS,       ""},
+        {"getPathValues",                       (PyCFunction)TritonContext_getPathValues,                          METH_VARARGS,       ""},
         {"getRegister",                         (PyCFunction)TritonContext_getRegister,                            METH_O,             ""},
         {"getRegisterAst",                      (PyCFunction)TritonContext_getRegisterAst,                         METH_O,             ""},
+        {"getRegisterTaintLabels",              (PyCFunction)TritonContext_getRegisterTaintLabels,                 METH_O,             ""},
+        {"getSolverCacheCapacity",              (PyCFunction)TritonContext_getSolverCacheCapacity,                 METH_NOARGS,        ""},
+        {"getSolverCacheStatistics",            (PyCFunction)TritonContext_getSolverCacheStatistics,               METH_NOARGS,        ""},
+        {"getSolverIntervalStatistics",         (PyCFunction)TritonContext_getSolverIntervalStatistics,            METH_NOARGS,        ""},
+        {"getSolverLimits",                     (PyCFunction)TritonContext_getSolverLimits,                        METH_NOARGS,        ""},
+        {"getSolverLocalSearchBudget",          (PyCFunction)TritonContext_getSolverLocalSearchBudget,             METH_NOARGS,        ""},
+        {"getSolverLocalSearchStatistics",      (PyCFunction)TritonContext_getSolverLocalSearchStatistics,         METH_NOARGS,        ""},
+        {"getSolverModelPoolCapacity",          (PyCFunction)TritonContext_getSolverModelPoolCapacity,             METH_NOARGS,        ""},
+        {"getSolverModelPoolStatistics",        (PyCFunction)TritonContext_getSolverModelPoolStatistics,           METH_NOARGS,        ""},
+        {"getSolverOptimisticStrategy",         (PyCFunction)TritonContext_getSolverOptimisticStrategy,            METH_NOARGS,        ""},
+        {"getSolverPersistentCacheStatistics",  (PyCFunction)TritonContext_getSolverPersistentCacheStatistics,     METH_NOARGS,        ""},
+        {"getSolverPortfolio",                  (PyCFunction)TritonContext_getSolverPortfolio,                     METH_NOARGS,        ""},
+        {"getSolverPortfolioWinner",            (PyCFunction)TritonContext_getSolverPortfolioWinner,               METH_NOARGS,        ""},
+        {"getSolverPortfolioWins",              (PyCFunction)TritonContext_getSolverPortfolioWins,                 METH_NOARGS,        ""},
+        {"getSolverPreprocessingStatistics",    (PyCFunction)TritonContext_getSolverPreprocessingStatistics,       METH_NOARGS,        ""},
         {"getSymbolicExpressionFromId",         (PyCFunction)TritonContext_getSymbolicExpressionFromId,            METH_O,             ""},
         {"getSymbolicExpressions",              (PyCFunction)TritonContext_getSymbolicExpressions,                 METH_NOARGS,        ""},
+        {"getSymbolicExpressionsAtAddress",     (PyCFunction)TritonContext_getSymbolicExpressionsAtAddress,        METH_O,             ""},
+        {"getSymbolicExpressionsOfKind",        (PyCFunction)TritonContext_getSymbolicExpressionsOfKind,           METH_O,             ""},
         {"getSymbolicMemory",                   (PyCFunction)TritonContext_getSymbolicMemory,                      METH_VARARGS,       ""},
         {"getSymbolicMemoryValue",              (PyCFunction)TritonContext_getSymbolicMemoryValue,                 METH_O,             ""},
         {"getSymbolicRegister",                 (PyCFunction)TritonContext_getSymbolicRegister,                    METH_O,             ""},
@@ -2814,11 +4422,15 @@ namespace triton {
         {"getSymbolicVariableFromName",         (PyCFunction)TritonContext_getSymbolicVariableFromName,            METH_O,             ""},
         {"getSymbolicVariables",                (PyCFunction)TritonContext_getSymbolicVariables,                   METH_NOARGS,        ""},
         {"getTaintedMemory",                    (PyCFunction)TritonContext_getTaintedMemory,                       METH_NOARGS,        ""},
+        {"getTaintedMemoryRanges",              (PyCFunction)TritonContext_getTaintedMemoryRanges,                 METH_NOARGS,        ""},
         {"getTaintedRegisters",                 (PyCFunction)TritonContext_getTaintedRegisters,                    METH_NOARGS,        ""},
         {"getTaintedSymbolicExpressions",       (PyCFunction)TritonContext_getTaintedSymbolicExpressions,          METH_NOARGS,        ""},
+        {"interruptSolver",                     (PyCFunction)TritonContext_interruptSolver,                        METH_NOARGS,        ""},
         {"isArchitectureValid",                 (PyCFunction)TritonContext_isArchitectureValid,                    METH_NOARGS,        ""},
         {"isFlag",                              (PyCFunction)TritonContext_isFlag,                                 METH_O,             ""},
+        {"isFlippedPathConstraintsSat",         (PyCFunction)TritonContext_isFlippedPathConstraintsSat,            METH_VARARGS,       ""},
         {"isMemoryMapped",                      (PyCFunction)TritonContext_isMemoryMapped,                         METH_VARARGS,       ""},
+        {"isMemoryRangeTainted",                (PyCFunction)TritonContext_isMemoryRangeTainted,                   METH_VARARGS,       ""},
         {"isMemorySymbolized",                  (PyCFunction)TritonContext_isMemorySymbolized,                     METH_O,             ""},
         {"isMemoryTainted",                     (PyCFunction)TritonContext_isMemoryTainted,                        METH_O,             ""},
         {"isModeEnabled",                       (PyCFunction)TritonContext_isModeEnabled,                          METH_O,             ""},
@@ -2826,26 +4438,41 @@ namespace triton {
         {"isRegisterSymbolized",                (PyCFunction)TritonContext_isRegisterSymbolized,                   METH_O,             ""},
         {"isRegisterTainted",                   (PyCFunction)TritonContext_isRegisterTainted,                      METH_O,             ""},
         {"isRegisterValid",                     (PyCFunction)TritonContext_isRegisterValid,                        METH_O,             ""},
-        {"isSat",                               (PyCFunction)TritonContext_isSat,                                  METH_O     ,        ""},
+        {"isSat",                               (PyCFunction)TritonContext_isSat,                                  METH_VARARGS,       ""},
+        {"isSolverPersistentCacheOpened",       (PyCFunction)TritonContext_isSolverPersistentCacheOpened,          METH_NOARGS,        ""},
+        {"isSolverRecording",                   (PyCFunction)TritonContext_isSolverRecording,                      METH_NOARGS,        ""},
         {"isSymbolicEngineEnabled",             (PyCFunction)TritonContext_isSymbolicEngineEnabled,                METH_NOARGS,        ""},
         {"isSymbolicExpressionIdExists",        (PyCFunction)TritonContext_isSymbolicExpressionIdExists,           METH_O,             ""},
         {"isTaintEngineEnabled",                (PyCFunction)TritonContext_isTaintEngineEnabled,                   METH_NOARGS,        ""},
         {"newSymbolicExpression",               (PyCFunction)TritonContext_newSymbolicExpression,                  METH_VARARGS,       ""},
         {"newSymbolicVariable",                 (PyCFunction)TritonContext_newSymbolicVariable,                    METH_VARARGS,       ""},
+        {"openSolverPersistentCache",           (PyCFunction)TritonContext_openSolverPersistentCache,              METH_VARARGS,       ""},
         {"processing",                          (PyCFunction)TritonContext_processing,                             METH_O,             ""},
         {"removeAllCallbacks",                  (PyCFunction)TritonContext_removeAllCallbacks,                     METH_NOARGS,        ""},
         {"removeCallback",                      (PyCFunction)TritonContext_removeCallback,                         METH_VARARGS,       ""},
         {"reset",                               (PyCFunction)TritonContext_reset,                                  METH_NOARGS,        ""},
+        {"resetSolverSession",                  (PyCFunction)TritonContext_resetSolverSession,                     METH_NOARGS,        ""},
         {"setArchitecture",                     (PyCFunction)TritonContext_setArchitecture,                        METH_O,             ""},
         {"setAstRepresentationMode",            (PyCFunction)TritonContext_setAstRepresentationMode,               METH_O,             ""},
         {"setConcreteMemoryAreaValue",          (PyCFunction)TritonContext_setConcreteMemoryAreaValue,             METH_VARARGS,       ""},
         {"setConcreteMemoryValue",              (PyCFunction)TritonContext_setConcreteMemoryValue,                 METH_VARARGS,       ""},
         {"setConcreteRegisterValue",            (PyCFunction)TritonContext_setConcreteRegisterValue,               METH_VARARGS,       ""},
         {"setConcreteVariableValue",            (PyCFunction)TritonContext_setConcreteVariableValue,               METH_VARARGS,       ""},
+        {"setMemoryBudget",                     (PyCFunction)TritonContext_setMemoryBudget,                        METH_O,             ""},
+        {"setSmtLibSolver",                     (PyCFunction)TritonContext_setSmtLibSolver,                        METH_O,             ""},
+        {"setSolverCacheCapacity",              (PyCFunction)TritonContext_setSolverCacheCapacity,                 METH_O,             ""},
+        {"setSolverLimits",                     (PyCFunction)TritonContext_setSolverLimits,                        METH_VARARGS,       ""},
+        {"setSolverLocalSearchBudget",          (PyCFunction)TritonContext_setSolverLocalSearchBudget,             METH_O,             ""},
+        {"setSolverModelPoolCapacity",          (PyCFunction)TritonContext_setSolverModelPoolCapacity,             METH_O,             ""},
+        {"setSolverOptimisticStrategy",         (PyCFunction)TritonContext_setSolverOptimisticStrategy,            METH_O,             ""},
+        {"setSolverPortfolio",                  (PyCFunction)TritonContext_setSolverPortfolio,                     METH_O,             ""},
         {"setTaintMemory",                      (PyCFunction)TritonContext_setTaintMemory,                         METH_VARARGS,       ""},
         {"setTaintRegister",                    (PyCFunction)TritonContext_setTaintRegister,                       METH_VARARGS,       ""},
         {"simplify",                            (PyCFunction)TritonContext_simplify,                               METH_VARARGS,       ""},
         {"sliceExpressions",                    (PyCFunction)TritonContext_sliceExpressions,                       METH_O,             ""},
+        {"solveAllBranchFlips",                 (PyCFunction)TritonContext_solveAllBranchFlips,                    METH_VARARGS,       ""},
+        {"startSolverRecording",                (PyCFunction)TritonContext_startSolverRecording,                   METH_O,             ""},
+        {"stopSolverRecording",                 (PyCFunction)TritonContext_stopSolverRecording,                    METH_NOARGS,        ""},
         {"taintAssignmentMemoryImmediate",      (PyCFunction)TritonContext_taintAssignmentMemoryImmediate,         METH_O,             ""},
         {"taintAssignmentMemoryMemory",         (PyCFunction)TritonContext_taintAssignmentMemoryMemory,            METH_VARARGS,       ""},
         {"taintAssignmentMemoryRegister",       (PyCFunction)TritonContext_taintAssignmentMemoryRegister,          METH_VARARGS,       ""},
@@ -2853,7 +4480,10 @@ namespace triton {
         {"taintAssignmentRegisterMemory",       (PyCFunction)TritonContext_taintAssignmentRegisterMemory,          METH_VARARGS,       ""},
         {"taintAssignmentRegisterRegister",     (PyCFunction)TritonContext_taintAssignmentRegisterRegister,        METH_VARARGS,       ""},
         {"taintMemory",                         (PyCFunction)TritonContext_taintMemory,                            METH_O,             ""},
+        {"taintMemoryRange",                    (PyCFunction)TritonContext_taintMemoryRange,                       METH_VARARGS,       ""},
+        {"taintMemoryWithLabel",                (PyCFunction)TritonContext_taintMemoryWithLabel,                   METH_VARARGS,       ""},
         {"taintRegister",                       (PyCFunction)TritonContext_taintRegister,                          METH_O,             ""},
+        {"taintRegisterWithLabel",              (PyCFunction)TritonContext_taintRegisterWithLabel,                 METH_VARARGS,       ""},
         {"taintUnionMemoryImmediate",           (PyCFunction)TritonContext_taintUnionMemoryImmediate,              METH_O,             ""},
         {"taintUnionMemoryMemory",              (PyCFunction)TritonContext_taintUnionMemoryMemory,                 METH_VARARGS,       ""},
         {"taintUnionMemoryRegister",            (PyCFunction)TritonContext_taintUnionMemoryRegister,               METH_VARARGS,       ""},
@@ -2862,6 +4492,7 @@ namespace triton {
         {"taintUnionRegisterRegister",          (PyCFunction)TritonContext_taintUnionRegisterRegister,             METH_VARARGS,       ""},
         {"unmapMemory",                         (PyCFunction)TritonContext_unmapMemory,                            METH_VARARGS,       ""},
         {"untaintMemory",                       (PyCFunction)TritonContext_untaintMemory,                          METH_O,             ""},
+        {"untaintMemoryRange",                  (PyCFunction)TritonContext_untaintMemoryRange,                     METH_VARARGS,       ""},
         {"untaintRegister",                     (PyCFunction)TritonContext_untaintRegister,                        METH_O,             ""},
         {nullptr,                               nullptr,                                                           0,                  nullptr}
       };
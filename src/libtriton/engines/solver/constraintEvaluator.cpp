@@ -0,0 +1,411 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <unordered_map>
+#include <utility>
+
+#include <triton/astContext.hpp>
+#include <triton/constraintEvaluator.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/symbolicExpression.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      ConstraintEvaluator::ConstraintEvaluator(const triton::ast::SharedAbstractNode& node) {
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("ConstraintEvaluator::ConstraintEvaluator(): node cannot be null.");
+
+        this->root      = node;
+        this->supported = true;
+        this->compile(node);
+        this->values.resize(this->operations.size());
+      }
+
+
+      /* Post-order walk, the shared nodes and the references are compiled once */
+      void ConstraintEvaluator::compile(const triton::ast::SharedAbstractNode& node) {
+        std::unordered_map<const triton::ast::AbstractNode*, triton::usize> compiled;
+        std::unordered_map<triton::usize, triton::usize> variables;
+        std::vector<std::pair<triton::ast::SharedAbstractNode, bool>> worklist;
+
+        worklist.push_back(std::make_pair(node, false));
+        while (!worklist.empty() && this->supported) {
+          triton::ast::SharedAbstractNode current = worklist.back().first;
+          bool expanded = worklist.back().second;
+
+          if (compiled.find(current.get()) != compiled.end()) {
+            worklist.pop_back();
+            continue;
+          }
+
+          /* A reference is the AST of its expression */
+          if (current->getType() == triton::ast::REFERENCE_NODE) {
+            const triton::ast::SharedAbstractNode& ast = reinterpret_cast<triton::ast::ReferenceNode*>(current.get())->getSymbolicExpression()->getAst();
+            auto it = compiled.find(ast.get());
+            if (it != compiled.end()) {
+              compiled[current.get()] = it->second;
+              worklist.pop_back();
+            }
+            else
+              worklist.push_back(std::make_pair(ast, false));
+            continue;
+          }
+
+          Operation op;
+          op.type  = current->getType();
+          op.size  = current->getBitvectorSize();
+          op.mask  = current->getBitvectorMask();
+          op.value = 0;
+          op.param = 0;
+
+          /* A sub-tree without variable is a constant */
+          if (!current->isSymbolized()) {
+            op.type  = triton::ast::BV_NODE;
+            op.value = current->evaluate();
+          }
+
+          else if (op.type == triton::ast::VARIABLE_NODE) {
+            const auto& var = reinterpret_cast<triton::ast::VariableNode*>(current.get())->getSymbolicVariable();
+            auto it = variables.find(var->getId());
+            if (it == variables.end()) {
+              it = variables.insert(std::make_pair(var->getId(), this->variables.size())).first;
+              this->variables.push_back(var);
+            }
+            op.value = it->second;
+          }
+
+          else if (!expanded) {
+            switch (op.type) {
+              case triton::ast::COMPOUND_NODE:
+              case triton::ast::DECLARE_NODE:
+              case triton::ast::LET_NODE:
+              case triton::ast::STRING_NODE:
+                this->supported = false;
+                continue;
+              default:
+                break;
+            }
+
+            worklist.back().second = true;
+            const auto& children = current->getChildren();
+            for (auto it = children.rbegin(); it != children.rend(); it++)
+              worklist.push_back(std::make_pair(*it, false));
+            continue;
+          }
+
+          else {
+            const auto& children = current->getChildren();
+            triton::usize first = 0;
+
+            /* The integer parameters are read once for all */
+            switch (op.type) {
+              case triton::ast::EXTRACT_NODE:
+                op.param = reinterpret_cast<triton::ast::IntegerNode*>(children[1].get())->getInteger().convert_to<triton::uint32>();
+                first = 2;
+                break;
+              case triton::ast::SX_NODE:
+              case triton::ast::ZX_NODE:
+                op.param = reinterpret_cast<triton::ast::IntegerNode*>(children[0].get())->getInteger().convert_to<triton::uint32>();
+                first = 1;
+                break;
+              case triton::ast::BVROL_NODE:
+              case triton::ast::BVROR_NODE:
+                op.param = reinterpret_cast<triton::ast::IntegerNode*>(children[1].get())->getInteger().convert_to<triton::uint32>() % op.size;
+                break;
+              default:
+                break;
+            }
+
+            triton::usize last = children.size();
+            if (op.type == triton::ast::BVROL_NODE || op.type == triton::ast::BVROR_NODE)
+              last = 1;
+
+            for (triton::usize index = first; index < last; index++)
+              op.operands.push_back(compiled.at(children[index].get()));
+          }
+
+          compiled[current.get()] = this->operations.size();
+          this->operations.push_back(op);
+          worklist.pop_back();
+        }
+      }
+
+
+      /* Same semantics as the init() of the nodes */
+      void ConstraintEvaluator::run(const std::vector<triton::uint512>& assignment) const {
+        if (assignment.size() != this->variables.size())
+          throw triton::exceptions::SolverEngine("ConstraintEvaluator::run(): The assignment must hold one value per variable.");
+
+        for (triton::usize index = 0; index < this->operations.size(); index++) {
+          const Operation& op = this->operations[index];
+          const triton::uint512& a = op.operands.size() > 0 ? this->values[op.operands[0]] : op.value;
+          const triton::uint512& b = op.operands.size() > 1 ? this->values[op.operands[1]] : op.value;
+          triton::uint512 sign = 0;
+          triton::uint512& r = this->values[index];
+
+          switch (op.type) {
+            case triton::ast::BV_NODE:        r = op.value; break;
+            case triton::ast::VARIABLE_NODE:  r = assignment[op.value.convert_to<triton::usize>()] & op.mask; break;
+            case triton::ast::ASSERT_NODE:    r = a & op.mask; break;
+            case triton::ast::BVADD_NODE:     r = (a + b) & op.mask; break;
+            case triton::ast::BVAND_NODE:     r = a & b; break;
+            case triton::ast::BVMUL_NODE:     r = (a * b) & op.mask; break;
+            case triton::ast::BVNAND_NODE:    r = ~(a & b) & op.mask; break;
+            case triton::ast::BVNEG_NODE:     r = (0 - a) & op.mask; break;
+            case triton::ast::BVNOR_NODE:     r = ~(a | b) & op.mask; break;
+            case triton::ast::BVNOT_NODE:     r = ~a & op.mask; break;
+            case triton::ast::BVOR_NODE:      r = a | b; break;
+            case triton::ast::BVSUB_NODE:     r = (a - b) & op.mask; break;
+            case triton::ast::BVXNOR_NODE:    r = ~(a ^ b) & op.mask; break;
+            case triton::ast::BVXOR_NODE:     r = a ^ b; break;
+            case triton::ast::BVUGE_NODE:     r = (a >= b); break;
+            case triton::ast::BVUGT_NODE:     r = (a > b); break;
+            case triton::ast::BVULE_NODE:     r = (a <= b); break;
+            case triton::ast::BVULT_NODE:     r = (a < b); break;
+            case triton::ast::DISTINCT_NODE:  r = (a != b); break;
+            case triton::ast::EQUAL_NODE:     r = (a == b); break;
+            case triton::ast::EXTRACT_NODE:   r = (a >> op.param) & op.mask; break;
+            case triton::ast::ZX_NODE:        r = a; break;
+            case triton::ast::LNOT_NODE:      r = (a == 0); break;
+            case triton::ast::IFF_NODE:       r = ((a != 0) == (b != 0)); break;
+            case triton::ast::ITE_NODE:       r = (a != 0) ? b : this->values[op.operands[2]]; break;
+
+            case triton::ast::BVSHL_NODE:
+              r = (b >= op.size) ? triton::uint512(0) : triton::uint512((a << b.convert_to<triton::uint32>()) & op.mask);
+              break;
+
+            case triton::ast::BVLSHR_NODE:
+              r = (b >= op.size) ? triton::uint512(0) : triton::uint512(a >> b.convert_to<triton::uint32>());
+              break;
+
+            case triton::ast::BVASHR_NODE:
+              sign = (a >> (op.size - 1)) & 1;
+              if (b >= op.size)
+                r = sign ? op.mask : triton::uint512(0);
+              else {
+                r = a >> b.convert_to<triton::uint32>();
+                if (sign)
+                  r |= (op.mask & ~(op.mask >> b.convert_to<triton::uint32>()));
+              }
+              break;
+
+            case triton::ast::BVROL_NODE:
+              r = (op.param == 0) ? a : triton::uint512(((a << op.param) | (a >> (op.size - op.param))) & op.mask);
+              break;
+
+            case triton::ast::BVROR_NODE:
+              r = (op.param == 0) ? a : triton::uint512(((a >> op.param) | (a << (op.size - op.param))) & op.mask);
+              break;
+
+            case triton::ast::BVUDIV_NODE:
+              r = (b == 0) ? op.mask : triton::uint512(a / b);
+              break;
+
+            case triton::ast::BVUREM_NODE:
+              r = (b == 0) ? a : triton::uint512(a % b);
+              break;
+
+            /* The signed comparisons are unsigned comparisons once the sign bits are flipped */
+            case triton::ast::BVSGE_NODE:
+            case triton::ast::BVSGT_NODE:
+            case triton::ast::BVSLE_NODE:
+            case triton::ast::BVSLT_NODE: {
+              sign = triton::uint512(1) << (this->operations[op.operands[0]].size - 1);
+              triton::uint512 x = a ^ sign;
+              triton::uint512 y = b ^ sign;
+              if (op.type == triton::ast::BVSGE_NODE)      r = (x >= y);
+              else if (op.type == triton::ast::BVSGT_NODE) r = (x > y);
+              else if (op.type == triton::ast::BVSLE_NODE) r = (x <= y);
+              else                                         r = (x < y);
+              break;
+            }
+
+            case triton::ast::BVSDIV_NODE:
+            case triton::ast::BVSMOD_NODE:
+            case triton::ast::BVSREM_NODE: {
+              triton::sint512 x = a.convert_to<triton::sint512>();
+              triton::sint512 y = b.convert_to<triton::sint512>();
+              if ((a >> (op.size - 1)) & 1) { x = -1; x = ((x << op.size) | a.convert_to<triton::sint512>()); }
+              if ((b >> (op.size - 1)) & 1) { y = -1; y = ((y << op.size) | b.convert_to<triton::sint512>()); }
+
+              if (op.type == triton::ast::BVSDIV_NODE) {
+                if (y == 0)
+                  r = (x < 0 ? triton::uint512(1) : op.mask);
+                else
+                  r = (x / y).convert_to<triton::uint512>() & op.mask;
+              }
+              else if (y == 0)
+                r = a;
+              else if (op.type == triton::ast::BVSMOD_NODE)
+                r = (((x % y) + y) % y).convert_to<triton::uint512>() & op.mask;
+              else
+                r = (x - ((x / y) * y)).convert_to<triton::uint512>() & op.mask;
+              break;
+            }
+
+            case triton::ast::SX_NODE:
+              sign = (a >> (this->operations[op.operands[0]].size - 1)) & 1;
+              r = sign ? triton::uint512((a | ~this->operations[op.operands[0]].mask) & op.mask) : a;
+              break;
+
+            case triton::ast::CONCAT_NODE:
+              r = 0;
+              for (triton::usize operand : op.operands)
+                r = (r << this->operations[operand].size) | this->values[operand];
+              break;
+
+            case triton::ast::LAND_NODE:
+              r = 1;
+              for (triton::usize operand : op.operands)
+                r = r && (this->values[operand] != 0);
+              break;
+
+            case triton::ast::LOR_NODE:
+              r = 0;
+              for (triton::usize operand : op.operands)
+                r = r || (this->values[operand] != 0);
+              break;
+
+            default:
+              throw triton::exceptions::SolverEngine("ConstraintEvaluator::run(): Invalid operation.");
+          }
+        }
+      }
+
+
+      /* Branch distance as in Korel's and Angora's search, it is 0 iff the operation has the expected truth value */
+      triton::uint512 ConstraintEvaluator::getDistance(triton::usize index, bool negated) const {
+        const Operation& op = this->operations[index];
+        triton::uint512 a = op.operands.size() > 0 ? this->values[op.operands[0]] : triton::uint512(0);
+        triton::uint512 b = op.operands.size() > 1 ? this->values[op.operands[1]] : triton::uint512(0);
+        triton::ast::ast_e type = op.type;
+
+        switch (type) {
+          case triton::ast::ASSERT_NODE:
+            return this->getDistance(op.operands[0], negated);
+
+          case triton::ast::LNOT_NODE:
+            return this->getDistance(op.operands[0], !negated);
+
+          /* A conjunction sums the distances (saturated), a disjunction takes the smallest one */
+          case triton::ast::LAND_NODE:
+          case triton::ast::LOR_NODE: {
+            bool all = ((type == triton::ast::LAND_NODE) != negated);
+            triton::uint512 ret = all ? triton::uint512(0) : triton::uint512(-1);
+            for (triton::usize operand : op.operands) {
+              triton::uint512 d = this->getDistance(operand, negated);
+              if (all)
+                ret = (ret + d < ret) ? triton::uint512(-1) : triton::uint512(ret + d);
+              else if (d < ret)
+                ret = d;
+            }
+            return ret;
+          }
+
+          case triton::ast::EQUAL_NODE:
+          case triton::ast::DISTINCT_NODE:
+            if ((type == triton::ast::EQUAL_NODE) != negated)
+              return (a > b) ? triton::uint512(a - b) : triton::uint512(b - a);
+            return (a == b) ? 1 : 0;
+
+          /* A signed comparison is an unsigned comparison of the operands with their sign bits flipped */
+          case triton::ast::BVSGE_NODE:
+          case triton::ast::BVSGT_NODE:
+          case triton::ast::BVSLE_NODE:
+          case triton::ast::BVSLT_NODE: {
+            triton::uint512 sign = triton::uint512(1) << (this->operations[op.operands[0]].size - 1);
+            a ^= sign;
+            b ^= sign;
+            if (type == triton::ast::BVSGE_NODE)      type = triton::ast::BVUGE_NODE;
+            else if (type == triton::ast::BVSGT_NODE) type = triton::ast::BVUGT_NODE;
+            else if (type == triton::ast::BVSLE_NODE) type = triton::ast::BVULE_NODE;
+            else                                      type = triton::ast::BVULT_NODE;
+            break;
+          }
+
+          case triton::ast::BVUGE_NODE:
+          case triton::ast::BVUGT_NODE:
+          case triton::ast::BVULE_NODE:
+          case triton::ast::BVULT_NODE:
+            break;
+
+          default:
+            return ((this->values[index] != 0) != negated) ? 0 : 1;
+        }
+
+        /* a > b is b < a, and the negation of a < b is b <= a */
+        if (type == triton::ast::BVUGE_NODE || type == triton::ast::BVUGT_NODE) {
+          std::swap(a, b);
+          type = (type == triton::ast::BVUGE_NODE) ? triton::ast::BVULE_NODE : triton::ast::BVULT_NODE;
+        }
+
+        if (negated) {
+          std::swap(a, b);
+          type = (type == triton::ast::BVULE_NODE) ? triton::ast::BVULT_NODE : triton::ast::BVULE_NODE;
+        }
+
+        if (type == triton::ast::BVULT_NODE)
+          return (a < b) ? triton::uint512(0) : triton::uint512(a - b + 1);
+
+        return (a <= b) ? triton::uint512(0) : triton::uint512(a - b);
+      }
+
+
+      bool ConstraintEvaluator::isSupported(void) const {
+        return this->supported;
+      }
+
+
+      const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& ConstraintEvaluator::getVariables(void) const {
+        return this->variables;
+      }
+
+
+      std::vector<triton::uint512> ConstraintEvaluator::getConcreteAssignment(void) const {
+        std::vector<triton::uint512> assignment;
+        triton::ast::AstContext& astCtxt = this->root->getContext();
+
+        for (const auto& var : this->variables)
+          assignment.push_back(astCtxt.getVariableValue(var->getId()));
+
+        return assignment;
+      }
+
+
+      bool ConstraintEvaluator::evaluate(const std::vector<triton::uint512>& assignment) const {
+        if (!this->supported)
+          throw triton::exceptions::SolverEngine("ConstraintEvaluator::evaluate(): The constraint cannot be evaluated.");
+
+        this->run(assignment);
+        return this->values.back() != 0;
+      }
+
+
+      triton::uint512 ConstraintEvaluator::getValue(const std::vector<triton::uint512>& assignment) const {
+        if (!this->supported)
+          throw triton::exceptions::SolverEngine("ConstraintEvaluator::getValue(): The expression cannot be evaluated.");
+
+        this->run(assignment);
+        return this->values.back();
+      }
+
+
+      triton::uint512 ConstraintEvaluator::getDistance(const std::vector<triton::uint512>& assignment) const {
+        if (!this->supported)
+          throw triton::exceptions::SolverEngine("ConstraintEvaluator::getDistance(): The constraint cannot be evaluated.");
+
+        this->run(assignment);
+        return this->getDistance(this->operations.size() - 1, false);
+      }
+
+    };
+  };
+};
@@ -0,0 +1,596 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <triton/astContext.hpp>
+#include <triton/constraintEvaluator.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/intervalSolver.hpp>
+#include <triton/symbolicExpression.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* Rounds toward -inf */
+      static triton::sint512 floorDiv(const triton::sint512& x, const triton::sint512& y) {
+        triton::sint512 q = x / y;
+        if ((x % y) != 0 && ((x < 0) != (y < 0)))
+          q -= 1;
+        return q;
+      }
+
+
+      /* Rounds toward +inf */
+      static triton::sint512 ceilDiv(const triton::sint512& x, const triton::sint512& y) {
+        triton::sint512 q = x / y;
+        if ((x % y) != 0 && ((x < 0) == (y < 0)))
+          q += 1;
+        return q;
+      }
+
+
+      IntervalSolver::IntervalSolver(triton::usize budget)
+        : budget(budget),
+          nodes(0) {
+      }
+
+
+      bool IntervalSolver::getIndex(const triton::engines::symbolic::SharedSymbolicVariable& var, std::vector<Domain>& domains, triton::usize& index) {
+        auto it = this->indexes.find(var->getId());
+
+        if (it != this->indexes.end()) {
+          index = it->second;
+          return true;
+        }
+
+        if (var->getSize() > 64)
+          return false;
+
+        Domain domain;
+        domain.lo = 0;
+        domain.hi = (triton::sint512(1) << var->getSize()) - 1;
+        if (var->getSize() <= 8)
+          domain.allowed.resize(static_cast<size_t>(1) << var->getSize(), true);
+
+        index = this->variables.size();
+        this->indexes[var->getId()] = index;
+        this->variables.push_back(var);
+        domains.push_back(domain);
+
+        return true;
+      }
+
+
+      /* The shared sub-expressions are translated once, the failures too */
+      bool IntervalSolver::linearize(const triton::ast::SharedAbstractNode& node, std::vector<Domain>& domains, Term& term, triton::uint32 depth) {
+        auto it = this->terms.find(node.get());
+
+        if (it == this->terms.end()) {
+          Term result;
+          bool linear = this->linearizeNode(node, domains, result, depth);
+          it = this->terms.insert(std::make_pair(node.get(), std::make_pair(linear, std::move(result)))).first;
+        }
+
+        if (!it->second.first)
+          return false;
+
+        term = it->second.second;
+        return true;
+      }
+
+
+      /* The term must not wrap around for any value of the variables, its range is checked at each step */
+      bool IntervalSolver::linearizeNode(const triton::ast::SharedAbstractNode& node, std::vector<Domain>& domains, Term& term, triton::uint32 depth) {
+        const auto& children = node->getChildren();
+        triton::sint512 limit = triton::sint512(1) << node->getBitvectorSize();
+        Term other;
+
+        if (depth > 64)
+          return false;
+
+        if (!node->isSymbolized()) {
+          term.coefs.clear();
+          term.constant = node->evaluate().convert_to<triton::sint512>();
+          term.min      = term.constant;
+          term.max      = term.constant;
+          return true;
+        }
+
+        switch (node->getType()) {
+          case triton::ast::REFERENCE_NODE:
+            return this->linearize(reinterpret_cast<triton::ast::ReferenceNode*>(node.get())->getSymbolicExpression()->getAst(), domains, term, depth + 1);
+
+          case triton::ast::VARIABLE_NODE: {
+            triton::usize index = 0;
+            if (!this->getIndex(reinterpret_cast<triton::ast::VariableNode*>(node.get())->getSymbolicVariable(), domains, index))
+              return false;
+            term.coefs.clear();
+            term.coefs[index] = 1;
+            term.constant = 0;
+            term.min      = 0;
+            term.max      = limit - 1;
+            return true;
+          }
+
+          case triton::ast::ZX_NODE:
+            return this->linearize(children[1], domains, term, depth + 1);
+
+          /* Only the extractions which keep the whole value */
+          case triton::ast::EXTRACT_NODE:
+            if (reinterpret_cast<triton::ast::IntegerNode*>(children[1].get())->getInteger() != 0)
+              return false;
+            if (!this->linearize(children[2], domains, term, depth + 1))
+              return false;
+            return term.max < limit;
+
+          /* Only the masks which keep the whole value */
+          case triton::ast::BVAND_NODE: {
+            triton::usize constant = children[0]->isSymbolized() ? 1 : 0;
+            if (children[constant]->isSymbolized())
+              return false;
+            triton::sint512 mask = children[constant]->evaluate().convert_to<triton::sint512>();
+            if ((mask & (mask + 1)) != 0)
+              return false;
+            if (!this->linearize(children[1 - constant], domains, term, depth + 1))
+              return false;
+            return term.max <= mask;
+          }
+
+          case triton::ast::BVADD_NODE:
+          case triton::ast::BVSUB_NODE: {
+            bool sub = (node->getType() == triton::ast::BVSUB_NODE);
+            if (!this->linearize(children[0], domains, term, depth + 1) || !this->linearize(children[1], domains, other, depth + 1))
+              return false;
+            for (const auto& coef : other.coefs) {
+              triton::sint512 value = term.coefs[coef.first] + (sub ? -coef.second : coef.second);
+              if (value == 0)
+                term.coefs.erase(coef.first);
+              else
+                term.coefs[coef.first] = value;
+            }
+            term.constant += sub ? -other.constant : other.constant;
+            term.min      += sub ? -other.max : other.min;
+            term.max      += sub ? -other.min : other.max;
+            return term.min >= 0 && term.max < limit;
+          }
+
+          case triton::ast::BVMUL_NODE:
+          case triton::ast::BVSHL_NODE: {
+            triton::sint512 factor = 0;
+            triton::usize constant = 1;
+            if (node->getType() == triton::ast::BVMUL_NODE && !children[0]->isSymbolized())
+              constant = 0;
+            if (children[constant]->isSymbolized())
+              return false;
+            factor = children[constant]->evaluate().convert_to<triton::sint512>();
+            if (node->getType() == triton::ast::BVSHL_NODE) {
+              if (factor >= node->getBitvectorSize())
+                return false;
+              factor = triton::sint512(1) << factor.convert_to<triton::uint32>();
+            }
+            if (!this->linearize(children[1 - constant], domains, term, depth + 1))
+              return false;
+            for (auto& coef : term.coefs)
+              coef.second *= factor;
+            term.constant *= factor;
+            term.min      *= factor;
+            term.max      *= factor;
+            if (factor == 0)
+              term.coefs.clear();
+            return term.max < limit;
+          }
+
+          /* The parts are shifted into place, this never wraps around */
+          case triton::ast::CONCAT_NODE:
+            term.coefs.clear();
+            term.constant = 0;
+            term.min      = 0;
+            term.max      = 0;
+            for (const auto& child : children) {
+              triton::sint512 factor = triton::sint512(1) << child->getBitvectorSize();
+              if (!this->linearize(child, domains, other, depth + 1))
+                return false;
+              for (auto& coef : term.coefs)
+                coef.second *= factor;
+              for (const auto& coef : other.coefs)
+                term.coefs[coef.first] += coef.second;
+              term.constant = term.constant * factor + other.constant;
+              term.min      = term.min * factor + other.min;
+              term.max      = term.max * factor + other.max;
+            }
+            return true;
+
+          default:
+            return false;
+        }
+      }
+
+
+      bool IntervalSolver::addConstraint(const triton::ast::SharedAbstractNode& node, bool negated, std::vector<Domain>& domains, bool& contradiction) {
+        triton::ast::ast_e type = node->getType();
+        const auto& children = node->getChildren();
+
+        if (!node->isSymbolized()) {
+          if ((node->evaluate() != 0) == negated)
+            contradiction = true;
+          return true;
+        }
+
+        switch (type) {
+          case triton::ast::ASSERT_NODE:
+            return this->addConstraint(children[0], negated, domains, contradiction);
+
+          case triton::ast::REFERENCE_NODE:
+            return this->addConstraint(reinterpret_cast<triton::ast::ReferenceNode*>(node.get())->getSymbolicExpression()->getAst(), negated, domains, contradiction);
+
+          case triton::ast::LNOT_NODE:
+            return this->addConstraint(children[0], !negated, domains, contradiction);
+
+          case triton::ast::LAND_NODE:
+          case triton::ast::LOR_NODE:
+            if ((type == triton::ast::LAND_NODE) == negated)
+              return this->addTable(node, negated, domains, contradiction);
+            for (const auto& child : children) {
+              if (!this->addConstraint(child, negated, domains, contradiction))
+                return false;
+            }
+            return true;
+
+          case triton::ast::EQUAL_NODE:
+          case triton::ast::DISTINCT_NODE:
+          case triton::ast::BVUGE_NODE:
+          case triton::ast::BVUGT_NODE:
+          case triton::ast::BVULE_NODE:
+          case triton::ast::BVULT_NODE:
+          case triton::ast::BVSGE_NODE:
+          case triton::ast::BVSGT_NODE:
+          case triton::ast::BVSLE_NODE:
+          case triton::ast::BVSLT_NODE:
+            break;
+
+          default:
+            return this->addTable(node, negated, domains, contradiction);
+        }
+
+        Term lhs, rhs;
+        if (!this->linearize(children[0], domains, lhs, 0) || !this->linearize(children[1], domains, rhs, 0))
+          return this->addTable(node, negated, domains, contradiction);
+
+        /* A signed comparison is an unsigned one if the sign bits are never set */
+        if (type == triton::ast::BVSGE_NODE || type == triton::ast::BVSGT_NODE || type == triton::ast::BVSLE_NODE || type == triton::ast::BVSLT_NODE) {
+          triton::sint512 sign = triton::sint512(1) << (children[0]->getBitvectorSize() - 1);
+          if (lhs.max >= sign || rhs.max >= sign)
+            return this->addTable(node, negated, domains, contradiction);
+          if (type == triton::ast::BVSGE_NODE)      type = triton::ast::BVUGE_NODE;
+          else if (type == triton::ast::BVSGT_NODE) type = triton::ast::BVUGT_NODE;
+          else if (type == triton::ast::BVSLE_NODE) type = triton::ast::BVULE_NODE;
+          else                                      type = triton::ast::BVULT_NODE;
+        }
+
+        /* Normalizes into x = y, x != y, x < y or x <= y */
+        bool swap = (type == triton::ast::BVUGE_NODE || type == triton::ast::BVUGT_NODE);
+        if (type == triton::ast::BVUGE_NODE) type = triton::ast::BVULE_NODE;
+        if (type == triton::ast::BVUGT_NODE) type = triton::ast::BVULT_NODE;
+
+        if (negated) {
+          switch (type) {
+            case triton::ast::EQUAL_NODE:    type = triton::ast::DISTINCT_NODE; break;
+            case triton::ast::DISTINCT_NODE: type = triton::ast::EQUAL_NODE; break;
+            case triton::ast::BVULT_NODE:    type = triton::ast::BVULE_NODE; swap = !swap; break;
+            default:                         type = triton::ast::BVULT_NODE; swap = !swap; break;
+          }
+        }
+
+        const Term& x = swap ? rhs : lhs;
+        const Term& y = swap ? lhs : rhs;
+
+        Linear linear;
+        linear.coefs    = x.coefs;
+        linear.constant = x.constant - y.constant;
+        linear.op       = (type == triton::ast::BVULT_NODE) ? triton::ast::BVULE_NODE : type;
+        if (type == triton::ast::BVULT_NODE)
+          linear.constant += 1;
+
+        for (const auto& coef : y.coefs) {
+          triton::sint512 value = linear.coefs[coef.first] - coef.second;
+          if (value == 0)
+            linear.coefs.erase(coef.first);
+          else
+            linear.coefs[coef.first] = value;
+        }
+
+        if (linear.coefs.empty()) {
+          if ((linear.op == triton::ast::EQUAL_NODE && linear.constant != 0) ||
+              (linear.op == triton::ast::DISTINCT_NODE && linear.constant == 0) ||
+              (linear.op == triton::ast::BVULE_NODE && linear.constant > 0))
+            contradiction = true;
+          return true;
+        }
+
+        this->constraints.push_back(linear);
+        return true;
+      }
+
+
+      /* Any constraint on a single variable of at most 8 bits is enumerated */
+      bool IntervalSolver::addTable(const triton::ast::SharedAbstractNode& node, bool negated, std::vector<Domain>& domains, bool& contradiction) {
+        ConstraintEvaluator evaluator(node);
+        triton::usize index = 0;
+
+        if (!evaluator.isSupported() || evaluator.getVariables().size() != 1)
+          return false;
+
+        const auto& var = evaluator.getVariables()[0];
+        if (var->getSize() > 8 || !this->getIndex(var, domains, index))
+          return false;
+
+        Domain& domain = domains[index];
+        std::vector<triton::uint512> assignment(1);
+        for (triton::usize value = 0; value < domain.allowed.size(); value++) {
+          if (!domain.allowed[value])
+            continue;
+          assignment[0] = value;
+          if (evaluator.evaluate(assignment) == negated)
+            domain.allowed[value] = false;
+        }
+
+        if (!IntervalSolver::normalize(domain))
+          contradiction = true;
+
+        return true;
+      }
+
+
+      bool IntervalSolver::normalize(Domain& domain) {
+        if (!domain.allowed.empty()) {
+          while (domain.lo <= domain.hi && !domain.allowed[domain.lo.convert_to<size_t>()])
+            domain.lo += 1;
+          while (domain.hi >= domain.lo && !domain.allowed[domain.hi.convert_to<size_t>()])
+            domain.hi -= 1;
+        }
+        return domain.lo <= domain.hi;
+      }
+
+
+      bool IntervalSolver::setMin(Domain& domain, const triton::sint512& value, bool& changed) {
+        if (value > domain.lo) {
+          domain.lo = value;
+          changed = true;
+          return IntervalSolver::normalize(domain);
+        }
+        return domain.lo <= domain.hi;
+      }
+
+
+      bool IntervalSolver::setMax(Domain& domain, const triton::sint512& value, bool& changed) {
+        if (value < domain.hi) {
+          domain.hi = value;
+          changed = true;
+          return IntervalSolver::normalize(domain);
+        }
+        return domain.lo <= domain.hi;
+      }
+
+
+      bool IntervalSolver::remove(Domain& domain, const triton::sint512& value, bool& changed) {
+        if (value < domain.lo || value > domain.hi)
+          return true;
+
+        if (!domain.allowed.empty()) {
+          domain.allowed[value.convert_to<size_t>()] = false;
+          changed = true;
+          return IntervalSolver::normalize(domain);
+        }
+
+        if (value == domain.lo) {
+          domain.lo += 1;
+          changed = true;
+        }
+        else if (value == domain.hi) {
+          domain.hi -= 1;
+          changed = true;
+        }
+
+        return domain.lo <= domain.hi;
+      }
+
+
+      /* Each variable is bounded by the smallest values the other ones can take */
+      bool IntervalSolver::propagateLe(const std::map<triton::usize, triton::sint512>& coefs, const triton::sint512& constant, std::vector<Domain>& domains, bool& changed) const {
+        triton::sint512 minSum = constant;
+
+        for (const auto& coef : coefs)
+          minSum += coef.second * (coef.second > 0 ? domains[coef.first].lo : domains[coef.first].hi);
+
+        if (minSum > 0)
+          return false;
+
+        for (const auto& coef : coefs) {
+          Domain& domain = domains[coef.first];
+          triton::sint512 rest = minSum - coef.second * (coef.second > 0 ? domain.lo : domain.hi);
+          bool ok = (coef.second > 0) ? IntervalSolver::setMax(domain, floorDiv(-rest, coef.second), changed)
+                                      : IntervalSolver::setMin(domain, ceilDiv(-rest, coef.second), changed);
+          if (!ok)
+            return false;
+        }
+
+        return true;
+      }
+
+
+      bool IntervalSolver::propagate(std::vector<Domain>& domains) const {
+        for (triton::uint32 round = 0; round < 64; round++) {
+          bool changed = false;
+
+          for (const auto& linear : this->constraints) {
+            if (linear.op == triton::ast::BVULE_NODE) {
+              if (!this->propagateLe(linear.coefs, linear.constant, domains, changed))
+                return false;
+            }
+
+            else if (linear.op == triton::ast::EQUAL_NODE) {
+              std::map<triton::usize, triton::sint512> opposite;
+              for (const auto& coef : linear.coefs)
+                opposite[coef.first] = -coef.second;
+              if (!this->propagateLe(linear.coefs, linear.constant, domains, changed) || !this->propagateLe(opposite, -linear.constant, domains, changed))
+                return false;
+            }
+
+            /* A disequality only removes a value once all the other variables are fixed */
+            else {
+              triton::sint512 rest = linear.constant;
+              const std::pair<const triton::usize, triton::sint512>* free = nullptr;
+              triton::usize unfixed = 0;
+
+              for (const auto& coef : linear.coefs) {
+                if (domains[coef.first].lo == domains[coef.first].hi)
+                  rest += coef.second * domains[coef.first].lo;
+                else {
+                  free = &coef;
+                  unfixed++;
+                }
+              }
+
+              if (unfixed == 0 && rest == 0)
+                return false;
+
+              if (unfixed == 1 && ((-rest) % free->second) == 0) {
+                if (!IntervalSolver::remove(domains[free->first], (-rest) / free->second, changed))
+                  return false;
+              }
+            }
+          }
+
+          if (!changed)
+            break;
+        }
+
+        return true;
+      }
+
+
+      bool IntervalSolver::check(const std::vector<Domain>& domains) const {
+        for (const auto& linear : this->constraints) {
+          triton::sint512 sum = linear.constant;
+
+          for (const auto& coef : linear.coefs)
+            sum += coef.second * domains[coef.first].lo;
+
+          if ((linear.op == triton::ast::EQUAL_NODE && sum != 0) ||
+              (linear.op == triton::ast::DISTINCT_NODE && sum == 0) ||
+              (linear.op == triton::ast::BVULE_NODE && sum > 0))
+            return false;
+        }
+
+        return true;
+      }
+
+
+      /* Fixes the variable with the smallest domain to its concrete value or to one of its bounds */
+      bool IntervalSolver::search(std::vector<Domain>& domains, const std::vector<triton::uint512>& concrete) {
+        if (this->nodes == 0)
+          return false;
+        this->nodes--;
+
+        if (!this->propagate(domains))
+          return false;
+
+        triton::usize best = domains.size();
+        for (triton::usize index = 0; index < domains.size(); index++) {
+          if (domains[index].lo != domains[index].hi && (best == domains.size() || domains[index].hi - domains[index].lo < domains[best].hi - domains[best].lo))
+            best = index;
+        }
+
+        if (best == domains.size())
+          return this->check(domains);
+
+        std::vector<triton::sint512> candidates;
+        triton::sint512 value = concrete[best].convert_to<triton::sint512>();
+        if (value >= domains[best].lo && value <= domains[best].hi && (domains[best].allowed.empty() || domains[best].allowed[value.convert_to<size_t>()]))
+          candidates.push_back(value);
+        if (value != domains[best].lo)
+          candidates.push_back(domains[best].lo);
+        if (value != domains[best].hi)
+          candidates.push_back(domains[best].hi);
+
+        for (const auto& candidate : candidates) {
+          std::vector<Domain> copy = domains;
+          copy[best].lo = candidate;
+          copy[best].hi = candidate;
+          if (this->search(copy, concrete)) {
+            domains = copy;
+            return true;
+          }
+        }
+
+        return false;
+      }
+
+
+      triton::engines::solver::status_e IntervalSolver::solve(const triton::ast::SharedAbstractNode& node, std::map<triton::uint32, SolverModel>& model) {
+        std::vector<Domain> domains;
+        std::vector<triton::uint512> concrete;
+        bool contradiction = false;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("IntervalSolver::solve(): node cannot be null.");
+
+        this->stats.queries++;
+        this->variables.clear();
+        this->indexes.clear();
+        this->constraints.clear();
+
+        bool linear = this->addConstraint(node, false, domains, contradiction);
+        this->terms.clear();
+        if (!linear)
+          return triton::engines::solver::UNKNOWN;
+
+        if (contradiction || !this->propagate(domains)) {
+          this->stats.unsat++;
+          return triton::engines::solver::UNSAT;
+        }
+
+        triton::ast::AstContext& astCtxt = node->getContext();
+        for (const auto& var : this->variables)
+          concrete.push_back(astCtxt.getVariableValue(var->getId()));
+
+        this->nodes = this->budget;
+        if (!this->search(domains, concrete))
+          return triton::engines::solver::UNKNOWN;
+
+        /* The model is checked against the query itself */
+        ConstraintEvaluator evaluator(node);
+        if (evaluator.isSupported()) {
+          std::vector<triton::uint512> assignment;
+          for (const auto& var : evaluator.getVariables()) {
+            auto it = this->indexes.find(var->getId());
+            if (it == this->indexes.end())
+              return triton::engines::solver::UNKNOWN;
+            assignment.push_back(domains[it->second].lo.convert_to<triton::uint512>());
+          }
+          if (!evaluator.evaluate(assignment))
+            return triton::engines::solver::UNKNOWN;
+        }
+
+        model.clear();
+        for (triton::usize index = 0; index < this->variables.size(); index++)
+          model[static_cast<triton::uint32>(this->variables[index]->getId())] = SolverModel(this->variables[index], domains[index].lo.convert_to<triton::uint512>());
+
+        this->stats.sat++;
+        return triton::engines::solver::SAT;
+      }
+
+
+      const IntervalSolverStatistics& IntervalSolver::getStatistics(void) const {
+        return this->stats;
+      }
+
+    };
+  };
+};
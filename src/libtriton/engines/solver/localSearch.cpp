@@ -0,0 +1,131 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <vector>
+
+#include <triton/constraintEvaluator.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/localSearch.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      LocalSearch::LocalSearch(triton::usize budget)
+        : budget(budget),
+          random(0) {
+      }
+
+
+      bool LocalSearch::solve(const triton::ast::SharedAbstractNode& node, std::map<triton::uint32, SolverModel>& model) {
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("LocalSearch::solve(): node cannot be null.");
+
+        ConstraintEvaluator evaluator(node);
+        const auto& variables = evaluator.getVariables();
+
+        if (!evaluator.isSupported() || variables.empty())
+          return false;
+
+        this->stats.queries++;
+
+        std::vector<triton::uint512> masks;
+        for (const auto& var : variables)
+          masks.push_back((triton::uint512(1) << var->getSize()) - 1);
+
+        std::vector<triton::uint512> current = evaluator.getConcreteAssignment();
+        std::vector<triton::uint512> candidate;
+        triton::usize evaluations = 1;
+        triton::uint512 best = evaluator.getDistance(current);
+
+        /* Evaluates the candidate and keeps it if it is closer */
+        auto tryCandidate = [&](void) {
+          evaluations++;
+          triton::uint512 distance = evaluator.getDistance(candidate);
+          if (distance < best) {
+            best    = distance;
+            current = candidate;
+            return true;
+          }
+          return false;
+        };
+
+        while (best != 0 && evaluations < this->budget) {
+          bool improved = false;
+
+          for (triton::usize index = 0; index < variables.size() && best != 0 && evaluations < this->budget; index++) {
+            bool moved = false;
+
+            /* Gradient step, doubled as long as it gets closer */
+            for (triton::sint32 direction : {1, -1}) {
+              triton::uint512 step = 1;
+              while (best != 0 && evaluations < this->budget && step <= masks[index]) {
+                candidate = current;
+                candidate[index] = (direction > 0 ? triton::uint512(current[index] + step) : triton::uint512(current[index] - step)) & masks[index];
+                if (!tryCandidate())
+                  break;
+                moved = true;
+                step <<= 1;
+              }
+              if (moved)
+                break;
+            }
+
+            /* Bit flips */
+            for (triton::uint32 bit = 0; !moved && bit < variables[index]->getSize() && best != 0 && evaluations < this->budget; bit++) {
+              candidate = current;
+              candidate[index] ^= (triton::uint512(1) << bit);
+              moved = tryCandidate();
+            }
+
+            improved |= moved;
+          }
+
+          /* Stuck, restarts a random variable */
+          if (!improved && best != 0 && evaluations < this->budget) {
+            triton::usize index = this->random() % variables.size();
+            triton::uint512 value = 0;
+            for (triton::uint32 bits = 0; bits < variables[index]->getSize(); bits += 32)
+              value = (value << 32) | this->random();
+            current[index] = value & masks[index];
+            evaluations++;
+            best = evaluator.getDistance(current);
+          }
+        }
+
+        this->stats.evaluations += evaluations;
+        if (best != 0)
+          return false;
+
+        this->stats.solved++;
+        model.clear();
+        for (triton::usize index = 0; index < variables.size(); index++)
+          model[static_cast<triton::uint32>(variables[index]->getId())] = SolverModel(variables[index], current[index]);
+
+        return true;
+      }
+
+
+      void LocalSearch::setBudget(triton::usize budget) {
+        this->budget = budget;
+      }
+
+
+      triton::usize LocalSearch::getBudget(void) const {
+        return this->budget;
+      }
+
+
+      const LocalSearchStatistics& LocalSearch::getStatistics(void) const {
+        return this->stats;
+      }
+
+    };
+  };
+};
@@ -0,0 +1,114 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <vector>
+
+#include <triton/constraintEvaluator.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/modelPool.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      ModelPool::ModelPool(triton::usize capacity)
+        : capacity(capacity) {
+      }
+
+
+      bool ModelPool::lookup(const triton::ast::SharedAbstractNode& node, std::map<triton::uint32, SolverModel>& model) {
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("ModelPool::lookup(): node cannot be null.");
+
+        ConstraintEvaluator evaluator(node);
+        const auto& variables = evaluator.getVariables();
+
+        if (!evaluator.isSupported())
+          return false;
+
+        this->stats.queries++;
+
+        std::vector<triton::uint512> concrete = evaluator.getConcreteAssignment();
+        std::vector<triton::uint512> assignment;
+        bool found = evaluator.evaluate(concrete);
+
+        if (found) {
+          assignment = concrete;
+          this->stats.concreteHits++;
+        }
+
+        for (auto it = this->models.begin(); !found && it != this->models.end(); it++) {
+          assignment = concrete;
+          bool covers = false;
+          for (triton::usize index = 0; index < variables.size(); index++) {
+            auto value = it->find(variables[index]->getId());
+            if (value != it->end()) {
+              assignment[index] = value->second;
+              covers = true;
+            }
+          }
+
+          /* A model which does not share any variable with the query is the concrete assignment */
+          if (covers && evaluator.evaluate(assignment)) {
+            found = true;
+            this->models.splice(this->models.begin(), this->models, it);
+            this->stats.poolHits++;
+          }
+        }
+
+        if (!found)
+          return false;
+
+        model.clear();
+        for (triton::usize index = 0; index < variables.size(); index++)
+          model[static_cast<triton::uint32>(variables[index]->getId())] = SolverModel(variables[index], assignment[index]);
+
+        return true;
+      }
+
+
+      void ModelPool::insert(const std::map<triton::uint32, SolverModel>& model) {
+        std::map<triton::usize, triton::uint512> values;
+
+        if (this->capacity == 0 || model.empty())
+          return;
+
+        for (const auto& item : model)
+          values[item.first] = item.second.getValue();
+
+        this->models.push_front(values);
+        while (this->models.size() > this->capacity)
+          this->models.pop_back();
+      }
+
+
+      void ModelPool::setCapacity(triton::usize capacity) {
+        this->capacity = capacity;
+        while (this->models.size() > this->capacity)
+          this->models.pop_back();
+      }
+
+
+      triton::usize ModelPool::getCapacity(void) const {
+        return this->capacity;
+      }
+
+
+      const ModelPoolStatistics& ModelPool::getStatistics(void) const {
+        return this->stats;
+      }
+
+
+      void ModelPool::clear(void) {
+        this->models.clear();
+      }
+
+    };
+  };
+};
@@ -0,0 +1,135 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <unordered_set>
+
+#include <triton/exceptions.hpp>
+#include <triton/pathVariablesIndex.hpp>
+#include <triton/symbolicVariable.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      void PathVariablesIndex::sync(const std::vector<triton::engines::symbolic::PathConstraint>& path, triton::usize count) {
+        triton::usize common = 0;
+
+        if (count > path.size())
+          throw triton::exceptions::SolverEngine("PathVariablesIndex::sync(): Out of range.");
+
+        while (common < this->constraints.size() && common < count && this->constraints[common] == path[common].getTakenPathConstraintAst())
+          common++;
+
+        if (common == count)
+          return;
+
+        this->truncate(common);
+
+        for (triton::usize index = common; index < count; index++) {
+          triton::ast::SharedAbstractNode node = path[index].getTakenPathConstraintAst();
+          std::vector<triton::usize> ids;
+
+          for (const auto& var : triton::ast::lookingForNodes(node, triton::ast::VARIABLE_NODE)) {
+            triton::usize id = reinterpret_cast<triton::ast::VariableNode*>(var.get())->getSymbolicVariable()->getId();
+            std::vector<triton::usize>& owners = this->owners[id];
+            if (owners.empty() || owners.back() != index) {
+              owners.push_back(index);
+              ids.push_back(id);
+            }
+          }
+
+          this->constraints.push_back(node);
+          this->variables.push_back(std::move(ids));
+        }
+      }
+
+
+      /* The last constraints are the last owners of their variables */
+      void PathVariablesIndex::truncate(triton::usize count) {
+        for (triton::usize index = this->constraints.size(); index > count; index--) {
+          for (triton::usize id : this->variables[index - 1]) {
+            auto it = this->owners.find(id);
+            it->second.pop_back();
+            if (it->second.empty())
+              this->owners.erase(it);
+          }
+        }
+
+        this->constraints.resize(std::min(count, this->constraints.size()));
+        this->variables.resize(this->constraints.size());
+      }
+
+
+      /* Only the related constraints are walked, the others are only evaluated (their value is cached by the nodes) */
+      bool PathVariablesIndex::getRelatedConstraints(triton::usize count, const triton::ast::SharedAbstractNode& query, std::vector<triton::ast::SharedAbstractNode>& related) const {
+        std::unordered_set<triton::usize> seen;
+        std::unordered_set<triton::usize> marked;
+        std::vector<triton::usize> pending;
+        std::vector<triton::usize> indexes;
+
+        if (query == nullptr)
+          throw triton::exceptions::SolverEngine("PathVariablesIndex::getRelatedConstraints(): node cannot be null.");
+
+        if (count > this->constraints.size())
+          throw triton::exceptions::SolverEngine("PathVariablesIndex::getRelatedConstraints(): Out of range.");
+
+        for (const auto& var : triton::ast::lookingForNodes(query, triton::ast::VARIABLE_NODE)) {
+          triton::usize id = reinterpret_cast<triton::ast::VariableNode*>(var.get())->getSymbolicVariable()->getId();
+          if (seen.insert(id).second)
+            pending.push_back(id);
+        }
+
+        while (!pending.empty()) {
+          auto it = this->owners.find(pending.back());
+          pending.pop_back();
+          if (it == this->owners.end())
+            continue;
+
+          for (triton::usize index : it->second) {
+            if (index >= count)
+              break;
+            if (!marked.insert(index).second)
+              continue;
+            indexes.push_back(index);
+            for (triton::usize id : this->variables[index]) {
+              if (seen.insert(id).second)
+                pending.push_back(id);
+            }
+          }
+        }
+
+        /* The other constraints keep their concrete values */
+        for (triton::usize index = 0; index < count; index++) {
+          if (this->constraints[index]->evaluate() == 0 && marked.find(index) == marked.end())
+            return false;
+        }
+
+        std::sort(indexes.begin(), indexes.end());
+        for (triton::usize index : indexes)
+          related.push_back(this->constraints[index]);
+
+        return true;
+      }
+
+
+      triton::usize PathVariablesIndex::size(void) const {
+        return this->constraints.size();
+      }
+
+
+      void PathVariablesIndex::clear(void) {
+        this->constraints.clear();
+        this->variables.clear();
+        this->owners.clear();
+      }
+
+    };
+  };
+};
@@ -0,0 +1,468 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <set>
+
+#include <triton/astContext.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/queryPreprocessor.hpp>
+#include <triton/solverCache.hpp>
+#include <triton/symbolicExpression.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      QueryPreprocessor::QueryPreprocessor() {
+      }
+
+
+      /* The zero extensions and the full extractions keep the value of the variable */
+      triton::engines::symbolic::SharedSymbolicVariable QueryPreprocessor::getVariable(const triton::ast::SharedAbstractNode& node, triton::uint32& size) {
+        triton::ast::SharedAbstractNode current = node;
+
+        size = node->getBitvectorSize();
+        while (true) {
+          const auto& children = current->getChildren();
+          switch (current->getType()) {
+            case triton::ast::REFERENCE_NODE:
+              current = reinterpret_cast<triton::ast::ReferenceNode*>(current.get())->getSymbolicExpression()->getAst();
+              break;
+
+            case triton::ast::ZX_NODE:
+              current = children[1];
+              break;
+
+            case triton::ast::EXTRACT_NODE:
+              if (reinterpret_cast<triton::ast::IntegerNode*>(children[1].get())->getInteger() != 0 || current->getBitvectorSize() != children[2]->getBitvectorSize())
+                return nullptr;
+              current = children[2];
+              break;
+
+            case triton::ast::VARIABLE_NODE:
+              return reinterpret_cast<triton::ast::VariableNode*>(current.get())->getSymbolicVariable();
+
+            default:
+              return nullptr;
+          }
+        }
+      }
+
+
+      bool QueryPreprocessor::getBound(const triton::ast::SharedAbstractNode& node, Bound& bound) {
+        triton::ast::ast_e type = node->getType();
+        const auto& children = node->getChildren();
+        triton::uint32 size = 0;
+        triton::usize var = 0;
+
+        switch (type) {
+          case triton::ast::BVUGE_NODE:
+          case triton::ast::BVUGT_NODE:
+          case triton::ast::BVULE_NODE:
+          case triton::ast::BVULT_NODE:
+          case triton::ast::EQUAL_NODE:
+            break;
+          default:
+            return false;
+        }
+
+        if (children[0]->isSymbolized() == children[1]->isSymbolized())
+          return false;
+
+        /* Mirrors `c op x` into `x op' c` */
+        var = children[0]->isSymbolized() ? 0 : 1;
+        if (var == 1) {
+          switch (type) {
+            case triton::ast::BVUGE_NODE: type = triton::ast::BVULE_NODE; break;
+            case triton::ast::BVUGT_NODE: type = triton::ast::BVULT_NODE; break;
+            case triton::ast::BVULE_NODE: type = triton::ast::BVUGE_NODE; break;
+            case triton::ast::BVULT_NODE: type = triton::ast::BVUGT_NODE; break;
+            default: break;
+          }
+        }
+
+        bound.variable = QueryPreprocessor::getVariable(children[var], size);
+        if (bound.variable == nullptr)
+          return false;
+
+        triton::uint512 constant = children[1 - var]->evaluate();
+        triton::uint512 max      = (triton::uint512(1) << size) - 1;
+
+        bound.lo = 0;
+        bound.hi = max;
+        switch (type) {
+          case triton::ast::BVUGE_NODE: bound.lo = constant; break;
+          case triton::ast::BVUGT_NODE: bound.lo = constant + 1; break;
+          case triton::ast::BVULE_NODE: bound.hi = constant; break;
+          case triton::ast::BVULT_NODE:
+            /* Nothing is lower than 0 */
+            if (constant == 0) {
+              bound.lo = 1;
+              bound.hi = 0;
+            }
+            else
+              bound.hi = constant - 1;
+            break;
+          default:
+            bound.lo = constant;
+            bound.hi = constant;
+            break;
+        }
+
+        /* The range of the variable itself */
+        triton::uint512 width = (triton::uint512(1) << bound.variable->getSize()) - 1;
+        if (bound.hi > width)
+          bound.hi = width;
+
+        return true;
+      }
+
+
+      void QueryPreprocessor::split(const triton::ast::SharedAbstractNode& node, std::vector<triton::ast::SharedAbstractNode>& conjuncts) {
+        std::vector<triton::ast::SharedAbstractNode> worklist;
+
+        if (node->getType() == triton::ast::ASSERT_NODE)
+          worklist.push_back(node->getChildren()[0]);
+        else
+          worklist.push_back(node);
+
+        while (!worklist.empty()) {
+          triton::ast::SharedAbstractNode current = worklist.back();
+          worklist.pop_back();
+
+          if (current->getType() == triton::ast::REFERENCE_NODE) {
+            const auto& ast = reinterpret_cast<triton::ast::ReferenceNode*>(current.get())->getSymbolicExpression()->getAst();
+            if (ast->getType() == triton::ast::LAND_NODE)
+              current = ast;
+          }
+
+          if (current->getType() == triton::ast::LAND_NODE) {
+            const auto& children = current->getChildren();
+            worklist.insert(worklist.end(), children.rbegin(), children.rend());
+          }
+          else
+            conjuncts.push_back(current);
+        }
+      }
+
+
+      /* Post-order walk, the shared nodes are rewritten once and the unchanged sub-trees are kept as they are */
+      triton::ast::SharedAbstractNode QueryPreprocessor::substitute(const triton::ast::SharedAbstractNode& node, const std::map<triton::usize, triton::ast::SharedAbstractNode>& values, std::unordered_map<const triton::ast::AbstractNode*, triton::ast::SharedAbstractNode>& rewritten) {
+        std::vector<std::pair<triton::ast::SharedAbstractNode, bool>> worklist;
+
+        worklist.push_back(std::make_pair(node, false));
+        while (!worklist.empty()) {
+          triton::ast::SharedAbstractNode current = worklist.back().first;
+          bool expanded = worklist.back().second;
+
+          if (rewritten.find(current.get()) != rewritten.end()) {
+            worklist.pop_back();
+            continue;
+          }
+
+          if (!current->isSymbolized()) {
+            rewritten[current.get()] = current;
+            worklist.pop_back();
+            continue;
+          }
+
+          switch (current->getType()) {
+            case triton::ast::VARIABLE_NODE: {
+              auto it = values.find(reinterpret_cast<triton::ast::VariableNode*>(current.get())->getSymbolicVariable()->getId());
+              rewritten[current.get()] = (it != values.end()) ? it->second : current;
+              worklist.pop_back();
+              continue;
+            }
+
+            /* A reference is kept unless the AST of its expression changes */
+            case triton::ast::REFERENCE_NODE: {
+              const auto& ast = reinterpret_cast<triton::ast::ReferenceNode*>(current.get())->getSymbolicExpression()->getAst();
+              auto it = rewritten.find(ast.get());
+              if (it != rewritten.end()) {
+                rewritten[current.get()] = (it->second == ast) ? current : it->second;
+                worklist.pop_back();
+              }
+              else
+                worklist.push_back(std::make_pair(ast, false));
+              continue;
+            }
+
+            case triton::ast::ASSERT_NODE:
+            case triton::ast::COMPOUND_NODE:
+            case triton::ast::DECLARE_NODE:
+            case triton::ast::LET_NODE:
+            case triton::ast::STRING_NODE:
+              return nullptr;
+
+            default:
+              break;
+          }
+
+          const auto& children = current->getChildren();
+          if (!expanded) {
+            worklist.back().second = true;
+            for (auto it = children.rbegin(); it != children.rend(); it++)
+              worklist.push_back(std::make_pair(*it, false));
+            continue;
+          }
+
+          std::vector<triton::ast::SharedAbstractNode> operands;
+          bool changed = false;
+          for (const auto& child : children) {
+            operands.push_back(rewritten.at(child.get()));
+            changed |= (operands.back() != child);
+          }
+
+          triton::ast::SharedAbstractNode result = changed ? QueryPreprocessor::rebuild(current, operands) : current;
+          if (result == nullptr)
+            return nullptr;
+
+          rewritten[current.get()] = result;
+          worklist.pop_back();
+        }
+
+        return rewritten.at(node.get());
+      }
+
+
+      triton::ast::SharedAbstractNode QueryPreprocessor::rebuild(const triton::ast::SharedAbstractNode& node, const std::vector<triton::ast::SharedAbstractNode>& children) {
+        triton::ast::AstContext& ctxt = node->getContext();
+
+        switch (node->getType()) {
+          case triton::ast::BVADD_NODE:    return ctxt.bvadd(children[0], children[1]);
+          case triton::ast::BVAND_NODE:    return ctxt.bvand(children[0], children[1]);
+          case triton::ast::BVASHR_NODE:   return ctxt.bvashr(children[0], children[1]);
+          case triton::ast::BVLSHR_NODE:   return ctxt.bvlshr(children[0], children[1]);
+          case triton::ast::BVMUL_NODE:    return ctxt.bvmul(children[0], children[1]);
+          case triton::ast::BVNAND_NODE:   return ctxt.bvnand(children[0], children[1]);
+          case triton::ast::BVNEG_NODE:    return ctxt.bvneg(children[0]);
+          case triton::ast::BVNOR_NODE:    return ctxt.bvnor(children[0], children[1]);
+          case triton::ast::BVNOT_NODE:    return ctxt.bvnot(children[0]);
+          case triton::ast::BVOR_NODE:     return ctxt.bvor(children[0], children[1]);
+          case triton::ast::BVROL_NODE:    return ctxt.bvrol(children[0], reinterpret_cast<triton::ast::IntegerNode*>(children[1].get())->getInteger().convert_to<triton::uint32>());
+          case triton::ast::BVROR_NODE:    return ctxt.bvror(children[0], reinterpret_cast<triton::ast::IntegerNode*>(children[1].get())->getInteger().convert_to<triton::uint32>());
+          case triton::ast::BVSDIV_NODE:   return ctxt.bvsdiv(children[0], children[1]);
+          case triton::ast::BVSGE_NODE:    return ctxt.bvsge(children[0], children[1]);
+          case triton::ast::BVSGT_NODE:    return ctxt.bvsgt(children[0], children[1]);
+          case triton::ast::BVSHL_NODE:    return ctxt.bvshl(children[0], children[1]);
+          case triton::ast::BVSLE_NODE:    return ctxt.bvsle(children[0], children[1]);
+          case triton::ast::BVSLT_NODE:    return ctxt.bvslt(children[0], children[1]);
+          case triton::ast::BVSMOD_NODE:   return ctxt.bvsmod(children[0], children[1]);
+          case triton::ast::BVSREM_NODE:   return ctxt.bvsrem(children[0], children[1]);
+          case triton::ast::BVSUB_NODE:    return ctxt.bvsub(children[0], children[1]);
+          case triton::ast::BVUDIV_NODE:   return ctxt.bvudiv(children[0], children[1]);
+          case triton::ast::BVUGE_NODE:    return ctxt.bvuge(children[0], children[1]);
+          case triton::ast::BVUGT_NODE:    return ctxt.bvugt(children[0], children[1]);
+          case triton::ast::BVULE_NODE:    return ctxt.bvule(children[0], children[1]);
+          case triton::ast::BVULT_NODE:    return ctxt.bvult(children[0], children[1]);
+          case triton::ast::BVUREM_NODE:   return ctxt.bvurem(children[0], children[1]);
+          case triton::ast::BVXNOR_NODE:   return ctxt.bvxnor(children[0], children[1]);
+          case triton::ast::BVXOR_NODE:    return ctxt.bvxor(children[0], children[1]);
+          case triton::ast::CONCAT_NODE:   return ctxt.concat(children);
+          case triton::ast::DISTINCT_NODE: return ctxt.distinct(children[0], children[1]);
+          case triton::ast::EQUAL_NODE:    return ctxt.equal(children[0], children[1]);
+          case triton::ast::IFF_NODE:      return ctxt.iff(children[0], children[1]);
+          case triton::ast::ITE_NODE:      return ctxt.ite(children[0], children[1], children[2]);
+          case triton::ast::LAND_NODE:     return ctxt.land(children);
+          case triton::ast::LNOT_NODE:     return ctxt.lnot(children[0]);
+          case triton::ast::LOR_NODE:      return ctxt.lor(children);
+
+          case triton::ast::EXTRACT_NODE:
+            return ctxt.extract(reinterpret_cast<triton::ast::IntegerNode*>(children[0].get())->getInteger().convert_to<triton::uint32>(),
+                                reinterpret_cast<triton::ast::IntegerNode*>(children[1].get())->getInteger().convert_to<triton::uint32>(),
+                                children[2]);
+
+          case triton::ast::SX_NODE:
+            return ctxt.sx(reinterpret_cast<triton::ast::IntegerNode*>(children[0].get())->getInteger().convert_to<triton::uint32>(), children[1]);
+
+          case triton::ast::ZX_NODE:
+            return ctxt.zx(reinterpret_cast<triton::ast::IntegerNode*>(children[0].get())->getInteger().convert_to<triton::uint32>(), children[1]);
+
+          default:
+            return nullptr;
+        }
+      }
+
+
+      triton::engines::solver::status_e QueryPreprocessor::process(const triton::ast::SharedAbstractNode& node, triton::ast::SharedAbstractNode& query, std::map<triton::uint32, SolverModel>& solved) {
+        std::vector<triton::ast::SharedAbstractNode> conjuncts;
+        std::map<triton::usize, triton::ast::SharedAbstractNode> values;
+        bool changed = false;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("QueryPreprocessor::process(): node cannot be null.");
+
+        triton::ast::AstContext& ctxt = node->getContext();
+
+        this->stats.queries++;
+        solved.clear();
+        QueryPreprocessor::split(node, conjuncts);
+
+        /* Each round fixes at least one new variable */
+        while (true) {
+          std::vector<triton::ast::SharedAbstractNode> next;
+          std::set<ConstraintHash> seen;
+
+          /* Folds the constant constraints and removes the duplicates */
+          for (const auto& conjunct : conjuncts) {
+            bool hasVariables = false;
+
+            if (!conjunct->isSymbolized()) {
+              if (conjunct->evaluate() == 0) {
+                this->stats.answered++;
+                return triton::engines::solver::UNSAT;
+              }
+              changed = true;
+              continue;
+            }
+
+            if (!seen.insert(SolverCache::hashConstraint(conjunct, hasVariables)).second) {
+              this->stats.duplicates++;
+              changed = true;
+              continue;
+            }
+
+            next.push_back(conjunct);
+          }
+
+          /* Intersects the bounds of each variable */
+          std::map<triton::usize, Bound> ranges;
+          for (const auto& conjunct : next) {
+            Bound bound;
+            if (!QueryPreprocessor::getBound(conjunct, bound))
+              continue;
+
+            auto it = ranges.find(bound.variable->getId());
+            if (it == ranges.end()) {
+              ranges[bound.variable->getId()] = bound;
+              continue;
+            }
+
+            if (bound.lo > it->second.lo) it->second.lo = bound.lo;
+            if (bound.hi < it->second.hi) it->second.hi = bound.hi;
+          }
+
+          std::map<triton::usize, triton::ast::SharedAbstractNode> fixed;
+          for (const auto& range : ranges) {
+            if (range.second.lo > range.second.hi) {
+              this->stats.answered++;
+              return triton::engines::solver::UNSAT;
+            }
+
+            /* An equality kept for a constraint which cannot be rewritten fixes its variable again */
+            if (range.second.lo == range.second.hi && values.find(range.first) == values.end()) {
+              const auto& var = range.second.variable;
+              fixed[range.first] = ctxt.bv(range.second.lo, var->getSize());
+              values[range.first] = fixed[range.first];
+              solved[static_cast<triton::uint32>(range.first)] = SolverModel(var, range.second.lo);
+              this->stats.substitutions++;
+            }
+          }
+
+          conjuncts = next;
+          if (fixed.empty())
+            break;
+
+          /* Replaces the fixed variables, their bounds become constant and are folded by the next round */
+          std::unordered_map<const triton::ast::AbstractNode*, triton::ast::SharedAbstractNode> rewritten;
+          bool pinned = false;
+          for (auto& conjunct : conjuncts) {
+            triton::ast::SharedAbstractNode result = QueryPreprocessor::substitute(conjunct, fixed, rewritten);
+            if (result == nullptr)
+              pinned = true;
+            else
+              conjunct = result;
+          }
+
+          if (pinned) {
+            for (const auto& item : fixed)
+              conjuncts.push_back(ctxt.equal(ctxt.variable(solved.at(static_cast<triton::uint32>(item.first)).getVariable()), item.second));
+          }
+
+          changed = true;
+        }
+
+        /* Keeps only the strongest lower and upper bounds of each variable, a bound on the whole range of the variable is always true */
+        std::map<triton::usize, Bound> ranges;
+        std::vector<Bound> bounds(conjuncts.size());
+        std::vector<bool> isBound(conjuncts.size());
+        for (triton::usize index = 0; index < conjuncts.size(); index++) {
+          isBound[index] = QueryPreprocessor::getBound(conjuncts[index], bounds[index]) && values.find(bounds[index].variable->getId()) == values.end();
+          if (!isBound[index])
+            continue;
+
+          auto it = ranges.find(bounds[index].variable->getId());
+          if (it == ranges.end()) {
+            ranges[bounds[index].variable->getId()] = bounds[index];
+            continue;
+          }
+
+          if (bounds[index].lo > it->second.lo) it->second.lo = bounds[index].lo;
+          if (bounds[index].hi < it->second.hi) it->second.hi = bounds[index].hi;
+        }
+
+        std::vector<triton::ast::SharedAbstractNode> kept;
+        std::set<triton::usize> lower;
+        std::set<triton::usize> upper;
+        for (triton::usize index = 0; index < conjuncts.size(); index++) {
+          if (!isBound[index]) {
+            kept.push_back(conjuncts[index]);
+            continue;
+          }
+
+          triton::usize id = bounds[index].variable->getId();
+          const Bound& range = ranges.at(id);
+          triton::uint512 width = (triton::uint512(1) << bounds[index].variable->getSize()) - 1;
+          bool keep = false;
+
+          if (range.lo > 0 && bounds[index].lo == range.lo && lower.insert(id).second)
+            keep = true;
+
+          if (range.hi < width && bounds[index].hi == range.hi && upper.insert(id).second)
+            keep = true;
+
+          if (keep)
+            kept.push_back(conjuncts[index]);
+          else {
+            this->stats.implied++;
+            changed = true;
+          }
+        }
+
+        /* The variables which are not fixed are free, they keep their concrete value */
+        if (kept.empty()) {
+          for (const auto& var : triton::ast::lookingForNodes(node, triton::ast::VARIABLE_NODE)) {
+            const auto& symVar = reinterpret_cast<triton::ast::VariableNode*>(var.get())->getSymbolicVariable();
+            triton::uint32 id = static_cast<triton::uint32>(symVar->getId());
+            if (solved.find(id) == solved.end())
+              solved[id] = SolverModel(symVar, ctxt.getVariableValue(symVar->getId()));
+          }
+          this->stats.answered++;
+          query = nullptr;
+          return triton::engines::solver::SAT;
+        }
+
+        if (!changed)
+          query = node;
+        else if (kept.size() == 1)
+          query = kept.front();
+        else
+          query = ctxt.land(kept);
+
+        return triton::engines::solver::UNKNOWN;
+      }
+
+
+      const QueryPreprocessorStatistics& QueryPreprocessor::getStatistics(void) const {
+        return this->stats;
+      }
+
+    };
+  };
+};
@@ -0,0 +1,545 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cctype>
+#include <cerrno>
+#include <climits>
+#include <sstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+  #include <fcntl.h>
+  #include <poll.h>
+  #include <signal.h>
+  #include <sys/resource.h>
+  #include <sys/socket.h>
+  #include <sys/types.h>
+  #include <sys/wait.h>
+  #include <unistd.h>
+#endif
+
+#include <triton/astContext.hpp>
+#include <triton/astSmtRepresentation.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/smtLibSolver.hpp>
+#include <triton/solverRecorder.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      SmtLibSolver::SmtLibSolver(const std::vector<std::string>& command)
+        : command(command),
+          pid(-1),
+          channel(-1),
+          memory(0),
+          interrupted(false) {
+        if (command.empty() || command[0].empty())
+          throw triton::exceptions::SolverEngine("SmtLibSolver::SmtLibSolver(): The command cannot be empty.");
+
+        #if !defined(__unix__) && !defined(__APPLE__)
+        throw triton::exceptions::SolverEngine("SmtLibSolver::SmtLibSolver(): Not supported on this platform.");
+        #endif
+      }
+
+
+      SmtLibSolver::~SmtLibSolver() {
+        this->stop();
+      }
+
+
+      void SmtLibSolver::start(const SolverLimits& limits) const {
+        #if defined(__unix__) || defined(__APPLE__)
+        if (this->pid >= 0 && this->memory == limits.memory)
+          return;
+
+        this->stop();
+
+        int sockets[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) != 0)
+          throw triton::exceptions::SolverEngine("SmtLibSolver::start(): Cannot create the channel.");
+
+        /* Our end is not inherited by the solvers started later and a dead solver does not raise SIGPIPE */
+        fcntl(sockets[0], F_SETFD, FD_CLOEXEC);
+        #if defined(__APPLE__)
+        int on = 1;
+        setsockopt(sockets[0], SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+        #endif
+
+        std::vector<char*> argv;
+        for (const auto& arg : this->command)
+          argv.push_back(const_cast<char*>(arg.c_str()));
+        argv.push_back(nullptr);
+
+        pid_t child = fork();
+        if (child < 0) {
+          close(sockets[0]);
+          close(sockets[1]);
+          throw triton::exceptions::SolverEngine("SmtLibSolver::start(): Cannot start the solver.");
+        }
+
+        /* Only async-signal-safe calls in the child */
+        if (child == 0) {
+          dup2(sockets[1], STDIN_FILENO);
+          dup2(sockets[1], STDOUT_FILENO);
+          close(sockets[0]);
+          close(sockets[1]);
+          if (limits.memory) {
+            struct rlimit limit;
+            limit.rlim_cur = static_cast<rlim_t>(limits.memory) << 20;
+            limit.rlim_max = static_cast<rlim_t>(limits.memory) << 20;
+            setrlimit(RLIMIT_AS, &limit);
+          }
+          execvp(argv[0], argv.data());
+          _exit(127);
+        }
+
+        close(sockets[1]);
+        this->channel = sockets[0];
+        this->pid     = child;
+        this->memory  = limits.memory;
+        this->pending.clear();
+
+        /* The name of the solver is asked to check that it runs and speaks SMT-LIB */
+        std::string answer;
+        this->send("(set-option :print-success false)\n(set-option :produce-models true)\n(get-info :name)\n");
+        if (this->read(answer, std::chrono::steady_clock::now() + std::chrono::seconds(10)) != triton::engines::solver::SAT || answer.compare(0, 2, "(:") != 0) {
+          this->stop();
+          throw triton::exceptions::SolverEngine("SmtLibSolver::start(): The solver does not answer.");
+        }
+        #endif
+      }
+
+
+      void SmtLibSolver::stop(void) const {
+        #if defined(__unix__) || defined(__APPLE__)
+        triton::sint32 child = this->pid.exchange(-1);
+        if (child >= 0) {
+          kill(child, SIGKILL);
+          waitpid(child, nullptr, 0);
+        }
+
+        if (this->channel >= 0) {
+          close(this->channel);
+          this->channel = -1;
+        }
+
+        this->pending.clear();
+        #endif
+      }
+
+
+      /* A failed write means that the process died, the next read reports it */
+      void SmtLibSolver::send(const std::string& commands) const {
+        #if defined(__unix__) || defined(__APPLE__)
+        const char* data = commands.c_str();
+        triton::usize size = commands.size();
+
+        while (size > 0 && this->channel >= 0) {
+          #if defined(MSG_NOSIGNAL)
+          ssize_t written = ::send(this->channel, data, size, MSG_NOSIGNAL);
+          #else
+          ssize_t written = ::send(this->channel, data, size, 0);
+          #endif
+          if (written < 0) {
+            if (errno == EINTR)
+              continue;
+            return;
+          }
+          data += written;
+          size -= written;
+        }
+        #endif
+      }
+
+
+      triton::engines::solver::status_e SmtLibSolver::read(std::string& sexpr, const std::chrono::steady_clock::time_point& deadline) const {
+        #if defined(__unix__) || defined(__APPLE__)
+        triton::sint32 depth = 0;
+        triton::usize index  = 0;
+        triton::usize start  = 0;
+        bool started         = false;
+        bool quoted          = false;
+        char closing         = 0;
+
+        while (this->channel >= 0) {
+          /* Scans the pending bytes for a complete atom or list */
+          for (; index < this->pending.size(); index++) {
+            char c = this->pending[index];
+
+            if (!started) {
+              if (std::isspace(static_cast<unsigned char>(c)))
+                continue;
+              started = true;
+              start   = index;
+            }
+
+            if (quoted) {
+              if (c == closing)
+                quoted = false;
+            }
+            else if (c == '"' || c == '|') {
+              quoted  = true;
+              closing = c;
+            }
+            else if (c == '(')
+              depth++;
+            else if ((c == ')' && --depth <= 0) || (depth == 0 && std::isspace(static_cast<unsigned char>(c)))) {
+              triton::usize end = (c == ')') ? index + 1 : index;
+              sexpr = this->pending.substr(start, end - start);
+              this->pending.erase(0, end);
+              return triton::engines::solver::SAT;
+            }
+          }
+
+          int wait = -1;
+          if (deadline != std::chrono::steady_clock::time_point::max()) {
+            auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+            if (left <= 0)
+              return triton::engines::solver::TIMEOUT;
+            wait = static_cast<int>(left < INT_MAX ? left : INT_MAX);
+          }
+
+          struct pollfd fd;
+          fd.fd      = this->channel;
+          fd.events  = POLLIN;
+          fd.revents = 0;
+
+          int ready = poll(&fd, 1, wait);
+          if (ready < 0 && errno == EINTR)
+            continue;
+          if (ready == 0)
+            return triton::engines::solver::TIMEOUT;
+
+          char buffer[4096];
+          ssize_t size = (ready < 0) ? -1 : ::recv(this->channel, buffer, sizeof(buffer), 0);
+          if (size < 0 && errno == EINTR)
+            continue;
+          if (size <= 0)
+            break;
+
+          this->pending.append(buffer, size);
+        }
+        #endif
+
+        return this->interrupted ? triton::engines::solver::INTERRUPTED : triton::engines::solver::UNKNOWN;
+      }
+
+
+      triton::engines::solver::status_e SmtLibSolver::check(const std::chrono::steady_clock::time_point& deadline) const {
+        std::string answer;
+
+        this->send("(check-sat)\n");
+
+        /* A check which does not answer in time is killed with its process */
+        triton::engines::solver::status_e status = this->read(answer, deadline);
+        if (status != triton::engines::solver::SAT) {
+          this->stop();
+          return status;
+        }
+
+        if (answer == "sat")
+          return triton::engines::solver::SAT;
+
+        if (answer == "unsat")
+          return triton::engines::solver::UNSAT;
+
+        if (answer == "unknown")
+          return triton::engines::solver::UNKNOWN;
+
+        /* An error leaves the solver in an unknown state */
+        this->stop();
+        throw triton::exceptions::SolverEngine("SmtLibSolver::check(): " + answer);
+      }
+
+
+      std::map<triton::uint32, SolverModel> SmtLibSolver::readModel(const std::map<std::string, triton::engines::symbolic::SharedSymbolicVariable>& variables, const std::chrono::steady_clock::time_point& deadline, triton::engines::solver::status_e& status) const {
+        std::map<triton::uint32, SolverModel> ret;
+        std::string answer;
+        triton::usize index = 0;
+
+        this->send("(get-model)\n");
+        status = this->read(answer, deadline);
+        if (status != triton::engines::solver::SAT) {
+          this->stop();
+          return ret;
+        }
+
+        SExpression model = SmtLibSolver::parse(answer, index);
+        if (!model.list.empty() && model.list[0].atom == "error") {
+          this->stop();
+          throw triton::exceptions::SolverEngine("SmtLibSolver::readModel(): " + answer);
+        }
+
+        /* SMT-LIB 2.6 prints a list of definitions, older solvers prefix it with `model` */
+        for (const auto& def : model.list) {
+          if (def.list.size() != 5 || def.list[0].atom != "define-fun" || !def.list[2].atom.empty() || !def.list[2].list.empty())
+            continue;
+
+          /* The parser drops the bars of the quoted symbols */
+          auto it = variables.find(triton::ast::representations::AstSmtRepresentation::getSymbol(def.list[1].atom));
+          if (it != variables.end())
+            ret[static_cast<triton::uint32>(it->second->getId())] = SolverModel(it->second, SmtLibSolver::parseValue(def.list[4]));
+        }
+
+        /* The model is completed for the variables the solver did not assign */
+        for (const auto& var : variables) {
+          if (ret.find(static_cast<triton::uint32>(var.second->getId())) == ret.end())
+            ret[static_cast<triton::uint32>(var.second->getId())] = SolverModel(var.second, 0);
+        }
+
+        return ret;
+      }
+
+
+      std::chrono::steady_clock::time_point SmtLibSolver::startQuery(const triton::ast::SharedAbstractNode& node, const SolverLimits& limits, std::map<std::string, triton::engines::symbolic::SharedSymbolicVariable>& variables) const {
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SmtLibSolver::startQuery(): node cannot be null.");
+
+        if (node->isLogical() == false)
+          throw triton::exceptions::SolverEngine("SmtLibSolver::startQuery(): Must be a logical node.");
+
+        for (const auto& var : triton::ast::lookingForNodes(node, triton::ast::VARIABLE_NODE)) {
+          const auto& symVar = reinterpret_cast<triton::ast::VariableNode*>(var.get())->getSymbolicVariable();
+          variables[triton::ast::representations::AstSmtRepresentation::getSymbol(symVar->getAlias().empty() ? symVar->getName() : symVar->getAlias())] = symVar;
+        }
+
+        std::string script = SolverRecorder::toSmtLib(node, false);
+
+        this->interrupted = false;
+        this->start(limits);
+        this->send("(push 1)\n" + script);
+
+        if (limits.timeout == 0)
+          return std::chrono::steady_clock::time_point::max();
+
+        return std::chrono::steady_clock::now() + std::chrono::milliseconds(limits.timeout);
+      }
+
+
+      void SmtLibSolver::endQuery(void) const {
+        if (this->pid >= 0)
+          this->send("(pop 1)\n");
+      }
+
+      SmtLibSolver::SExpression SmtLibSolver::parse(const std::string& sexpr, triton::usize& index) {
+        SExpression ret;
+
+        while (index < sexpr.size() && std::isspace(static_cast<unsigned char>(sexpr[index])))
+          index++;
+
+        if (index >= sexpr.size())
+          return ret;
+
+        if (sexpr[index] == '(') {
+          index++;
+          while (true) {
+            while (index < sexpr.size() && std::isspace(static_cast<unsigned char>(sexpr[index])))
+              index++;
+            if (index >= sexpr.size())
+              break;
+            if (sexpr[index] == ')') {
+              index++;
+              break;
+            }
+            ret.list.push_back(SmtLibSolver::parse(sexpr, index));
+          }
+        }
+
+        /* A quoted symbol is returned without its bars */
+        else if (sexpr[index] == '|') {
+          triton::usize end = sexpr.find('|', index + 1);
+          if (end == std::string::npos)
+            end = sexpr.size();
+          ret.atom = sexpr.substr(index + 1, end - index - 1);
+          index = end + 1;
+        }
+
+        else if (sexpr[index] == '"') {
+          triton::usize start = index++;
+          while (index < sexpr.size()) {
+            if (sexpr[index++] != '"')
+              continue;
+            if (index < sexpr.size() && sexpr[index] == '"')
+              index++;
+            else
+              break;
+          }
+          ret.atom = sexpr.substr(start, index - start);
+        }
+
+        else {
+          triton::usize start = index;
+          while (index < sexpr.size() && !std::isspace(static_cast<unsigned char>(sexpr[index])) && sexpr[index] != '(' && sexpr[index] != ')')
+            index++;
+          ret.atom = sexpr.substr(start, index - start);
+        }
+
+        return ret;
+      }
+
+
+      triton::uint512 SmtLibSolver::parseValue(const SExpression& value) {
+        const std::string& atom = value.atom;
+
+        if (atom.compare(0, 2, "#x") == 0 && atom.size() > 2)
+          return triton::uint512("0x" + atom.substr(2));
+
+        if (atom.compare(0, 2, "#b") == 0 && atom.size() > 2) {
+          triton::uint512 ret = 0;
+          for (triton::usize index = 2; index < atom.size(); index++)
+            ret = (ret << 1) | (atom[index] == '1' ? 1 : 0);
+          return ret;
+        }
+
+        if (atom == "true" || atom == "false")
+          return (atom == "true") ? 1 : 0;
+
+        /* (_ bvN size) */
+        if (value.list.size() == 3 && value.list[0].atom == "_" && value.list[1].atom.compare(0, 2, "bv") == 0 && value.list[1].atom.size() > 2)
+          return triton::uint512(value.list[1].atom.substr(2));
+
+        throw triton::exceptions::SolverEngine("SmtLibSolver::parseValue(): Unsupported value.");
+      }
+
+
+      std::map<triton::uint32, SolverModel> SmtLibSolver::getModel(const triton::ast::SharedAbstractNode& node) const {
+        return this->getModel(node, nullptr, SolverLimits());
+      }
+
+
+      std::map<triton::uint32, SolverModel> SmtLibSolver::getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, const SolverLimits& limits) const {
+        std::map<std::string, triton::engines::symbolic::SharedSymbolicVariable> variables;
+        std::map<triton::uint32, SolverModel> ret;
+
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+
+        auto deadline = this->startQuery(node, limits, variables);
+        try {
+          st = this->check(deadline);
+          if (st == triton::engines::solver::SAT)
+            ret = this->readModel(variables, deadline, st);
+        }
+        catch (...) {
+          /* The scope of the query cannot be popped from an unknown state, the next query restarts the process */
+          this->stop();
+          throw;
+        }
+        this->endQuery();
+
+        if (status != nullptr)
+          *status = st;
+
+        return ret;
+      }
+
+
+      std::list<std::map<triton::uint32, SolverModel>> SmtLibSolver::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit) const {
+        return this->getModels(node, limit, nullptr, SolverLimits());
+      }
+
+
+      std::list<std::map<triton::uint32, SolverModel>> SmtLibSolver::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, const SolverLimits& limits) const {
+        std::map<std::string, triton::engines::symbolic::SharedSymbolicVariable> variables;
+        std::list<std::map<triton::uint32, SolverModel>> ret;
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+
+        auto deadline = this->startQuery(node, limits, variables);
+        try {
+          while (limit > 0) {
+            triton::engines::solver::status_e res = this->check(deadline);
+            if (res == triton::engines::solver::SAT) {
+              auto model = this->readModel(variables, deadline, res);
+              if (res == triton::engines::solver::SAT)
+                ret.push_back(model);
+            }
+
+            /* The query stays sat once a model has been found */
+            if (st != triton::engines::solver::SAT)
+              st = res;
+
+            /* A query without variable has no other model */
+            if (res != triton::engines::solver::SAT || variables.empty())
+              break;
+
+            /* Escape last models */
+            std::ostringstream blocking;
+            blocking << "(assert (or";
+            for (const auto& var : variables)
+              blocking << " (distinct " << var.first << " (_ bv" << ret.back().at(static_cast<triton::uint32>(var.second->getId())).getValue() << " " << var.second->getSize() << "))";
+            blocking << "))" << std::endl;
+            this->send(blocking.str());
+
+            limit--;
+          }
+        }
+        catch (...) {
+          /* The scope of the query cannot be popped from an unknown state, the next query restarts the process */
+          this->stop();
+          throw;
+        }
+        this->endQuery();
+
+        if (status != nullptr)
+          *status = st;
+
+        return ret;
+      }
+
+
+      bool SmtLibSolver::isSat(const triton::ast::SharedAbstractNode& node) const {
+        return this->isSat(node, nullptr, SolverLimits());
+      }
+
+
+      bool SmtLibSolver::isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, const SolverLimits& limits) const {
+        std::map<std::string, triton::engines::symbolic::SharedSymbolicVariable> variables;
+
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+
+        auto deadline = this->startQuery(node, limits, variables);
+        try {
+          st = this->check(deadline);
+        }
+        catch (...) {
+          /* The scope of the query cannot be popped from an unknown state, the next query restarts the process */
+          this->stop();
+          throw;
+        }
+        this->endQuery();
+
+        if (status != nullptr)
+          *status = st;
+
+        return (st == triton::engines::solver::SAT);
+      }
+
+
+      void SmtLibSolver::interrupt(void) {
+        this->interrupted = true;
+
+        #if defined(__unix__) || defined(__APPLE__)
+        triton::sint32 child = this->pid;
+        if (child >= 0)
+          kill(child, SIGKILL);
+        #endif
+      }
+
+
+      const std::vector<std::string>& SmtLibSolver::getCommand(void) const {
+        return this->command;
+      }
+
+
+      std::string SmtLibSolver::getName(void) const {
+        return "smtlib:" + this->command[0];
+      }
+
+    };
+  };
+};
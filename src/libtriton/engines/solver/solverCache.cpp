@@ -0,0 +1,723 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+#if defined(__unix__) || defined(__APPLE__)
+  #include <cerrno>
+  #include <fcntl.h>
+  #include <sys/file.h>
+  #include <unistd.h>
+#endif
+
+#include <triton/astContext.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/solverCache.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/symbolicVariable.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* Mixes a value into a hash (splitmix64 finalizer) */
+      static inline triton::uint64 mixHash(triton::uint64 h, triton::uint64 value) {
+        h ^= value + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+        h ^= h >> 30;
+        h *= 0xbf58476d1ce4e5b9ULL;
+        h ^= h >> 27;
+        h *= 0x94d049bb133111ebULL;
+        h ^= h >> 31;
+        return h;
+      }
+
+
+      /* Mixes a value into both lanes of a hash */
+      static inline void mixHash(ConstraintHash& h, triton::uint64 value) {
+        h.first  = mixHash(h.first, value);
+        h.second = mixHash(h.second, ~value);
+      }
+
+
+      /* Magic number of the records of the persistent cache ("TSC1") */
+      static const triton::uint32 recordMagic = 0x31435354;
+
+      /* Header (magic, payload size) and trailer (checksum) sizes of a record */
+      static const triton::usize recordHeaderSize  = 8;
+      static const triton::usize recordTrailerSize = 8;
+
+      /* Minimal payload (key, flags, number of values) and maximal payload of a record */
+      static const triton::usize recordMinPayload = 21;
+      static const triton::usize recordMaxPayload = (1 << 24);
+
+
+      /* Appends an integer in little endian */
+      static void putInteger(std::string& out, triton::uint64 value, triton::usize size) {
+        for (triton::usize i = 0; i < size; i++)
+          out.push_back(static_cast<char>((value >> (i * 8)) & 0xff));
+      }
+
+
+      /* Reads an integer in little endian */
+      static triton::uint64 getInteger(const std::string& in, triton::usize offset, triton::usize size) {
+        triton::uint64 value = 0;
+        for (triton::usize i = 0; i < size; i++)
+          value |= static_cast<triton::uint64>(static_cast<triton::uint8>(in[offset + i])) << (i * 8);
+        return value;
+      }
+
+
+      /* FNV-1a checksum of a range of bytes */
+      static triton::uint64 checksum(const std::string& data, triton::usize offset, triton::usize size) {
+        triton::uint64 h = 0xcbf29ce484222325ULL;
+        for (triton::usize i = offset; i < offset + size; i++) {
+          h ^= static_cast<triton::uint8>(data[i]);
+          h *= 0x100000001b3ULL;
+        }
+        return h;
+      }
+
+
+      SolverCache::SolverCache(triton::usize capacity) {
+        this->capacity = capacity;
+        this->number   = 0;
+      }
+
+
+      /*
+       * Post-order traversal hashing each node once. References are unrolled, so a reference and its expression hash the same.
+       * With a renaming, variables hash as their index into the renaming (0 if they are not renamed) instead of their id.
+       */
+      ConstraintHash SolverCache::hashConstraint(const triton::ast::SharedAbstractNode& node, bool& hasVariables, const std::unordered_map<triton::usize, triton::usize>* renaming) {
+        std::unordered_map<const triton::ast::AbstractNode*, ConstraintHash> hashes;
+        std::vector<std::pair<triton::ast::AbstractNode*, bool>> worklist;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverCache::hashConstraint(): node cannot be null.");
+
+        worklist.push_back(std::make_pair(node.get(), false));
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.back().first;
+          bool expanded = worklist.back().second;
+
+          if (hashes.find(current) != hashes.end()) {
+            worklist.pop_back();
+            continue;
+          }
+
+          if (current->getType() == triton::ast::REFERENCE_NODE) {
+            triton::ast::AbstractNode* ast = reinterpret_cast<triton::ast::ReferenceNode*>(current)->getSymbolicExpression()->getAst().get();
+            auto it = hashes.find(ast);
+            if (it == hashes.end()) {
+              worklist.push_back(std::make_pair(ast, false));
+              continue;
+            }
+            hashes[current] = it->second;
+            worklist.pop_back();
+            continue;
+          }
+
+          if (!expanded) {
+            worklist.back().second = true;
+            for (const auto& child : current->getChildren()) {
+              if (hashes.find(child.get()) == hashes.end())
+                worklist.push_back(std::make_pair(child.get(), false));
+            }
+            continue;
+          }
+
+          worklist.pop_back();
+
+          ConstraintHash h(0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL);
+          mixHash(h, current->getType());
+          mixHash(h, current->getBitvectorSize());
+
+          switch (current->getType()) {
+            case triton::ast::INTEGER_NODE: {
+              triton::uint512 value = reinterpret_cast<triton::ast::IntegerNode*>(current)->getInteger();
+              do {
+                mixHash(h, static_cast<triton::uint512>(value & 0xffffffffffffffffULL).convert_to<triton::uint64>());
+                value >>= 64;
+              } while (value != 0);
+              break;
+            }
+
+            case triton::ast::STRING_NODE:
+              for (char c : reinterpret_cast<triton::ast::StringNode*>(current)->getString())
+                mixHash(h, static_cast<triton::uint64>(c));
+              break;
+
+            case triton::ast::VARIABLE_NODE: {
+              triton::usize id = reinterpret_cast<triton::ast::VariableNode*>(current)->getSymbolicVariable()->getId();
+              hasVariables = true;
+              if (renaming != nullptr) {
+                auto it = renaming->find(id);
+                mixHash(h, it != renaming->end() ? it->second + 1 : 0);
+              }
+              else
+                mixHash(h, id);
+              break;
+            }
+
+            default:
+              break;
+          }
+
+          mixHash(h, current->getChildren().size());
+          for (const auto& child : current->getChildren()) {
+            const ConstraintHash& ch = hashes.at(child.get());
+            mixHash(h, ch.first);
+            mixHash(h, ch.second);
+          }
+
+          hashes[current] = h;
+        }
+
+        return hashes.at(node.get());
+      }
+
+
+      ConstraintsKey SolverCache::getKey(const std::vector<triton::ast::SharedAbstractNode>& constraints, bool& hasVariables) {
+        ConstraintsKey key;
+
+        key.reserve(constraints.size());
+        for (const auto& constraint : constraints)
+          key.push_back(SolverCache::hashConstraint(constraint, hasVariables));
+
+        std::sort(key.begin(), key.end());
+        key.erase(std::unique(key.begin(), key.end()), key.end());
+
+        return key;
+      }
+
+
+      const SolverCacheEntry* SolverCache::lookup(const ConstraintsKey& key, bool needModel) {
+        if (this->capacity == 0)
+          return nullptr;
+
+        /* Same set of constraints */
+        auto it = this->entries.find(key);
+        if (it != this->entries.end() && (!it->second.entry.sat || !needModel || it->second.entry.hasModel)) {
+          this->stats.hits++;
+          return &it->second.entry;
+        }
+
+        /* The query contains a known-unsat set, which is indexed by one of its conjuncts */
+        for (const auto& conjunct : key) {
+          auto witness = this->witnesses.find(conjunct);
+          if (witness == this->witnesses.end())
+            continue;
+
+          for (triton::usize number : witness->second) {
+            const auto& unsat = this->order.at(number);
+            if (unsat->first.size() <= key.size() && std::includes(key.begin(), key.end(), unsat->first.begin(), unsat->first.end())) {
+              this->stats.unsatSupersetHits++;
+              return &unsat->second.entry;
+            }
+          }
+        }
+
+        /* The query is a subset of a satisfiable set, which contains the least shared conjunct of the query */
+        const std::set<triton::usize>* candidates = nullptr;
+        for (const auto& conjunct : key) {
+          auto posting = this->conjuncts.find(conjunct);
+          if (posting == this->conjuncts.end()) {
+            candidates = nullptr;
+            break;
+          }
+          if (candidates == nullptr || posting->second.size() < candidates->size())
+            candidates = &posting->second;
+        }
+
+        if (candidates != nullptr) {
+          for (triton::usize number : *candidates) {
+            const auto& sat = this->order.at(number);
+            const SolverCacheEntry& entry = sat->second.entry;
+            if (entry.sat && (entry.hasModel || !needModel) && sat->first.size() >= key.size() && std::includes(sat->first.begin(), sat->first.end(), key.begin(), key.end())) {
+              this->stats.satSubsetHits++;
+              return &entry;
+            }
+          }
+        }
+
+        this->stats.misses++;
+        return nullptr;
+      }
+
+
+      void SolverCache::insert(const ConstraintsKey& key, const SolverCacheEntry& entry) {
+        if (this->capacity == 0)
+          return;
+
+        auto it = this->entries.find(key);
+        if (it != this->entries.end()) {
+          this->unindexEntry(it);
+          it->second.entry = entry;
+          this->indexEntry(it);
+          return;
+        }
+
+        while (this->entries.size() >= this->capacity)
+          this->evictEntry();
+
+        Slot slot;
+        slot.number = this->number++;
+        slot.entry  = entry;
+
+        it = this->entries.insert(std::make_pair(key, slot)).first;
+        this->order[slot.number] = it;
+        this->indexEntry(it);
+      }
+
+
+      void SolverCache::indexEntry(Entries::iterator it) {
+        const ConstraintsKey& key = it->first;
+        Slot& slot = it->second;
+
+        for (const auto& conjunct : key)
+          this->conjuncts[conjunct].insert(slot.number);
+
+        /* An unsat entry is indexed by its least shared conjunct, which a query containing the entry must contain */
+        if (!slot.entry.sat && !key.empty()) {
+          slot.witness = key.front();
+          for (const auto& conjunct : key) {
+            if (this->conjuncts[conjunct].size() < this->conjuncts[slot.witness].size())
+              slot.witness = conjunct;
+          }
+          this->witnesses[slot.witness].insert(slot.number);
+        }
+      }
+
+
+      void SolverCache::unindexEntry(Entries::iterator it) {
+        const ConstraintsKey& key = it->first;
+        const Slot& slot = it->second;
+
+        for (const auto& conjunct : key) {
+          auto posting = this->conjuncts.find(conjunct);
+          posting->second.erase(slot.number);
+          if (posting->second.empty())
+            this->conjuncts.erase(posting);
+        }
+
+        if (!slot.entry.sat && !key.empty()) {
+          auto witness = this->witnesses.find(slot.witness);
+          witness->second.erase(slot.number);
+          if (witness->second.empty())
+            this->witnesses.erase(witness);
+        }
+      }
+
+
+      void SolverCache::evictEntry(void) {
+        auto oldest = this->order.begin();
+        this->unindexEntry(oldest->second);
+        this->entries.erase(oldest->second);
+        this->order.erase(oldest);
+        this->stats.evictions++;
+      }
+
+
+      void SolverCache::setCapacity(triton::usize capacity) {
+        this->capacity = capacity;
+        while (this->entries.size() > this->capacity)
+          this->evictEntry();
+      }
+
+
+      triton::usize SolverCache::getCapacity(void) const {
+        return this->capacity;
+      }
+
+
+      triton::usize SolverCache::size(void) const {
+        return this->entries.size();
+      }
+
+
+      const SolverCacheStatistics& SolverCache::getStatistics(void) const {
+        return this->stats;
+      }
+
+
+      void SolverCache::clear(void) {
+        this->entries.clear();
+        this->order.clear();
+        this->conjuncts.clear();
+        this->witnesses.clear();
+        this->stats = SolverCacheStatistics();
+      }
+
+
+      /* Holds the advisory lock which serializes the appends and the compactions of a log across processes */
+      class PersistentSolverCacheLock {
+        private:
+          int fd;
+
+        public:
+          PersistentSolverCacheLock(const std::string& path) : fd(-1) {
+            #if defined(__unix__) || defined(__APPLE__)
+            /* A separate file is locked, the log itself is replaced by the compactions */
+            this->fd = ::open((path + ".lock").c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+            if (this->fd != -1) {
+              while (::flock(this->fd, LOCK_EX) == -1 && errno == EINTR);
+            }
+            #endif
+          }
+
+          ~PersistentSolverCacheLock() {
+            #if defined(__unix__) || defined(__APPLE__)
+            if (this->fd != -1)
+              ::close(this->fd);
+            #endif
+          }
+      };
+
+
+      /* Returns the generation of a log, stored into its lock file and increased by each compaction (0 if unknown) */
+      static triton::uint64 getLogGeneration(const std::string& path) {
+        triton::uint64 generation = 0;
+
+        #if defined(__unix__) || defined(__APPLE__)
+        int fd = ::open((path + ".lock").c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd != -1) {
+          if (::pread(fd, &generation, sizeof(generation), 0) != sizeof(generation))
+            generation = 0;
+          ::close(fd);
+        }
+        #endif
+
+        return generation;
+      }
+
+
+      /* Increases the generation of a log, its lock must be held */
+      static triton::uint64 nextLogGeneration(const std::string& path) {
+        triton::uint64 generation = getLogGeneration(path) + 1;
+
+        #if defined(__unix__) || defined(__APPLE__)
+        int fd = ::open((path + ".lock").c_str(), O_WRONLY | O_CLOEXEC);
+        if (fd != -1) {
+          if (::pwrite(fd, &generation, sizeof(generation), 0) != sizeof(generation))
+            generation = 0;
+          ::close(fd);
+        }
+        #endif
+
+        return generation;
+      }
+
+
+      PersistentSolverCache::PersistentSolverCache(const std::string& path, triton::usize maxSize) {
+        this->path       = path;
+        this->maxSize    = maxSize;
+        this->offset     = 0;
+        this->generation = 0;
+        this->clock      = 0;
+
+        std::ofstream file(path, std::ios::binary | std::ios::app);
+        if (!file)
+          throw triton::exceptions::SolverEngine("PersistentSolverCache::PersistentSolverCache(): Cannot open " + path + ".");
+        file.close();
+
+        this->refresh();
+      }
+
+
+      /* Variables are numbered by first occurrence in the conjuncts ordered by shape */
+      ConstraintHash PersistentSolverCache::getKey(const std::vector<triton::ast::SharedAbstractNode>& constraints, std::vector<triton::engines::symbolic::SharedSymbolicVariable>& variables) {
+        std::vector<std::pair<ConstraintHash, triton::usize>> shapes;
+        std::unordered_map<triton::usize, triton::usize> renaming;
+        std::vector<ConstraintHash> hashes;
+        bool hasVariables = false;
+
+        shapes.reserve(constraints.size());
+        for (triton::usize index = 0; index < constraints.size(); index++)
+          shapes.push_back(std::make_pair(SolverCache::hashConstraint(constraints[index], hasVariables, &renaming), index));
+
+        std::stable_sort(shapes.begin(), shapes.end(), [](const std::pair<ConstraintHash, triton::usize>& a, const std::pair<ConstraintHash, triton::usize>& b) {
+          return a.first < b.first;
+        });
+
+        for (const auto& shape : shapes) {
+          for (const auto& node : triton::ast::lookingForNodes(constraints[shape.second], triton::ast::VARIABLE_NODE)) {
+            const auto& var = reinterpret_cast<triton::ast::VariableNode*>(node.get())->getSymbolicVariable();
+            if (renaming.find(var->getId()) == renaming.end()) {
+              renaming[var->getId()] = variables.size();
+              variables.push_back(var);
+            }
+          }
+        }
+
+        hashes.reserve(constraints.size());
+        for (const auto& constraint : constraints)
+          hashes.push_back(SolverCache::hashConstraint(constraint, hasVariables, &renaming));
+
+        std::sort(hashes.begin(), hashes.end());
+        hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+
+        ConstraintHash key(0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL);
+        mixHash(key, hashes.size());
+        for (const auto& h : hashes) {
+          mixHash(key, h.first);
+          mixHash(key, h.second);
+        }
+
+        return key;
+      }
+
+
+      /* magic (4) | payload size (4) | key (16) | flags (1) | number of values (4) | [size (1) | value]* | checksum (8) */
+      std::string PersistentSolverCache::serialize(const ConstraintHash& key, const PersistentSolverCacheEntry& entry) {
+        std::string payload;
+
+        putInteger(payload, key.first, 8);
+        putInteger(payload, key.second, 8);
+        putInteger(payload, (entry.sat ? 1 : 0) | (entry.hasModel ? 2 : 0), 1);
+        putInteger(payload, entry.values.size(), 4);
+        for (const auto& v : entry.values) {
+          std::string bytes;
+          triton::uint512 value = v;
+          while (value != 0) {
+            bytes.push_back(static_cast<char>(static_cast<triton::uint512>(value & 0xff).convert_to<triton::uint64>()));
+            value >>= 8;
+          }
+          putInteger(payload, bytes.size(), 1);
+          payload += bytes;
+        }
+
+        std::string record;
+        putInteger(record, recordMagic, 4);
+        putInteger(record, payload.size(), 4);
+        record += payload;
+        putInteger(record, checksum(payload, 0, payload.size()), 8);
+
+        return record;
+      }
+
+
+      triton::usize PersistentSolverCache::parse(const std::string& data) {
+        triton::usize pos = 0;
+
+        while (pos + recordHeaderSize <= data.size()) {
+          /* Resynchronizes on the next record */
+          if (getInteger(data, pos, 4) != recordMagic) {
+            pos++;
+            continue;
+          }
+
+          triton::usize size = getInteger(data, pos + 4, 4);
+          if (size < recordMinPayload || size > recordMaxPayload) {
+            this->stats.corruptedRecords++;
+            pos++;
+            continue;
+          }
+
+          /* A record which is still being written */
+          if (pos + recordHeaderSize + size + recordTrailerSize > data.size())
+            break;
+
+          triton::usize payload = pos + recordHeaderSize;
+          if (getInteger(data, payload + size, 8) != checksum(data, payload, size)) {
+            this->stats.corruptedRecords++;
+            pos++;
+            continue;
+          }
+
+          ConstraintHash key(getInteger(data, payload, 8), getInteger(data, payload + 8, 8));
+          PersistentSolverCacheEntry entry;
+          triton::uint64 flags = getInteger(data, payload + 16, 1);
+          triton::usize count  = getInteger(data, payload + 17, 4);
+          triton::usize cursor = payload + recordMinPayload;
+          bool valid           = true;
+
+          entry.sat      = (flags & 1) != 0;
+          entry.hasModel = (flags & 2) != 0;
+          for (triton::usize i = 0; i < count; i++) {
+            if (cursor >= payload + size || getInteger(data, cursor, 1) > 64 || cursor + 1 + getInteger(data, cursor, 1) > payload + size) {
+              valid = false;
+              break;
+            }
+            triton::usize bytes = getInteger(data, cursor, 1);
+            triton::uint512 value = 0;
+            for (triton::usize b = 0; b < bytes; b++)
+              value |= static_cast<triton::uint512>(static_cast<triton::uint8>(data[cursor + 1 + b])) << (b * 8);
+            entry.values.push_back(value);
+            cursor += 1 + bytes;
+          }
+
+          if (!valid || cursor != payload + size) {
+            this->stats.corruptedRecords++;
+            pos++;
+            continue;
+          }
+
+          /* Never downgrade an answer with a model */
+          auto it = this->entries.find(key);
+          if (it == this->entries.end() || entry.hasModel || !it->second.hasModel) {
+            entry.lastUse = ++this->clock;
+            this->entries[key] = entry;
+          }
+
+          pos += recordHeaderSize + size + recordTrailerSize;
+        }
+
+        return pos;
+      }
+
+
+      /* Does not take the lock: a record still being written is indexed by a later refresh */
+      void PersistentSolverCache::refresh(void) {
+        /* Read before opening, a log replaced meanwhile is only indexed again by the next refresh */
+        triton::uint64 generation = getLogGeneration(this->path);
+
+        std::ifstream file(this->path, std::ios::binary);
+        if (!file)
+          return;
+
+        file.seekg(0, std::ios::end);
+        triton::usize size = static_cast<triton::usize>(file.tellg());
+
+        /* The log has been compacted by another process, its entries are still valid answers so the index is kept */
+        if (generation != this->generation || size < this->offset) {
+          this->generation = generation;
+          this->offset     = 0;
+        }
+
+        if (size == this->offset)
+          return;
+
+        std::string data(size - this->offset, '\0');
+        file.seekg(this->offset);
+        file.read(&data[0], data.size());
+        data.resize(static_cast<triton::usize>(file.gcount()));
+
+        this->offset += this->parse(data);
+      }
+
+
+      /* Called with the lock held, so that no record appended by another process is lost */
+      void PersistentSolverCache::compact(void) {
+        std::vector<std::map<ConstraintHash, PersistentSolverCacheEntry>::iterator> order;
+        std::string data;
+
+        /* The records appended since our last read are kept as well */
+        this->refresh();
+
+        for (auto it = this->entries.begin(); it != this->entries.end(); ++it)
+          order.push_back(it);
+
+        std::sort(order.begin(), order.end(), [](const std::map<ConstraintHash, PersistentSolverCacheEntry>::iterator& a, const std::map<ConstraintHash, PersistentSolverCacheEntry>::iterator& b) {
+          return a->second.lastUse > b->second.lastUse;
+        });
+
+        triton::usize kept = 0;
+        for (const auto& it : order) {
+          std::string record = PersistentSolverCache::serialize(it->first, it->second);
+          if (data.size() + record.size() > this->maxSize / 2)
+            break;
+          data += record;
+          kept++;
+        }
+
+        std::string tmp = this->path + ".tmp" + std::to_string(std::random_device()());
+        std::ofstream file(tmp, std::ios::binary | std::ios::trunc);
+        if (!file)
+          return;
+        file.write(data.data(), data.size());
+        file.close();
+
+        if (!file || (std::rename(tmp.c_str(), this->path.c_str()) != 0 && (std::remove(this->path.c_str()) != 0 || std::rename(tmp.c_str(), this->path.c_str()) != 0))) {
+          std::remove(tmp.c_str());
+          return;
+        }
+
+        for (triton::usize i = kept; i < order.size(); i++)
+          this->entries.erase(order[i]);
+
+        this->offset     = data.size();
+        this->generation = nextLogGeneration(this->path);
+        this->stats.compactions++;
+      }
+
+
+      bool PersistentSolverCache::lookup(const ConstraintHash& key, bool needModel, PersistentSolverCacheEntry& entry) {
+        auto usable = [needModel](const PersistentSolverCacheEntry& e) {
+          return !e.sat || !needModel || e.hasModel;
+        };
+
+        auto it = this->entries.find(key);
+        if (it == this->entries.end() || !usable(it->second)) {
+          this->refresh();
+          it = this->entries.find(key);
+        }
+
+        if (it != this->entries.end() && usable(it->second)) {
+          it->second.lastUse = ++this->clock;
+          entry = it->second;
+          this->stats.hits++;
+          return true;
+        }
+
+        this->stats.misses++;
+        return false;
+      }
+
+
+      void PersistentSolverCache::insert(const ConstraintHash& key, const PersistentSolverCacheEntry& entry) {
+        auto it = this->entries.find(key);
+        if (it != this->entries.end() && it->second.hasModel && !entry.hasModel)
+          return;
+
+        std::string record = PersistentSolverCache::serialize(key, entry);
+
+        /* The lock is held from the opening, so that the record neither interleaves with another append nor goes to a log being replaced */
+        PersistentSolverCacheLock lock(this->path);
+        std::ofstream file(this->path, std::ios::binary | std::ios::app);
+        if (!file)
+          return;
+
+        file.write(record.data(), record.size());
+        file.close();
+
+        /* Indexes our record and the ones appended meanwhile by the other processes */
+        this->refresh();
+
+        if (this->offset > this->maxSize)
+          this->compact();
+      }
+
+
+      const std::string& PersistentSolverCache::getPath(void) const {
+        return this->path;
+      }
+
+
+      triton::usize PersistentSolverCache::getMaxSize(void) const {
+        return this->maxSize;
+      }
+
+
+      triton::usize PersistentSolverCache::size(void) const {
+        return this->entries.size();
+      }
+
+
+      const PersistentSolverCacheStatistics& PersistentSolverCache::getStatistics(void) const {
+        return this->stats;
+      }
+
+    };
+  };
+};
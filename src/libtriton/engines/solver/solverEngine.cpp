@@ -5,6 +5,18 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <thread>
+#include <unordered_map>
+
+#include <triton/astContext.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/solverEngine.hpp>
 
@@ -14,8 +26,11 @@ namespace triton {
   namespace engines {
     namespace solver {
 
-      SolverEngine::SolverEngine() {
-        this->kind = triton::engines::solver::SOLVER_INVALID;
+      SolverEngine::SolverEngine(triton::modes::Modes& modes)
+        : modes(modes) {
+        this->kind         = triton::engines::solver::SOLVER_INVALID;
+        this->queryAddress = 0;
+        this->optimistic   = triton::engines::solver::OPTIMISTIC_DISABLED;
         #ifdef Z3_INTERFACE
         /* By default we initialized the z3 solver */
         this->setSolver(triton::engines::solver::SOLVER_Z3);
@@ -54,6 +69,11 @@ namespace triton {
 
         /* Setup global variables */
         this->kind = kind;
+
+        #ifdef Z3_INTERFACE
+        this->session.reset();
+        #endif
+        this->pathIndex.clear();
       }
 
 
@@ -66,6 +86,23 @@ namespace triton {
 
         /* Setup global variables */
         this->kind = triton::engines::solver::SOLVER_CUSTOM;
+
+        #ifdef Z3_INTERFACE
+        this->session.reset();
+        #endif
+      }
+
+
+      void SolverEngine::setSmtLibSolver(const std::vector<std::string>& command) {
+        /* Define the external solver as current solver */
+        this->solver.reset(new triton::engines::solver::SmtLibSolver(command));
+
+        /* Setup global variables */
+        this->kind = triton::engines::solver::SOLVER_SMTLIB;
+
+        #ifdef Z3_INTERFACE
+        this->session.reset();
+        #endif
       }
 
 
@@ -76,24 +113,1132 @@ namespace triton {
       }
 
 
-      std::map<triton::uint32, SolverModel> SolverEngine::getModel(const triton::ast::SharedAbstractNode& node) const {
+      /* Splits a constraint into the operands of its top-level conjunctions */
+      void SolverEngine::splitConjunction(const triton::ast::SharedAbstractNode& node, std::vector<triton::ast::SharedAbstractNode>& conjuncts) const {
+        std::vector<triton::ast::SharedAbstractNode> worklist;
+
+        if (node->getType() == triton::ast::ASSERT_NODE)
+          worklist.push_back(node->getChildren()[0]);
+        else
+          worklist.push_back(node);
+
+        while (!worklist.empty()) {
+          triton::ast::SharedAbstractNode current = worklist.back();
+          worklist.pop_back();
+
+          if (current->getType() == triton::ast::LAND_NODE) {
+            const auto& children = current->getChildren();
+            worklist.insert(worklist.end(), children.rbegin(), children.rend());
+          }
+          else
+            conjuncts.push_back(current);
+        }
+      }
+
+
+      /* Partitions a conjunction into independent clusters (union-find on the shared variables) */
+      std::vector<ConstraintsCluster> SolverEngine::getIndependentClusters(const triton::ast::SharedAbstractNode& node) const {
+        std::vector<triton::ast::SharedAbstractNode> conjuncts;
+        std::vector<ConstraintsCluster> clusters;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::getIndependentClusters(): node cannot be null.");
+
+        this->splitConjunction(node, conjuncts);
+
+        std::vector<std::deque<triton::ast::SharedAbstractNode>> variables(conjuncts.size());
+        std::vector<triton::usize> parent(conjuncts.size());
+        std::unordered_map<triton::usize, triton::usize> owner;
+
+        std::iota(parent.begin(), parent.end(), 0);
+        auto find = [&parent](triton::usize index) {
+          while (parent[index] != index) {
+            parent[index] = parent[parent[index]];
+            index = parent[index];
+          }
+          return index;
+        };
+
+        for (triton::usize index = 0; index < conjuncts.size(); index++) {
+          variables[index] = triton::ast::lookingForNodes(conjuncts[index], triton::ast::VARIABLE_NODE);
+          for (const auto& var : variables[index]) {
+            triton::usize id = reinterpret_cast<triton::ast::VariableNode*>(var.get())->getSymbolicVariable()->getId();
+            auto it = owner.find(id);
+            if (it == owner.end())
+              owner[id] = index;
+            else
+              parent[find(index)] = find(it->second);
+          }
+        }
+
+        std::unordered_map<triton::usize, triton::usize> roots;
+        for (triton::usize index = 0; index < conjuncts.size(); index++) {
+          triton::usize root = find(index);
+          auto it = roots.find(root);
+          if (it == roots.end()) {
+            it = roots.insert(std::make_pair(root, clusters.size())).first;
+            clusters.push_back(ConstraintsCluster());
+          }
+
+          ConstraintsCluster& cluster = clusters[it->second];
+          cluster.constraints.push_back(conjuncts[index]);
+          cluster.satisfied &= (conjuncts[index]->evaluate() != 0);
+          for (const auto& var : variables[index]) {
+            const auto& symVar = reinterpret_cast<triton::ast::VariableNode*>(var.get())->getSymbolicVariable();
+            cluster.variables[symVar->getId()] = symVar;
+          }
+        }
+
+        return clusters;
+      }
+
+
+      /* Solves the unsatisfied clusters and completes the model with the concrete values */
+      std::map<triton::uint32, SolverModel> SolverEngine::getIndependentModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e& status, const SolverLimits& limits) const {
+        std::map<triton::uint32, SolverModel> ret;
+        triton::ast::AstContext& astCtxt = node->getContext();
+
+        for (const auto& cluster : this->getIndependentClusters(node)) {
+          if (cluster.satisfied) {
+            for (const auto& var : cluster.variables)
+              ret[static_cast<triton::uint32>(var.first)] = SolverModel(var.second, astCtxt.getVariableValue(var.first));
+            continue;
+          }
+
+          /* A falsified cluster without variable is a contradiction */
+          if (cluster.variables.empty()) {
+            status = triton::engines::solver::UNSAT;
+            return std::map<triton::uint32, SolverModel>{};
+          }
+
+          triton::ast::SharedAbstractNode query = cluster.constraints.size() == 1 ? cluster.constraints.front() : astCtxt.land(cluster.constraints);
+          std::map<triton::uint32, SolverModel> model = this->getCachedModel(query, cluster.constraints, status, limits);
+          if (status != triton::engines::solver::SAT)
+            return std::map<triton::uint32, SolverModel>{};
+
+          ret.insert(model.begin(), model.end());
+        }
+
+        status = triton::engines::solver::SAT;
+        return ret;
+      }
+
+
+      /* Checks the unsatisfied clusters only */
+      bool SolverEngine::isIndependentSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e& status, const SolverLimits& limits) const {
+        triton::ast::AstContext& astCtxt = node->getContext();
+
+        for (const auto& cluster : this->getIndependentClusters(node)) {
+          if (cluster.satisfied)
+            continue;
+
+          if (cluster.variables.empty()) {
+            status = triton::engines::solver::UNSAT;
+            return false;
+          }
+
+          triton::ast::SharedAbstractNode query = cluster.constraints.size() == 1 ? cluster.constraints.front() : astCtxt.land(cluster.constraints);
+          if (!this->isCachedSat(query, cluster.constraints, status, limits))
+            return false;
+        }
+
+        status = triton::engines::solver::SAT;
+        return true;
+      }
+
+
+      /* The known assignments are the cheapest, the interval solver decides its fragment, the local search can only find models */
+      bool SolverEngine::searchModel(const triton::ast::SharedAbstractNode& query, std::map<triton::uint32, SolverModel>& model, triton::engines::solver::status_e& status) const {
+        if (this->modes.isModeEnabled(triton::modes::SOLVER_MODEL_REUSE)) {
+          std::lock_guard<std::mutex> lock(this->searchMutex);
+          if (this->modelPool.lookup(query, model)) {
+            status = triton::engines::solver::SAT;
+            return true;
+          }
+        }
+
+        if (this->modes.isModeEnabled(triton::modes::SOLVER_INTERVALS)) {
+          triton::engines::solver::status_e answer = triton::engines::solver::UNKNOWN;
+          {
+            std::lock_guard<std::mutex> lock(this->searchMutex);
+            answer = this->intervalSolver.solve(query, model);
+          }
+          if (answer != triton::engines::solver::UNKNOWN) {
+            status = answer;
+            this->rememberModel(model);
+            return true;
+          }
+        }
+
+        if (!this->modes.isModeEnabled(triton::modes::SOLVER_LOCAL_SEARCH))
+          return false;
+
+        {
+          std::lock_guard<std::mutex> lock(this->searchMutex);
+          if (!this->localSearch.solve(query, model))
+            return false;
+        }
+
+        status = triton::engines::solver::SAT;
+        this->rememberModel(model);
+        return true;
+      }
+
+
+      bool SolverEngine::hasFastPaths(void) const {
+        return this->modes.isModeEnabled(triton::modes::SOLVER_MODEL_REUSE) ||
+               this->modes.isModeEnabled(triton::modes::SOLVER_INTERVALS) ||
+               this->modes.isModeEnabled(triton::modes::SOLVER_LOCAL_SEARCH);
+      }
+
+
+      void SolverEngine::rememberModel(const std::map<triton::uint32, SolverModel>& model) const {
+        if (this->modes.isModeEnabled(triton::modes::SOLVER_MODEL_REUSE)) {
+          std::lock_guard<std::mutex> lock(this->searchMutex);
+          this->modelPool.insert(model);
+        }
+      }
+
+
+      bool SolverEngine::preprocessQuery(const triton::ast::SharedAbstractNode& query, triton::ast::SharedAbstractNode& simplified, std::map<triton::uint32, SolverModel>& solved, triton::engines::solver::status_e& status) const {
+        simplified = query;
+        if (!this->modes.isModeEnabled(triton::modes::SOLVER_PREPROCESSING))
+          return true;
+
+        triton::engines::solver::status_e answer = this->preprocessor.process(query, simplified, solved);
+        if (answer == triton::engines::solver::UNKNOWN)
+          return true;
+
+        status = answer;
+        if (status == triton::engines::solver::SAT)
+          this->rememberModel(solved);
+
+        return false;
+      }
+
+
+      /* Rewrites the query, tries the fast paths, then races the portfolio if there is one, otherwise calls the solver */
+      std::map<triton::uint32, SolverModel> SolverEngine::getSolverModel(const triton::ast::SharedAbstractNode& query, triton::engines::solver::status_e& status, const SolverLimits& limits) const {
+        std::map<triton::uint32, SolverModel> model;
+        std::map<triton::uint32, SolverModel> solved;
+        triton::ast::SharedAbstractNode simplified;
+
+        if (!this->preprocessQuery(query, simplified, solved, status))
+          return solved;
+
+        if (this->searchModel(simplified, model, status)) {
+          if (status == triton::engines::solver::SAT)
+            model.insert(solved.begin(), solved.end());
+          return model;
+        }
+
+        #ifdef Z3_INTERFACE
+        if (this->kind == triton::engines::solver::SOLVER_Z3 && this->portfolio.size() > 1) {
+          this->racePortfolio(simplified, true, status, limits, model);
+          if (status == triton::engines::solver::SAT)
+            model.insert(solved.begin(), solved.end());
+          this->rememberModel(model);
+          return model;
+        }
+        #endif
+
+        model = this->solver->getModel(simplified, &status, limits);
+        if (status == triton::engines::solver::SAT)
+          model.insert(solved.begin(), solved.end());
+        this->rememberModel(model);
+
+        return model;
+      }
+
+
+      /* Rewrites the query, tries the fast paths, then races the portfolio if there is one, otherwise calls the solver */
+      bool SolverEngine::isSolverSat(const triton::ast::SharedAbstractNode& query, triton::engines::solver::status_e& status, const SolverLimits& limits) const {
+        std::map<triton::uint32, SolverModel> found;
+        triton::ast::SharedAbstractNode simplified;
+
+        if (!this->preprocessQuery(query, simplified, found, status))
+          return status == triton::engines::solver::SAT;
+
+        if (this->searchModel(simplified, found, status))
+          return status == triton::engines::solver::SAT;
+
+        #ifdef Z3_INTERFACE
+        if (this->kind == triton::engines::solver::SOLVER_Z3 && this->portfolio.size() > 1) {
+          std::map<triton::uint32, SolverModel> model;
+
+          this->racePortfolio(simplified, false, status, limits, model);
+          return status == triton::engines::solver::SAT;
+        }
+        #endif
+
+        return this->solver->isSat(simplified, &status, limits);
+      }
+
+
+      /* If no configuration answered, the status of the query tells why */
+      void SolverEngine::notePortfolioWinner(triton::usize winner) const {
+        if (winner >= this->portfolio.size()) {
+          this->portfolioWinner.clear();
+          return;
+        }
+
+        this->portfolioWins[winner]++;
+        this->portfolioWinner = this->portfolio[winner].name;
+      }
+
+
+      #ifdef Z3_INTERFACE
+      /* The racing contexts are registered like the sessions of the branch flip workers */
+      void SolverEngine::racePortfolio(const triton::ast::SharedAbstractNode& query, bool needModel, triton::engines::solver::status_e& status, const SolverLimits& limits, std::map<triton::uint32, SolverModel>& model) const {
+        std::atomic<bool> stop{false};
+
+        auto track = [&](z3::context& ctx, bool racing) {
+          std::lock_guard<std::mutex> lock(this->flipSessionsMutex);
+          if (racing)
+            this->raceContexts.push_back(std::make_pair(&ctx, &stop));
+          else
+            this->raceContexts.remove(std::make_pair(&ctx, &stop));
+        };
+
+        this->notePortfolioWinner(Z3Portfolio::race(query, this->portfolio, needModel, limits, status, model, &stop, track));
+      }
+      #endif
+
+
+      /* Looks for the answer into the persistent cache before calling the solver */
+      std::map<triton::uint32, SolverModel> SolverEngine::getPersistentModel(const triton::ast::SharedAbstractNode& query, const std::vector<triton::ast::SharedAbstractNode>& conjuncts, triton::engines::solver::status_e& status, const SolverLimits& limits) const {
+        std::vector<triton::engines::symbolic::SharedSymbolicVariable> variables;
+        std::map<triton::uint32, SolverModel> model;
+        PersistentSolverCacheEntry entry;
+
+        if (!this->persistentCache)
+          return this->getSolverModel(query, status, limits);
+
+        ConstraintHash key = PersistentSolverCache::getKey(conjuncts, variables);
+        if (variables.empty())
+          return this->getSolverModel(query, status, limits);
+
+        /* Maps the canonical values back to the variables of the query */
+        if (this->persistentCache->lookup(key, true, entry) && (!entry.sat || entry.values.size() == variables.size())) {
+          status = entry.sat ? triton::engines::solver::SAT : triton::engines::solver::UNSAT;
+          if (entry.sat) {
+            for (triton::usize index = 0; index < variables.size(); index++)
+              model[static_cast<triton::uint32>(variables[index]->getId())] = SolverModel(variables[index], entry.values[index]);
+          }
+          return model;
+        }
+
+        model = this->getSolverModel(query, status, limits);
+        if (status != triton::engines::solver::SAT && status != triton::engines::solver::UNSAT)
+          return model;
+
+        /* The variables the solver left unassigned do not matter, they are stored with their concrete value */
+        entry = PersistentSolverCacheEntry();
+        entry.sat      = (status == triton::engines::solver::SAT);
+        entry.hasModel = entry.sat;
+        for (const auto& var : variables) {
+          if (!entry.sat)
+            break;
+          auto it = model.find(static_cast<triton::uint32>(var->getId()));
+          entry.values.push_back(it != model.end() ? it->second.getValue() : query->getContext().getVariableValue(var->getId()));
+        }
+
+        this->persistentCache->insert(key, entry);
+
+        return model;
+      }
+
+
+      /* Looks for the answer into the persistent cache before calling the solver */
+      bool SolverEngine::isPersistentSat(const triton::ast::SharedAbstractNode& query, const std::vector<triton::ast::SharedAbstractNode>& conjuncts, triton::engines::solver::status_e& status, const SolverLimits& limits) const {
+        std::vector<triton::engines::symbolic::SharedSymbolicVariable> variables;
+        PersistentSolverCacheEntry entry;
+
+        if (!this->persistentCache)
+          return this->isSolverSat(query, status, limits);
+
+        ConstraintHash key = PersistentSolverCache::getKey(conjuncts, variables);
+        if (variables.empty())
+          return this->isSolverSat(query, status, limits);
+
+        if (this->persistentCache->lookup(key, false, entry)) {
+          status = entry.sat ? triton::engines::solver::SAT : triton::engines::solver::UNSAT;
+          return entry.sat;
+        }
+
+        entry.sat = this->isSolverSat(query, status, limits);
+        if (status == triton::engines::solver::SAT || status == triton::engines::solver::UNSAT)
+          this->persistentCache->insert(key, entry);
+
+        return entry.sat;
+      }
+
+
+      /* Looks for the answer into the cache before calling the solver */
+      std::map<triton::uint32, SolverModel> SolverEngine::getCachedModel(const triton::ast::SharedAbstractNode& query, const std::vector<triton::ast::SharedAbstractNode>& conjuncts, triton::engines::solver::status_e& status, const SolverLimits& limits) const {
+        bool hasVariables = false;
+
+        if (this->cache.getCapacity() == 0)
+          return this->getPersistentModel(query, conjuncts, status, limits);
+
+        ConstraintsKey key = SolverCache::getKey(conjuncts, hasVariables);
+        if (const SolverCacheEntry* entry = this->cache.lookup(key, true)) {
+          std::map<triton::uint32, SolverModel> model;
+          status = entry->sat ? triton::engines::solver::SAT : triton::engines::solver::UNSAT;
+
+          /* The model of a larger set of constraints may assign variables which are not in the query */
+          if (entry->sat) {
+            for (const auto& var : triton::ast::lookingForNodes(query, triton::ast::VARIABLE_NODE)) {
+              auto it = entry->model.find(static_cast<triton::uint32>(reinterpret_cast<triton::ast::VariableNode*>(var.get())->getSymbolicVariable()->getId()));
+              if (it != entry->model.end())
+                model.insert(*it);
+            }
+          }
+
+          return model;
+        }
+
+        std::map<triton::uint32, SolverModel> model = this->getPersistentModel(query, conjuncts, status, limits);
+
+        /* Timeouts and other unknown answers are not cached */
+        if (status == triton::engines::solver::SAT || status == triton::engines::solver::UNSAT) {
+          SolverCacheEntry entry;
+          entry.sat      = (status == triton::engines::solver::SAT);
+          entry.hasModel = entry.sat;
+          entry.model    = model;
+          this->cache.insert(key, entry);
+        }
+
+        return model;
+      }
+
+
+      /* Completes a model with the concrete values of the unassigned variables */
+      void SolverEngine::completeModel(const triton::ast::SharedAbstractNode& query, std::map<triton::uint32, SolverModel>& model) const {
+        triton::ast::AstContext& astCtxt = query->getContext();
+
+        for (const auto& var : triton::ast::lookingForNodes(query, triton::ast::VARIABLE_NODE)) {
+          const auto& symVar = reinterpret_cast<triton::ast::VariableNode*>(var.get())->getSymbolicVariable();
+          triton::uint32 id = static_cast<triton::uint32>(symVar->getId());
+          if (model.find(id) == model.end())
+            model[id] = SolverModel(symVar, astCtxt.getVariableValue(symVar->getId()));
+        }
+      }
+
+
+      /* Looks for the answer into the cache before calling the solver */
+      bool SolverEngine::isCachedSat(const triton::ast::SharedAbstractNode& query, const std::vector<triton::ast::SharedAbstractNode>& conjuncts, triton::engines::solver::status_e& status, const SolverLimits& limits) const {
+        bool hasVariables = false;
+
+        if (this->cache.getCapacity() == 0)
+          return this->isPersistentSat(query, conjuncts, status, limits);
+
+        ConstraintsKey key = SolverCache::getKey(conjuncts, hasVariables);
+        if (const SolverCacheEntry* entry = this->cache.lookup(key, false)) {
+          status = entry->sat ? triton::engines::solver::SAT : triton::engines::solver::UNSAT;
+          return entry->sat;
+        }
+
+        SolverCacheEntry entry;
+        entry.sat = this->isPersistentSat(query, conjuncts, status, limits);
+        if (status == triton::engines::solver::SAT || status == triton::engines::solver::UNSAT)
+          this->cache.insert(key, entry);
+
+        return entry.sat;
+      }
+
+
+      void SolverEngine::recordQuery(const std::string& kind, const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e status, const std::chrono::steady_clock::time_point& start) const {
+        auto time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+        this->recorder->record(kind, this->queryAddress, node, status, static_cast<triton::uint64>(time));
+      }
+
+
+      std::map<triton::uint32, SolverModel> SolverEngine::getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, const SolverLimits& limits) const {
+        std::vector<triton::ast::SharedAbstractNode> conjuncts;
+        std::map<triton::uint32, SolverModel> ret;
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        const SolverLimits queryLimits = limits.merge(this->limits);
+        auto start = std::chrono::steady_clock::now();
+
+        if (status != nullptr)
+          *status = triton::engines::solver::UNKNOWN;
+
         if (!this->solver)
-          return std::map<triton::uint32, SolverModel>{};
-        return this->solver->getModel(node);
+          return ret;
+
+        if (node == nullptr)
+          ret = this->solver->getModel(node, &st, queryLimits);
+
+        else if (this->modes.isModeEnabled(triton::modes::CONSTRAINTS_INDEPENDENCE))
+          ret = this->getIndependentModel(node, st, queryLimits);
+
+        else {
+          this->splitConjunction(node, conjuncts);
+          ret = this->getCachedModel(node, conjuncts, st, queryLimits);
+        }
+
+        if (node != nullptr && st == triton::engines::solver::SAT && this->modes.isModeEnabled(triton::modes::SOLVER_MODEL_COMPLETION))
+          this->completeModel(node, ret);
+
+        if (this->recorder)
+          this->recordQuery("getModel", node, st, start);
+
+        if (status != nullptr)
+          *status = st;
+
+        return ret;
       }
 
 
-      std::list<std::map<triton::uint32, SolverModel>> SolverEngine::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit) const {
+      std::list<std::map<triton::uint32, SolverModel>> SolverEngine::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, const SolverLimits& limits) const {
+        std::list<std::map<triton::uint32, SolverModel>> ret;
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        auto start = std::chrono::steady_clock::now();
+
+        if (status != nullptr)
+          *status = triton::engines::solver::UNKNOWN;
+
         if (!this->solver)
-          return std::list<std::map<triton::uint32, SolverModel>>{};
-        return this->solver->getModels(node, limit);
+          return ret;
+
+        ret = this->solver->getModels(node, limit, &st, limits.merge(this->limits));
+
+        if (node != nullptr && this->modes.isModeEnabled(triton::modes::SOLVER_MODEL_COMPLETION)) {
+          for (auto& model : ret)
+            this->completeModel(node, model);
+        }
+
+        if (this->recorder)
+          this->recordQuery("getModels", node, st, start);
+
+        if (status != nullptr)
+          *status = st;
+
+        return ret;
       }
 
 
-      bool SolverEngine::isSat(const triton::ast::SharedAbstractNode& node) const {
+      bool SolverEngine::isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, const SolverLimits& limits) const {
+        std::vector<triton::ast::SharedAbstractNode> conjuncts;
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        const SolverLimits queryLimits = limits.merge(this->limits);
+        auto start = std::chrono::steady_clock::now();
+        bool ret = false;
+
+        if (status != nullptr)
+          *status = triton::engines::solver::UNKNOWN;
+
         if (!this->solver)
           return false;
-        return this->solver->isSat(node);
+
+        if (node == nullptr)
+          ret = this->solver->isSat(node, &st, queryLimits);
+
+        else if (this->modes.isModeEnabled(triton::modes::CONSTRAINTS_INDEPENDENCE))
+          ret = this->isIndependentSat(node, st, queryLimits);
+
+        else {
+          this->splitConjunction(node, conjuncts);
+          ret = this->isCachedSat(node, conjuncts, st, queryLimits);
+        }
+
+        if (this->recorder)
+          this->recordQuery("isSat", node, st, start);
+
+        if (status != nullptr)
+          *status = st;
+
+        return ret;
+      }
+
+
+      triton::ast::SharedAbstractNode SolverEngine::getPathQuery(const std::vector<triton::engines::symbolic::PathConstraint>& path, triton::usize count, const triton::ast::SharedAbstractNode& query) const {
+        std::vector<triton::ast::SharedAbstractNode> operands;
+
+        for (triton::usize index = 0; index < count; index++)
+          operands.push_back(path[index].getTakenPathConstraintAst());
+
+        if (operands.empty())
+          return query;
+
+        operands.push_back(query);
+        return query->getContext().land(operands);
+      }
+
+
+      /* The constraints of the prefix which do not share variables with the query keep their concrete values, which only works if they are satisfied */
+      bool SolverEngine::searchPathModel(const triton::engines::solver::PathVariablesIndex& index, triton::usize count, const triton::ast::SharedAbstractNode& query, std::map<triton::uint32, SolverModel>& model, triton::engines::solver::status_e& status) const {
+        std::vector<triton::ast::SharedAbstractNode> related;
+
+        if (!this->hasFastPaths())
+          return false;
+
+        if (!index.getRelatedConstraints(count, query, related))
+          return false;
+
+        if (related.empty())
+          return this->searchModel(query, model, status);
+
+        related.push_back(query);
+        return this->searchModel(query->getContext().land(related), model, status);
+      }
+
+
+      std::map<triton::uint32, SolverModel> SolverEngine::getIncrementalModel(const std::vector<triton::engines::symbolic::PathConstraint>& path, triton::usize count, const triton::ast::SharedAbstractNode& query, triton::engines::solver::status_e* status) const {
+        if (status != nullptr)
+          *status = triton::engines::solver::UNKNOWN;
+
+        if (!this->solver)
+          return std::map<triton::uint32, SolverModel>{};
+
+        if (query == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::getIncrementalModel(): node cannot be null.");
+
+        if (count > path.size())
+          throw triton::exceptions::SolverEngine("SolverEngine::getIncrementalModel(): Out of range.");
+
+        #ifdef Z3_INTERFACE
+        if (this->kind == triton::engines::solver::SOLVER_Z3) {
+          if (!this->session)
+            this->session.reset(new triton::engines::solver::Z3Session());
+          triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+          auto start = std::chrono::steady_clock::now();
+
+          std::map<triton::uint32, SolverModel> ret;
+          bool found = false;
+
+          if (this->hasFastPaths()) {
+            this->pathIndex.sync(path, count);
+            found = this->searchPathModel(this->pathIndex, count, query, ret, st);
+          }
+
+          if (!found) {
+            this->session->setLimits(this->limits);
+            this->session->sync(path, count);
+            ret = this->session->getModel(query, &st);
+            this->rememberModel(ret);
+          }
+
+          if (this->recorder)
+            this->recordQuery("getModel", this->getPathQuery(path, count, query), st, start);
+
+          if (status != nullptr)
+            *status = st;
+
+          return ret;
+        }
+        #endif
+
+        return this->getModel(this->getPathQuery(path, count, query), status);
+      }
+
+
+      bool SolverEngine::isIncrementalSat(const std::vector<triton::engines::symbolic::PathConstraint>& path, triton::usize count, const triton::ast::SharedAbstractNode& query, triton::engines::solver::status_e* status) const {
+        if (status != nullptr)
+          *status = triton::engines::solver::UNKNOWN;
+
+        if (!this->solver)
+          return false;
+
+        if (query == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::isIncrementalSat(): node cannot be null.");
+
+        if (count > path.size())
+          throw triton::exceptions::SolverEngine("SolverEngine::isIncrementalSat(): Out of range.");
+
+        #ifdef Z3_INTERFACE
+        if (this->kind == triton::engines::solver::SOLVER_Z3) {
+          if (!this->session)
+            this->session.reset(new triton::engines::solver::Z3Session());
+          triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+          auto start = std::chrono::steady_clock::now();
+
+          std::map<triton::uint32, SolverModel> found;
+          bool fast = false;
+          bool ret  = true;
+
+          if (this->hasFastPaths()) {
+            this->pathIndex.sync(path, count);
+            fast = this->searchPathModel(this->pathIndex, count, query, found, st);
+          }
+
+          if (fast)
+            ret = (st == triton::engines::solver::SAT);
+          else {
+            this->session->setLimits(this->limits);
+            this->session->sync(path, count);
+            ret = this->session->isSat(query, &st);
+          }
+
+          if (this->recorder)
+            this->recordQuery("isSat", this->getPathQuery(path, count, query), st, start);
+
+          if (status != nullptr)
+            *status = st;
+
+          return ret;
+        }
+        #endif
+
+        return this->isSat(this->getPathQuery(path, count, query), status);
+      }
+
+
+      /* QSYM-like optimistic solving, the fallbacks drop the prefix constraints which may make the query unsat or too hard */
+      std::map<triton::uint32, SolverModel> SolverEngine::getOptimisticModel(const std::vector<triton::engines::symbolic::PathConstraint>& path, triton::usize count, const triton::ast::SharedAbstractNode& query, bool* optimistic, triton::engines::solver::status_e* status) const {
+        std::vector<triton::ast::SharedAbstractNode> fallbacks;
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+
+        if (optimistic != nullptr)
+          *optimistic = false;
+
+        std::map<triton::uint32, SolverModel> ret = this->getIncrementalModel(path, count, query, &st);
+
+        if (st == triton::engines::solver::SAT || st == triton::engines::solver::INTERRUPTED || this->optimistic == triton::engines::solver::OPTIMISTIC_DISABLED || count == 0) {
+          if (status != nullptr)
+            *status = st;
+          return ret;
+        }
+
+        if (this->optimistic == triton::engines::solver::OPTIMISTIC_DEPENDENT) {
+          std::vector<triton::ast::SharedAbstractNode> dependent;
+          std::set<triton::usize> ids;
+
+          for (const auto& var : triton::ast::lookingForNodes(query, triton::ast::VARIABLE_NODE))
+            ids.insert(reinterpret_cast<triton::ast::VariableNode*>(var.get())->getSymbolicVariable()->getId());
+
+          /* Only the constraints directly sharing a variable with the query */
+          for (triton::usize index = 0; index < count; index++) {
+            const triton::ast::SharedAbstractNode& constraint = path[index].getTakenPathConstraintAst();
+            for (const auto& var : triton::ast::lookingForNodes(constraint, triton::ast::VARIABLE_NODE)) {
+              if (ids.find(reinterpret_cast<triton::ast::VariableNode*>(var.get())->getSymbolicVariable()->getId()) != ids.end()) {
+                dependent.push_back(constraint);
+                break;
+              }
+            }
+          }
+
+          /* Without dependent constraint it is the last fallback, with all of them it is the whole query */
+          if (!dependent.empty() && dependent.size() < count) {
+            dependent.push_back(query);
+            fallbacks.push_back(query->getContext().land(dependent));
+          }
+        }
+
+        fallbacks.push_back(query);
+
+        for (const auto& fallback : fallbacks) {
+          triton::engines::solver::status_e fst = triton::engines::solver::UNKNOWN;
+          std::map<triton::uint32, SolverModel> model = this->getModel(fallback, &fst);
+
+          if (fst == triton::engines::solver::SAT) {
+            if (optimistic != nullptr)
+              *optimistic = true;
+            ret = model;
+            st  = fst;
+            break;
+          }
+
+          if (fst == triton::engines::solver::INTERRUPTED) {
+            st = fst;
+            break;
+          }
+        }
+
+        if (status != nullptr)
+          *status = st;
+
+        return ret;
+      }
+
+
+      /* The value of the expression is read from the model, the variables missing from the model keep their concrete value */
+      triton::engines::solver::status_e SolverEngine::getPathValue(const std::vector<triton::engines::symbolic::PathConstraint>& path, triton::usize count, const ConstraintEvaluator& evaluator, const triton::ast::SharedAbstractNode& constraint, triton::uint512& value) const {
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        std::map<triton::uint32, SolverModel> model = this->getModel(this->getPathQuery(path, count, constraint), &st);
+
+        if (st != triton::engines::solver::SAT)
+          return st;
+
+        const auto& variables = evaluator.getVariables();
+        std::vector<triton::uint512> assignment = evaluator.getConcreteAssignment();
+        for (triton::usize index = 0; index < variables.size(); index++) {
+          auto it = model.find(static_cast<triton::uint32>(variables[index]->getId()));
+          if (it != model.end())
+            assignment[index] = it->second.getValue();
+        }
+
+        value = evaluator.getValue(assignment);
+        return st;
+      }
+
+
+      std::vector<triton::uint512> SolverEngine::getValues(const std::vector<triton::engines::symbolic::PathConstraint>& path, triton::usize count, const triton::ast::SharedAbstractNode& node, triton::usize limit, triton::engines::solver::status_e* status) const {
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        std::vector<triton::uint512> ret;
+
+        if (status != nullptr)
+          *status = st;
+
+        if (!this->solver)
+          return ret;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::getValues(): node cannot be null.");
+
+        if (node->isLogical())
+          throw triton::exceptions::SolverEngine("SolverEngine::getValues(): Must be a bitvector node.");
+
+        if (count > path.size())
+          throw triton::exceptions::SolverEngine("SolverEngine::getValues(): Out of range.");
+
+        #ifdef Z3_INTERFACE
+        if (this->kind == triton::engines::solver::SOLVER_Z3) {
+          if (!this->session)
+            this->session.reset(new triton::engines::solver::Z3Session());
+          this->session->setLimits(this->limits);
+          this->session->sync(path, count);
+          return this->session->getValues(node, limit, status);
+        }
+        #endif
+
+        ConstraintEvaluator evaluator(node);
+        if (!evaluator.isSupported())
+          throw triton::exceptions::SolverEngine("SolverEngine::getValues(): The expression cannot be evaluated.");
+
+        /* Each query excludes the values already found */
+        triton::ast::AstContext& astCtxt = node->getContext();
+        std::vector<triton::ast::SharedAbstractNode> blocking;
+        while (ret.size() < limit) {
+          triton::uint512 value = 0;
+          triton::ast::SharedAbstractNode constraint = blocking.empty() ? astCtxt.equal(node, node) : (blocking.size() == 1 ? blocking.front() : astCtxt.land(blocking));
+          st = this->getPathValue(path, count, evaluator, constraint, value);
+          if (st != triton::engines::solver::SAT)
+            break;
+          ret.push_back(value);
+          blocking.push_back(astCtxt.distinct(node, astCtxt.bv(value, node->getBitvectorSize())));
+        }
+
+        if (st == triton::engines::solver::UNSAT && !ret.empty())
+          st = triton::engines::solver::SAT;
+
+        if (status != nullptr)
+          *status = st;
+
+        return ret;
+      }
+
+
+      triton::uint512 SolverEngine::getBoundValue(const std::vector<triton::engines::symbolic::PathConstraint>& path, triton::usize count, const triton::ast::SharedAbstractNode& node, bool maximize, triton::engines::solver::status_e* status) const {
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        triton::uint512 lo = 0;
+        triton::uint512 hi = 0;
+
+        if (status != nullptr)
+          *status = st;
+
+        if (!this->solver)
+          return 0;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::getBoundValue(): node cannot be null.");
+
+        if (node->isLogical())
+          throw triton::exceptions::SolverEngine("SolverEngine::getBoundValue(): Must be a bitvector node.");
+
+        if (count > path.size())
+          throw triton::exceptions::SolverEngine("SolverEngine::getBoundValue(): Out of range.");
+
+        #ifdef Z3_INTERFACE
+        if (this->kind == triton::engines::solver::SOLVER_Z3) {
+          if (!this->session)
+            this->session.reset(new triton::engines::solver::Z3Session());
+          this->session->setLimits(this->limits);
+          this->session->sync(path, count);
+          return maximize ? this->session->getMaxValue(node, status) : this->session->getMinValue(node, status);
+        }
+        #endif
+
+        ConstraintEvaluator evaluator(node);
+        if (!evaluator.isSupported())
+          throw triton::exceptions::SolverEngine("SolverEngine::getBoundValue(): The expression cannot be evaluated.");
+
+        /* Binary search on the bound, the value of each model may narrow the range further */
+        triton::ast::AstContext& astCtxt = node->getContext();
+        triton::uint32 size = node->getBitvectorSize();
+        triton::uint512 value = 0;
+
+        st = this->getPathValue(path, count, evaluator, astCtxt.equal(node, node), value);
+        if (st == triton::engines::solver::SAT) {
+          lo = maximize ? value : triton::uint512(0);
+          hi = maximize ? triton::uint512((triton::uint512(1) << size) - 1) : value;
+
+          while (lo < hi) {
+            triton::uint512 mid = lo + (hi - lo) / 2 + (maximize ? triton::uint512((hi - lo) & 1) : triton::uint512(0));
+            triton::ast::SharedAbstractNode bound = astCtxt.bv(mid, size);
+            triton::engines::solver::status_e result = this->getPathValue(path, count, evaluator, maximize ? astCtxt.bvuge(node, bound) : astCtxt.bvule(node, bound), value);
+
+            if (result == triton::engines::solver::SAT) {
+              if (maximize) lo = value;
+              else          hi = value;
+            }
+            else if (result == triton::engines::solver::UNSAT) {
+              if (maximize) hi = mid - 1;
+              else          lo = mid + 1;
+            }
+            else {
+              st = result;
+              break;
+            }
+          }
+        }
+
+        if (status != nullptr)
+          *status = st;
+
+        return maximize ? lo : hi;
+      }
+
+
+      triton::uint512 SolverEngine::getMinValue(const std::vector<triton::engines::symbolic::PathConstraint>& path, triton::usize count, const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status) const {
+        return this->getBoundValue(path, count, node, false, status);
+      }
+
+
+      triton::uint512 SolverEngine::getMaxValue(const std::vector<triton::engines::symbolic::PathConstraint>& path, triton::usize count, const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status) const {
+        return this->getBoundValue(path, count, node, true, status);
+      }
+
+
+      void SolverEngine::setOptimisticStrategy(triton::engines::solver::optimistic_e strategy) {
+        switch (strategy) {
+          case triton::engines::solver::OPTIMISTIC_DISABLED:
+          case triton::engines::solver::OPTIMISTIC_LAST:
+          case triton::engines::solver::OPTIMISTIC_DEPENDENT:
+            this->optimistic = strategy;
+            break;
+
+          default:
+            throw triton::exceptions::SolverEngine("SolverEngine::setOptimisticStrategy(): Invalid strategy.");
+        }
+      }
+
+
+      triton::engines::solver::optimistic_e SolverEngine::getOptimisticStrategy(void) const {
+        return this->optimistic;
+      }
+
+
+      std::map<triton::usize, std::map<triton::uint32, SolverModel>> SolverEngine::solveBranchFlips(const std::vector<triton::engines::symbolic::PathConstraint>& path, const std::vector<std::pair<triton::usize, triton::ast::SharedAbstractNode>>& flips, triton::usize maxThreads, triton::uint32 timeout, const BranchFlipCallback& callback) const {
+        std::map<triton::usize, std::map<triton::uint32, SolverModel>> ret;
+
+        if (!this->solver)
+          return ret;
+
+        for (const auto& flip : flips) {
+          if (flip.first >= path.size() || flip.second == nullptr)
+            throw triton::exceptions::SolverEngine("SolverEngine::solveBranchFlips(): Invalid flip.");
+        }
+
+        #ifdef Z3_INTERFACE
+        if (this->kind == triton::engines::solver::SOLVER_Z3 && !flips.empty()) {
+          std::deque<std::pair<triton::usize, std::map<triton::uint32, SolverModel>>> done;
+          std::vector<std::thread> workers;
+          std::condition_variable cv;
+          std::exception_ptr error;
+          std::mutex mutex;
+          std::atomic<triton::usize> next(0);
+          std::atomic<bool> stop(false);
+          triton::usize running = 0;
+
+          /* The workers outlive the callbacks, so they do not read the caller's vector which may be the live path of the context */
+          const std::vector<triton::engines::symbolic::PathConstraint> snapshot(path);
+          const SolverLimits workerLimits = SolverLimits(timeout).merge(this->limits);
+          const bool fastPaths = this->hasFastPaths();
+
+          /* The workers read a copy of the index, the callbacks may send incremental queries */
+          triton::engines::solver::PathVariablesIndex index;
+          if (fastPaths) {
+            triton::usize longest = 0;
+            for (const auto& flip : flips)
+              longest = std::max(longest, flip.first);
+            this->pathIndex.sync(snapshot, longest);
+            index = this->pathIndex;
+          }
+
+          if (maxThreads == 0)
+            maxThreads = std::max<triton::usize>(std::thread::hardware_concurrency(), 2) - 1;
+          maxThreads = std::min<triton::usize>(maxThreads, flips.size());
+
+          /* Each worker owns its z3 context. Flips are taken in order so that the sessions only grow. */
+          auto worker = [&]() {
+            try {
+              triton::engines::solver::Z3Session session;
+              session.setLimits(workerLimits);
+
+              /* Registers the session so that interrupt() reaches it */
+              std::list<std::pair<triton::engines::solver::Z3Session*, std::atomic<bool>*>>::iterator registered;
+              {
+                std::lock_guard<std::mutex> lock(this->flipSessionsMutex);
+                registered = this->flipSessions.insert(this->flipSessions.end(), std::make_pair(&session, &stop));
+              }
+              auto unregister = [&]() {
+                std::lock_guard<std::mutex> lock(this->flipSessionsMutex);
+                this->flipSessions.erase(registered);
+              };
+
+              try {
+                while (!stop) {
+                  triton::usize current = next++;
+                  if (current >= flips.size())
+                    break;
+
+                  /* The flips decided by the interval solver or found by the local search are not sent to z3 */
+                  const auto& flip = flips[current];
+                  std::map<triton::uint32, SolverModel> model;
+                  triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+                  if (!fastPaths || !this->searchPathModel(index, flip.first, flip.second, model, st)) {
+                    session.sync(snapshot, flip.first);
+                    model = session.getModel(flip.second);
+                  }
+
+                  std::lock_guard<std::mutex> lock(mutex);
+                  done.push_back(std::make_pair(flip.first, std::move(model)));
+                  cv.notify_one();
+                }
+              }
+              catch (...) {
+                unregister();
+                throw;
+              }
+              unregister();
+            }
+            catch (...) {
+              std::lock_guard<std::mutex> lock(mutex);
+              if (!error)
+                error = std::current_exception();
+              stop = true;
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            running--;
+            cv.notify_one();
+          };
+
+          running = maxThreads;
+          for (triton::usize i = 0; i < maxThreads; i++)
+            workers.emplace_back(worker);
+
+          /* Streams the results from the calling thread */
+          try {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (true) {
+              cv.wait(lock, [&]() { return !done.empty() || running == 0; });
+              while (!done.empty()) {
+                std::pair<triton::usize, std::map<triton::uint32, SolverModel>> result = std::move(done.front());
+                done.pop_front();
+                lock.unlock();
+                if (callback)
+                  callback(result.first, result.second);
+                this->rememberModel(result.second);
+                ret[result.first] = std::move(result.second);
+                lock.lock();
+              }
+              if (running == 0)
+                break;
+            }
+          }
+          catch (...) {
+            stop = true;
+            for (auto& w : workers)
+              w.join();
+            throw;
+          }
+
+          for (auto& w : workers)
+            w.join();
+
+          if (error)
+            std::rethrow_exception(error);
+
+          return ret;
+        }
+        #endif
+
+        for (const auto& flip : flips) {
+          std::map<triton::uint32, SolverModel> model = this->getModel(this->getPathQuery(path, flip.first, flip.second), nullptr, SolverLimits(timeout));
+          if (callback)
+            callback(flip.first, model);
+          ret[flip.first] = std::move(model);
+        }
+
+        return ret;
+      }
+
+
+      void SolverEngine::setPortfolio(const std::vector<SolverConfiguration>& configurations) {
+        #ifndef Z3_INTERFACE
+        if (!configurations.empty())
+          throw triton::exceptions::SolverEngine("SolverEngine::setPortfolio(): The portfolio mode needs z3.");
+        #endif
+
+        this->portfolio = configurations;
+        this->portfolioWins.assign(configurations.size(), 0);
+        this->portfolioWinner.clear();
+      }
+
+
+      const std::vector<SolverConfiguration>& SolverEngine::getPortfolio(void) const {
+        return this->portfolio;
+      }
+
+
+      const std::vector<triton::usize>& SolverEngine::getPortfolioWins(void) const {
+        return this->portfolioWins;
+      }
+
+
+      const std::string& SolverEngine::getPortfolioWinner(void) const {
+        return this->portfolioWinner;
+      }
+
+
+      void SolverEngine::setLimits(const SolverLimits& limits) {
+        this->limits = limits;
+      }
+
+
+      const SolverLimits& SolverEngine::getLimits(void) const {
+        return this->limits;
+      }
+
+
+      void SolverEngine::interrupt(void) {
+        if (this->solver)
+          this->solver->interrupt();
+
+        #ifdef Z3_INTERFACE
+        if (this->session)
+          this->session->interrupt();
+
+        std::lock_guard<std::mutex> lock(this->flipSessionsMutex);
+        for (const auto& worker : this->flipSessions) {
+          *worker.second = true;
+          worker.first->interrupt();
+        }
+
+        for (const auto& race : this->raceContexts) {
+          *race.second = true;
+          race.first->interrupt();
+        }
+        #endif
+      }
+
+
+      void SolverEngine::resetIncrementalSession(void) {
+        #ifdef Z3_INTERFACE
+        this->session.reset();
+        #endif
       }
 
 
@@ -103,6 +1248,108 @@ namespace triton {
         return this->solver->getName();
       }
 
+
+      void SolverEngine::setCacheCapacity(triton::usize capacity) {
+        this->cache.setCapacity(capacity);
+      }
+
+
+      triton::usize SolverEngine::getCacheCapacity(void) const {
+        return this->cache.getCapacity();
+      }
+
+
+      const SolverCacheStatistics& SolverEngine::getCacheStatistics(void) const {
+        return this->cache.getStatistics();
+      }
+
+
+      void SolverEngine::clearCache(void) {
+        this->cache.clear();
+      }
+
+
+      void SolverEngine::openPersistentCache(const std::string& path, triton::usize maxSize) {
+        this->persistentCache.reset(new triton::engines::solver::PersistentSolverCache(path, maxSize));
+      }
+
+
+      void SolverEngine::closePersistentCache(void) {
+        this->persistentCache.reset();
+      }
+
+
+      bool SolverEngine::isPersistentCacheOpened(void) const {
+        return this->persistentCache != nullptr;
+      }
+
+
+      const PersistentSolverCacheStatistics& SolverEngine::getPersistentCacheStatistics(void) const {
+        if (!this->persistentCache)
+          throw triton::exceptions::SolverEngine("SolverEngine::getPersistentCacheStatistics(): No persistent cache opened.");
+        return this->persistentCache->getStatistics();
+      }
+
+
+      void SolverEngine::startRecording(const std::string& path) {
+        this->recorder.reset(new triton::engines::solver::SolverRecorder(path));
+      }
+
+
+      void SolverEngine::stopRecording(void) {
+        this->recorder.reset();
+      }
+
+
+      bool SolverEngine::isRecording(void) const {
+        return this->recorder != nullptr;
+      }
+
+
+      void SolverEngine::setLocalSearchBudget(triton::usize budget) {
+        this->localSearch.setBudget(budget);
+      }
+
+
+      triton::usize SolverEngine::getLocalSearchBudget(void) const {
+        return this->localSearch.getBudget();
+      }
+
+
+      const LocalSearchStatistics& SolverEngine::getLocalSearchStatistics(void) const {
+        return this->localSearch.getStatistics();
+      }
+
+
+      const IntervalSolverStatistics& SolverEngine::getIntervalSolverStatistics(void) const {
+        return this->intervalSolver.getStatistics();
+      }
+
+
+      const QueryPreprocessorStatistics& SolverEngine::getPreprocessorStatistics(void) const {
+        return this->preprocessor.getStatistics();
+      }
+
+
+      void SolverEngine::setModelPoolCapacity(triton::usize capacity) {
+        this->modelPool.setCapacity(capacity);
+      }
+
+
+      triton::usize SolverEngine::getModelPoolCapacity(void) const {
+        return this->modelPool.getCapacity();
+      }
+
+
+      const ModelPoolStatistics& SolverEngine::getModelPoolStatistics(void) const {
+        return this->modelPool.getStatistics();
+      }
+
+
+      void SolverEngine::setQueryAddress(triton::uint64 address) {
+        this->queryAddress = address;
+      }
+
     };
   };
 };
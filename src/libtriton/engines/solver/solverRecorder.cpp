@@ -0,0 +1,217 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <map>
+#include <sstream>
+#include <unordered_set>
+
+#include <triton/astContext.hpp>
+#include <triton/astRepresentation.hpp>
+#include <triton/astSmtRepresentation.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/solverRecorder.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/symbolicVariable.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      SolverRecorder::SolverRecorder(const std::string& path)
+        : path(path),
+          first(0),
+          count(0) {
+        /* The numbering continues after the queries already in the capture */
+        std::ifstream capture(path);
+        std::string line;
+        while (std::getline(capture, line)) {
+          if (line.compare(0, 9, "; @query ") != 0)
+            continue;
+          std::istringstream header(line.substr(9));
+          triton::usize id = 0;
+          if (header >> id)
+            this->first = std::max(this->first, id + 1);
+        }
+        capture.close();
+
+        this->stream.open(path, std::ios::out | std::ios::app);
+        if (!this->stream)
+          throw triton::exceptions::SolverEngine("SolverRecorder::SolverRecorder(): Cannot open the capture.");
+      }
+
+
+      /* Shared sub-expressions are the symbolic expressions referenced by the query, each one is defined once */
+      std::string SolverRecorder::toSmtLib(const triton::ast::SharedAbstractNode& node, bool checkSat) {
+        std::map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable> variables;
+        std::map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> expressions;
+        std::unordered_set<const triton::ast::AbstractNode*> visited;
+        std::vector<triton::ast::SharedAbstractNode> worklist;
+        std::ostringstream stream;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverRecorder::toSmtLib(): node cannot be null.");
+
+        triton::ast::SharedAbstractNode query = node;
+        if (query->getType() == triton::ast::ASSERT_NODE)
+          query = query->getChildren()[0];
+
+        worklist.push_back(query);
+        while (!worklist.empty()) {
+          triton::ast::SharedAbstractNode current = worklist.back();
+          worklist.pop_back();
+
+          if (!visited.insert(current.get()).second)
+            continue;
+
+          if (current->getType() == triton::ast::VARIABLE_NODE) {
+            const auto& var = reinterpret_cast<triton::ast::VariableNode*>(current.get())->getSymbolicVariable();
+            variables[var->getId()] = var;
+          }
+
+          else if (current->getType() == triton::ast::REFERENCE_NODE) {
+            const auto& expr = reinterpret_cast<triton::ast::ReferenceNode*>(current.get())->getSymbolicExpression();
+            expressions[expr->getId()] = expr;
+            worklist.push_back(expr->getAst());
+          }
+
+          else {
+            for (const auto& child : current->getChildren())
+              worklist.push_back(child);
+          }
+        }
+
+        /* The script is printed in SMT whatever the representation mode of the context */
+        triton::ast::AstContext& astCtxt = query->getContext();
+        triton::uint32 mode = astCtxt.getRepresentationMode();
+        astCtxt.setRepresentationMode(triton::ast::representations::SMT_REPRESENTATION);
+
+        try {
+          for (const auto& var : variables) {
+            std::string name = triton::ast::representations::AstSmtRepresentation::getSymbol(var.second->getAlias().empty() ? var.second->getName() : var.second->getAlias());
+            stream << "(declare-fun " << name << " () (_ BitVec " << std::dec << var.second->getSize() << "))" << std::endl;
+          }
+
+          /* An expression only references older expressions */
+          for (const auto& expr : expressions) {
+            const triton::ast::SharedAbstractNode& ast = expr.second->getAst();
+            stream << "(define-fun ref!" << std::dec << expr.first << " () ";
+            if (ast->isLogical())
+              stream << "Bool";
+            else
+              stream << "(_ BitVec " << std::dec << ast->getBitvectorSize() << ")";
+            stream << " " << ast << ")" << std::endl;
+          }
+
+          stream << "(assert " << query << ")" << std::endl;
+          if (checkSat)
+            stream << "(check-sat)" << std::endl;
+        }
+        catch (...) {
+          astCtxt.setRepresentationMode(mode);
+          throw;
+        }
+
+        astCtxt.setRepresentationMode(mode);
+
+        return stream.str();
+      }
+
+
+      std::string SolverRecorder::getStatusName(triton::engines::solver::status_e status) {
+        switch (status) {
+          case triton::engines::solver::UNSAT:       return "unsat";
+          case triton::engines::solver::SAT:         return "sat";
+          case triton::engines::solver::TIMEOUT:     return "timeout";
+          case triton::engines::solver::OUTOFMEM:    return "outofmem";
+          case triton::engines::solver::INTERRUPTED: return "interrupted";
+          default:                                   return "unknown";
+        }
+      }
+
+
+      std::vector<SolverRecord> SolverRecorder::load(const std::string& path) {
+        std::vector<SolverRecord> records;
+        std::ifstream capture(path);
+        SolverRecord current;
+        std::string line;
+        bool inside = false;
+
+        if (!capture)
+          throw triton::exceptions::SolverEngine("SolverRecorder::load(): Cannot open the capture.");
+
+        /* A record without its end marker (e.g. an interrupted run) is dropped */
+        while (std::getline(capture, line)) {
+          if (line.compare(0, 9, "; @query ") == 0) {
+            std::istringstream header(line.substr(9));
+            current = SolverRecord();
+            header >> current.id >> current.kind;
+            inside = true;
+          }
+
+          else if (!inside)
+            continue;
+
+          else if (line == "; @end") {
+            records.push_back(current);
+            inside = false;
+          }
+
+          else if (line.compare(0, 11, "; @address ") == 0) {
+            std::istringstream value(line.substr(11));
+            value >> std::hex >> current.address;
+          }
+
+          else if (line.compare(0, 10, "; @status ") == 0) {
+            std::string name = line.substr(10);
+            for (triton::uint32 status = triton::engines::solver::UNSAT; status <= triton::engines::solver::UNKNOWN; status++) {
+              if (SolverRecorder::getStatusName(static_cast<triton::engines::solver::status_e>(status)) == name)
+                current.status = static_cast<triton::engines::solver::status_e>(status);
+            }
+          }
+
+          else if (line.compare(0, 8, "; @time ") == 0) {
+            std::istringstream value(line.substr(8));
+            value >> current.time;
+          }
+
+          else
+            current.smt += line + "\n";
+        }
+
+        return records;
+      }
+
+
+      void SolverRecorder::record(const std::string& kind, triton::uint64 address, const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e status, triton::uint64 time) {
+        std::string smt = SolverRecorder::toSmtLib(node);
+
+        this->stream << "; @query " << std::dec << this->first + this->count << " " << kind << std::endl;
+        this->stream << "; @address 0x" << std::hex << address << std::dec << std::endl;
+        this->stream << "; @status " << SolverRecorder::getStatusName(status) << std::endl;
+        this->stream << "; @time " << time << std::endl;
+        this->stream << smt;
+        this->stream << "; @end" << std::endl;
+
+        this->count++;
+      }
+
+
+      const std::string& SolverRecorder::getPath(void) const {
+        return this->path;
+      }
+
+
+      triton::usize SolverRecorder::getCount(void) const {
+        return this->count;
+      }
+
+    };
+  };
+};
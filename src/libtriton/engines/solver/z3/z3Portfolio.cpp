@@ -0,0 +1,169 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <z3++.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <triton/exceptions.hpp>
+#include <triton/tritonToZ3Ast.hpp>
+#include <triton/z3Portfolio.hpp>
+#include <triton/z3Solver.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      triton::usize Z3Portfolio::race(const triton::ast::SharedAbstractNode& node, const std::vector<SolverConfiguration>& configurations, bool needModel, const SolverLimits& limits, triton::engines::solver::status_e& status, std::map<triton::uint32, SolverModel>& model, const std::atomic<bool>* interrupted, const ContextTracker& track) {
+        std::vector<std::unique_ptr<triton::ast::TritonToZ3Ast>> translators;
+        std::vector<std::thread> workers;
+        std::vector<bool> finished(configurations.size(), false);
+        std::vector<triton::engines::solver::status_e> statuses(configurations.size(), triton::engines::solver::UNKNOWN);
+        std::condition_variable cv;
+        std::mutex mutex;
+        triton::usize winner  = configurations.size();
+        triton::usize running = configurations.size();
+        bool stop             = false;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("Z3Portfolio::race(): node cannot be null.");
+
+        triton::ast::SharedAbstractNode onode = node;
+        if (onode->getType() == triton::ast::ASSERT_NODE)
+          onode = onode->getChildren()[0];
+
+        if (onode->isLogical() == false)
+          throw triton::exceptions::SolverEngine("Z3Portfolio::race(): Must be a logical node.");
+
+        /* The contexts are owned here so that the losers can be interrupted */
+        for (triton::usize i = 0; i < configurations.size(); i++) {
+          translators.emplace_back(new triton::ast::TritonToZ3Ast(false));
+          if (track)
+            track(translators.back()->getContext(), true);
+        }
+
+        auto isInterrupted = [&]() {
+          return interrupted != nullptr && *interrupted;
+        };
+
+        auto worker = [&](triton::usize i) {
+          try {
+            const SolverConfiguration& config = configurations[i];
+            triton::ast::TritonToZ3Ast& translator = *translators[i];
+            z3::context& ctx = translator.getContext();
+
+            z3::expr expr = translator.convert(onode);
+            z3::solver solver = config.tactic.empty() ? z3::solver(ctx) : z3::tactic(ctx, config.tactic.c_str()).mk_solver();
+            Z3Solver::setLimits(solver, limits);
+            if (config.seed) {
+              z3::params p(ctx);
+              p.set("random_seed", config.seed);
+              solver.set(p);
+            }
+            solver.add(expr);
+
+            /* Another configuration may have won meanwhile */
+            bool cancelled = false;
+            {
+              std::lock_guard<std::mutex> lock(mutex);
+              cancelled = stop || isInterrupted();
+            }
+
+            z3::check_result result = cancelled ? z3::unknown : solver.check();
+            if (!cancelled) {
+              std::lock_guard<std::mutex> lock(mutex);
+              statuses[i] = Z3Solver::getStatus(solver, result);
+            }
+
+            if (result != z3::unknown) {
+              std::map<triton::uint32, SolverModel> smodel;
+              if (result == z3::sat && needModel) {
+                z3::model m = solver.get_model();
+                for (triton::uint32 index = 0; index < m.size(); index++) {
+                  z3::func_decl decl = m[index];
+                  auto var = translator.variables.find(decl.name().str());
+                  if (var == translator.variables.end())
+                    continue;
+                  z3::expr exp = m.get_const_interp(decl);
+                  smodel[static_cast<triton::uint32>(var->second->getId())] = SolverModel(var->second, triton::uint512(Z3_get_numeral_string(ctx, exp)));
+                }
+              }
+
+              std::lock_guard<std::mutex> lock(mutex);
+              if (winner == configurations.size()) {
+                winner = i;
+                status = statuses[i];
+                model  = std::move(smodel);
+              }
+            }
+          }
+          catch (const z3::exception&) {
+            /* An interrupted or failing configuration loses */
+          }
+          catch (const triton::exceptions::Exception&) {
+          }
+
+          std::lock_guard<std::mutex> lock(mutex);
+          finished[i] = true;
+          running--;
+          cv.notify_all();
+        };
+
+        for (triton::usize i = 0; i < configurations.size(); i++)
+          workers.emplace_back(worker, i);
+
+        {
+          std::unique_lock<std::mutex> lock(mutex);
+          /* An interrupt from outside may come before a context checks, it is polled */
+          while (winner == configurations.size() && running != 0 && !isInterrupted())
+            cv.wait_for(lock, std::chrono::milliseconds(10));
+
+          /* Cancels the losers */
+          stop = true;
+          while (running != 0) {
+            for (triton::usize i = 0; i < configurations.size(); i++) {
+              if (!finished[i])
+                translators[i]->getContext().interrupt();
+            }
+            cv.wait_for(lock, std::chrono::milliseconds(10));
+          }
+        }
+
+        for (auto& w : workers)
+          w.join();
+
+        if (track) {
+          for (const auto& translator : translators)
+            track(translator->getContext(), false);
+        }
+
+        /* Nobody answered, reports the first reason */
+        if (winner == configurations.size()) {
+          status = triton::engines::solver::UNKNOWN;
+          for (const auto& st : statuses) {
+            if (st != triton::engines::solver::UNKNOWN) {
+              status = st;
+              break;
+            }
+          }
+          if (isInterrupted())
+            status = triton::engines::solver::INTERRUPTED;
+          model.clear();
+        }
+
+        return winner;
+      }
+
+    };
+  };
+};
@@ -0,0 +1,306 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <string>
+
+#include <triton/exceptions.hpp>
+#include <triton/z3Session.hpp>
+#include <triton/z3Solver.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      Z3Session::Z3Session()
+        : translator(false),
+          solver(translator.getContext()) {
+      }
+
+
+      void Z3Session::sync(const std::vector<triton::engines::symbolic::PathConstraint>& path, triton::usize count) {
+        triton::usize common = 0;
+
+        if (count > path.size())
+          throw triton::exceptions::SolverEngine("Z3Session::sync(): Out of range.");
+
+        try {
+          while (common < this->asserted.size() && common < count && this->asserted[common] == path[common].getTakenPathConstraintAst())
+            common++;
+
+          if (common < this->asserted.size()) {
+            this->pop(this->asserted.size() - common);
+            this->asserted.resize(common);
+          }
+
+          for (triton::usize index = common; index < count; index++) {
+            const triton::ast::SharedAbstractNode& node = path[index].getTakenPathConstraintAst();
+            this->push();
+            this->solver.add(this->translator.convert(node));
+            this->asserted.push_back(node);
+          }
+        }
+        catch (const z3::exception& e) {
+          this->reset();
+          throw triton::exceptions::SolverEngine(std::string("Z3Session::sync(): ") + e.msg());
+        }
+        catch (const triton::exceptions::Exception&) {
+          this->reset();
+          throw;
+        }
+      }
+
+
+      void Z3Session::push(void) {
+        this->solver.push();
+        this->translator.push();
+      }
+
+
+      void Z3Session::pop(triton::usize count) {
+        this->solver.pop(static_cast<unsigned int>(count));
+        for (triton::usize index = 0; index < count; index++)
+          this->translator.pop();
+      }
+
+
+      z3::check_result Z3Session::check(const triton::ast::SharedAbstractNode& query) {
+        triton::ast::SharedAbstractNode node = query;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("Z3Session::check(): node cannot be null.");
+
+        /* Z3 does not need an assert() as root node */
+        if (node->getType() == triton::ast::ASSERT_NODE)
+          node = node->getChildren()[0];
+
+        if (node->isLogical() == false)
+          throw triton::exceptions::SolverEngine("Z3Session::check(): Must be a logical node.");
+
+        this->push();
+        try {
+          this->solver.add(this->translator.convert(node));
+        }
+        catch (const triton::exceptions::Exception&) {
+          this->pop();
+          throw;
+        }
+
+        return this->solver.check();
+      }
+
+
+      std::map<triton::uint32, SolverModel> Z3Session::getModel(const triton::ast::SharedAbstractNode& query, triton::engines::solver::status_e* status) {
+        std::map<triton::uint32, SolverModel> ret;
+
+        try {
+          z3::check_result result = this->check(query);
+          if (status != nullptr)
+            *status = Z3Solver::getStatus(this->solver, result);
+
+          if (result == z3::sat) {
+            z3::context& ctx = this->translator.getContext();
+            z3::model m      = this->solver.get_model();
+
+            /* The variables of the translations alive are the ones of the asserted prefix and of the query */
+            for (triton::uint32 index = 0; index < m.size(); index++) {
+              z3::func_decl decl = m[index];
+              auto var = this->translator.variables.find(decl.name().str());
+              if (var == this->translator.variables.end())
+                continue;
+              triton::uint512 value = triton::uint512(Z3_get_numeral_string(ctx, m.get_const_interp(decl)));
+              ret[static_cast<triton::uint32>(var->second->getId())] = SolverModel(var->second, value);
+            }
+          }
+          this->pop();
+        }
+        catch (const z3::exception& e) {
+          this->reset();
+          throw triton::exceptions::SolverEngine(std::string("Z3Session::getModel(): ") + e.msg());
+        }
+
+        return ret;
+      }
+
+
+      bool Z3Session::isSat(const triton::ast::SharedAbstractNode& query, triton::engines::solver::status_e* status) {
+        bool ret = false;
+
+        try {
+          z3::check_result result = this->check(query);
+          if (status != nullptr)
+            *status = Z3Solver::getStatus(this->solver, result);
+          ret = (result == z3::sat);
+          this->pop();
+        }
+        catch (const z3::exception& e) {
+          this->reset();
+          throw triton::exceptions::SolverEngine(std::string("Z3Session::isSat(): ") + e.msg());
+        }
+
+        return ret;
+      }
+
+
+      z3::expr Z3Session::convertExpression(const triton::ast::SharedAbstractNode& node) {
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("Z3Session::convertExpression(): node cannot be null.");
+
+        if (node->isLogical())
+          throw triton::exceptions::SolverEngine("Z3Session::convertExpression(): Must be a bitvector node.");
+
+        this->push();
+        try {
+          return this->translator.convert(node);
+        }
+        catch (const triton::exceptions::Exception&) {
+          this->pop();
+          throw;
+        }
+      }
+
+
+      triton::uint512 Z3Session::getModelValue(const z3::expr& expr) {
+        z3::expr value = this->solver.get_model().eval(expr, true);
+        return triton::uint512(Z3_get_numeral_string(this->translator.getContext(), value));
+      }
+
+
+      /* Each value found is excluded by a single disequality, the other variables are free to take any value */
+      std::vector<triton::uint512> Z3Session::getValues(const triton::ast::SharedAbstractNode& node, triton::usize limit, triton::engines::solver::status_e* status) {
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        std::vector<triton::uint512> ret;
+
+        try {
+          z3::expr expr = this->convertExpression(node);
+          z3::context& ctx = this->translator.getContext();
+
+          while (ret.size() < limit) {
+            z3::check_result result = this->solver.check();
+            st = Z3Solver::getStatus(this->solver, result);
+            if (result != z3::sat)
+              break;
+
+            triton::uint512 value = this->getModelValue(expr);
+            ret.push_back(value);
+            this->solver.add(expr != ctx.bv_val(value.str().c_str(), node->getBitvectorSize()));
+          }
+          this->pop();
+        }
+        catch (const z3::exception& e) {
+          this->reset();
+          throw triton::exceptions::SolverEngine(std::string("Z3Session::getValues(): ") + e.msg());
+        }
+
+        /* All the values have been enumerated */
+        if (st == triton::engines::solver::UNSAT && !ret.empty())
+          st = triton::engines::solver::SAT;
+
+        if (status != nullptr)
+          *status = st;
+
+        return ret;
+      }
+
+
+      /* Each check halves the range of the bound, the value of the model may narrow it further */
+      triton::uint512 Z3Session::getBoundValue(const triton::ast::SharedAbstractNode& node, bool maximize, triton::engines::solver::status_e* status) {
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        triton::uint512 lo = 0;
+        triton::uint512 hi = 0;
+
+        try {
+          z3::expr expr = this->convertExpression(node);
+          z3::context& ctx = this->translator.getContext();
+          triton::uint32 size = node->getBitvectorSize();
+
+          z3::check_result result = this->solver.check();
+          st = Z3Solver::getStatus(this->solver, result);
+
+          if (result == z3::sat) {
+            if (maximize) {
+              lo = this->getModelValue(expr);
+              hi = (triton::uint512(1) << size) - 1;
+            }
+            else {
+              hi = this->getModelValue(expr);
+            }
+
+            while (lo < hi) {
+              triton::uint512 mid = lo + (hi - lo) / 2 + (maximize ? triton::uint512((hi - lo) & 1) : triton::uint512(0));
+              z3::expr bound = ctx.bv_val(mid.str().c_str(), size);
+
+              this->solver.push();
+              this->solver.add(maximize ? z3::uge(expr, bound) : z3::ule(expr, bound));
+              result = this->solver.check();
+
+              if (result == z3::sat) {
+                if (maximize) lo = this->getModelValue(expr);
+                else          hi = this->getModelValue(expr);
+              }
+              else if (result == z3::unsat) {
+                if (maximize) hi = mid - 1;
+                else          lo = mid + 1;
+              }
+              else {
+                /* The best value found so far is returned with the status of the failed check */
+                st = Z3Solver::getStatus(this->solver, result);
+                this->solver.pop();
+                break;
+              }
+              this->solver.pop();
+            }
+          }
+          this->pop();
+        }
+        catch (const z3::exception& e) {
+          this->reset();
+          throw triton::exceptions::SolverEngine(std::string("Z3Session::getBoundValue(): ") + e.msg());
+        }
+
+        if (status != nullptr)
+          *status = st;
+
+        return maximize ? lo : hi;
+      }
+
+
+      triton::uint512 Z3Session::getMinValue(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status) {
+        return this->getBoundValue(node, false, status);
+      }
+
+
+      triton::uint512 Z3Session::getMaxValue(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status) {
+        return this->getBoundValue(node, true, status);
+      }
+
+
+      void Z3Session::setLimits(const SolverLimits& limits) {
+        Z3Solver::setLimits(this->solver, limits);
+      }
+
+
+      void Z3Session::interrupt(void) {
+        this->translator.getContext().interrupt();
+      }
+
+
+      triton::usize Z3Session::getNumberOfAssertions(void) const {
+        return this->asserted.size();
+      }
+
+
+      void Z3Session::reset(void) {
+        this->solver.reset();
+        this->asserted.clear();
+        this->translator.reset();
+      }
+
+    };
+  };
+};
@@ -7,6 +7,7 @@
 
 #include <z3++.h>
 #include <z3_api.h>
+#include <climits>
 #include <string>
 
 #include <triton/astContext.hpp>
@@ -36,13 +37,76 @@ namespace triton {
 
 
       Z3Solver::Z3Solver() {
+        this->running     = nullptr;
+        this->interrupted = false;
+      }
+
+
+      void Z3Solver::setLimits(z3::solver& solver, const SolverLimits& limits) {
+        z3::params p(solver.ctx());
+
+        p.set("timeout",       limits.timeout   ? limits.timeout   : UINT_MAX);
+        p.set("max_memory",    limits.memory    ? limits.memory    : UINT_MAX);
+        p.set("max_conflicts", limits.conflicts ? limits.conflicts : UINT_MAX);
+        solver.set(p);
+      }
+
+
+      triton::engines::solver::status_e Z3Solver::getStatus(const z3::solver& solver, z3::check_result result) {
+        if (result == z3::sat)
+          return triton::engines::solver::SAT;
+
+        if (result == z3::unsat)
+          return triton::engines::solver::UNSAT;
+
+        std::string reason = solver.reason_unknown();
+        if (reason.find("timeout") != std::string::npos)
+          return triton::engines::solver::TIMEOUT;
+        if (reason.find("memory") != std::string::npos)
+          return triton::engines::solver::OUTOFMEM;
+        if (reason.find("interrupted") != std::string::npos)
+          return triton::engines::solver::INTERRUPTED;
+
+        return triton::engines::solver::UNKNOWN;
+      }
+
+
+      void Z3Solver::setRunning(z3::context* ctx) const {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->running     = ctx;
+        this->interrupted = false;
+      }
+
+
+      triton::engines::solver::status_e Z3Solver::getCheckStatus(const z3::solver& solver, z3::check_result result) const {
+        if (result == z3::unknown) {
+          std::lock_guard<std::mutex> lock(this->mutex);
+          if (this->interrupted)
+            return triton::engines::solver::INTERRUPTED;
+        }
+        return Z3Solver::getStatus(solver, result);
+      }
+
+
+      void Z3Solver::interrupt(void) {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (this->running != nullptr) {
+          this->interrupted = true;
+          this->running->interrupt();
+        }
       }
 
 
       std::list<std::map<triton::uint32, SolverModel>> Z3Solver::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit) const {
+        return this->getModels(node, limit, nullptr, SolverLimits());
+      }
+
+
+      std::list<std::map<triton::uint32, SolverModel>> Z3Solver::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, const SolverLimits& limits) const {
         std::list<std::map<triton::uint32, SolverModel>> ret;
         triton::ast::SharedAbstractNode onode = node;
         triton::ast::TritonToZ3Ast z3Ast{false};
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
 
         try {
           if (onode == nullptr)
@@ -60,10 +124,22 @@ namespace triton {
           z3::solver    solver(ctx);
 
           /* Create a solver and add the expression */
+          Z3Solver::setLimits(solver, limits);
           solver.add(expr);
 
+          /* The context can be interrupted from now on */
+          RunningGuard guard(*this, &ctx);
+
           /* Check if it is sat */
-          while (solver.check() == z3::sat && limit >= 1) {
+          while (limit >= 1) {
+            z3::check_result res = solver.check();
+
+            /* A query which already has a model is sat whatever the next checks answer */
+            if (st != triton::engines::solver::SAT)
+              st = this->getCheckStatus(solver, res);
+
+            if (res != z3::sat)
+              break;
 
             /* Get model */
             z3::model m = solver.get_model();
@@ -103,13 +179,17 @@ namespace triton {
 
             }
 
-            /* Escape last models */
-            solver.add(triton::engines::solver::mk_or(args));
-
             /* If there is model available */
             if (smodel.size() > 0)
               ret.push_back(smodel);
 
+            /* A query without variable has no other model */
+            if (args.size() == 0)
+              break;
+
+            /* Escape last models */
+            solver.add(triton::engines::solver::mk_or(args));
+
             /* Decrement the limit */
             limit--;
           }
@@ -118,12 +198,21 @@ namespace triton {
           throw triton::exceptions::SolverEngine(std::string("Z3Solver::getModels(): ") + e.msg());
         }
 
+        if (status != nullptr)
+          *status = st;
+
         return ret;
       }
 
 
       bool Z3Solver::isSat(const triton::ast::SharedAbstractNode& node) const {
+        return this->isSat(node, nullptr, SolverLimits());
+      }
+
+
+      bool Z3Solver::isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, const SolverLimits& limits) const {
         triton::ast::TritonToZ3Ast z3Ast{false};
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
 
         if (node == nullptr)
           throw triton::exceptions::SolverEngine("Z3Solver::isSat(): node cannot be null.");
@@ -137,22 +226,34 @@ namespace triton {
           z3::solver    solver(ctx);
 
           /* Create a solver and add the expression */
+          Z3Solver::setLimits(solver, limits);
           solver.add(expr);
 
           /* Check if it is sat */
-          return solver.check() == z3::sat;
+          RunningGuard guard(*this, &ctx);
+          st = this->getCheckStatus(solver, solver.check());
         }
         catch (const z3::exception& e) {
           throw triton::exceptions::SolverEngine(std::string("Z3Solver::isSat(): ") + e.msg());
         }
+
+        if (status != nullptr)
+          *status = st;
+
+        return st == triton::engines::solver::SAT;
       }
 
 
       std::map<triton::uint32, SolverModel> Z3Solver::getModel(const triton::ast::SharedAbstractNode& node) const {
+        return this->getModel(node, nullptr, SolverLimits());
+      }
+
+
+      std::map<triton::uint32, SolverModel> Z3Solver::getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, const SolverLimits& limits) const {
         std::map<triton::uint32, SolverModel> ret;
         std::list<std::map<triton::uint32, SolverModel>> allModels;
 
-        allModels = this->getModels(node, 1);
+        allModels = this->getModels(node, 1, status, limits);
         if (allModels.size() > 0)
           ret = allModels.front();
 
@@ -25,14 +25,20 @@ namespace triton {
       PathManager::PathManager(const PathManager& other)
         : modes(other.modes),
           astCtxt(other.astCtxt) {
+        this->blocks          = other.blocks;
         this->pathConstraints = other.pathConstraints;
+        this->prefixes        = other.prefixes;
+        this->top             = other.top;
       }
 
 
       PathManager& PathManager::operator=(const PathManager& other) {
         this->astCtxt         = other.astCtxt;
+        this->blocks          = other.blocks;
         this->modes           = other.modes;
         this->pathConstraints = other.pathConstraints;
+        this->prefixes        = other.prefixes;
+        this->top             = other.top;
         return *this;
       }
 
@@ -43,27 +49,70 @@ namespace triton {
       }
 
 
+      /* Returns the (= true true) node */
+      const triton::ast::SharedAbstractNode& PathManager::getTopNode(void) const {
+        /* by default PC is T (top) */
+        if (this->top == nullptr)
+          this->top = this->astCtxt.equal(this->astCtxt.bvtrue(), this->astCtxt.bvtrue());
+        return this->top;
+      }
+
+
+      /* Fills the operands of the conjunction of the first constraints: T, the complete blocks and the remaining constraints */
+      void PathManager::getPrefixOperands(triton::usize count, std::vector<triton::ast::SharedAbstractNode>& operands) const {
+        triton::usize nblocks = count / blockSize;
+
+        operands.reserve(1 + nblocks + (count % blockSize) + 1);
+        operands.push_back(this->getTopNode());
+        operands.insert(operands.end(), this->blocks.begin(), this->blocks.begin() + nblocks);
+
+        for (triton::usize index = nblocks * blockSize; index < count; index++)
+          operands.push_back(this->pathConstraints[index].getTakenPathConstraintAst());
+      }
+
+
       /* Returns the logical conjunction AST of path constraint */
       triton::ast::SharedAbstractNode PathManager::getPathConstraintsAst(void) const {
-        // Every constraint should have the same context otherwise, we can't know
-        // which one to use for the current node computation.
-        std::vector<triton::engines::symbolic::PathConstraint>::const_iterator it;
+        return this->getPathConstraintsAst(this->pathConstraints.size());
+      }
 
-        /* by default PC is T (top) */
-        auto node = this->astCtxt.equal(
-                      this->astCtxt.bvtrue(),
-                      this->astCtxt.bvtrue()
-                    );
-
-        /* Then, we create a conjunction of pc */
-        for (it = this->pathConstraints.begin(); it != this->pathConstraints.end(); it++) {
-          node = this->astCtxt.land(node, it->getTakenPathConstraintAst());
+
+      /* Returns the logical conjunction AST of the first path constraints */
+      triton::ast::SharedAbstractNode PathManager::getPathConstraintsAst(triton::usize count) const {
+        if (count > this->pathConstraints.size())
+          throw triton::exceptions::PathManager("PathManager::getPathConstraintsAst(): Out of range.");
+
+        if (count == 0)
+          return this->getTopNode();
+
+        if (this->prefixes.size() <= count)
+          this->prefixes.resize(this->pathConstraints.size() + 1);
+
+        triton::ast::SharedAbstractNode& node = this->prefixes[count];
+        if (node == nullptr) {
+          std::vector<triton::ast::SharedAbstractNode> operands;
+          this->getPrefixOperands(count, operands);
+          node = this->astCtxt.land(operands);
         }
 
         return node;
       }
 
 
+      /* Returns the logical conjunction AST of the first path constraints and of the negation of the next one */
+      triton::ast::SharedAbstractNode PathManager::getFlippedPathConstraintsAst(triton::usize index) const {
+        std::vector<triton::ast::SharedAbstractNode> operands;
+
+        if (index >= this->pathConstraints.size())
+          throw triton::exceptions::PathManager("PathManager::getFlippedPathConstraintsAst(): Out of range.");
+
+        this->getPrefixOperands(index, operands);
+        operands.push_back(this->astCtxt.lnot(this->pathConstraints[index].getTakenPathConstraintAst()));
+
+        return this->astCtxt.land(operands);
+      }
+
+
       triton::usize PathManager::getNumberOfPathConstraints(void) const {
         return this->pathConstraints.size();
       }
@@ -122,11 +171,21 @@ namespace triton {
           this->pathConstraints.push_back(pco);
         }
 
+        /* Close the block of taken constraints once it is complete */
+        if (this->pathConstraints.size() % blockSize == 0) {
+          std::vector<triton::ast::SharedAbstractNode> operands;
+          operands.reserve(blockSize);
+          for (triton::usize index = this->pathConstraints.size() - blockSize; index < this->pathConstraints.size(); index++)
+            operands.push_back(this->pathConstraints[index].getTakenPathConstraintAst());
+          this->blocks.push_back(this->astCtxt.land(operands));
+        }
       }
 
 
       void PathManager::clearPathConstraints(void) {
+        this->blocks.clear();
         this->pathConstraints.clear();
+        this->prefixes.clear();
       }
 
     }; /* symbolic namespace */
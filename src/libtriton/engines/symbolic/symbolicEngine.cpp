@@ -5,8 +5,11 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
 #include <cstring>
+#include <deque>
 #include <new>
+#include <unordered_set>
 
 #include <triton/exceptions.hpp>
 #include <triton/coreUtils.hpp>
@@ -32,11 +35,18 @@ namespace triton {
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::SymbolicEngine(): The architecture pointer must be valid.");
 
         this->architecture      = architecture;
+        this->budgetBackoff     = 0;
+        this->astChanges        = std::make_shared<std::vector<triton::usize>>();
         this->numberOfRegisters = this->architecture->numberOfRegisters();
         this->callbacks         = callbacks;
         this->enableFlag        = true;
+        this->estimatedMemory     = 0;
+        this->indexSweepThreshold = 4096;
+        this->indexedIds          = 0;
+        this->memoryBudget        = 0;
         this->uniqueSymExprId   = 0;
         this->uniqueSymVarId    = 0;
+        this->usageClock        = 0;
 
         this->symbolicReg.resize(this->numberOfRegisters);
       }
@@ -48,17 +58,34 @@ namespace triton {
           astCtxt(other.astCtxt),
           modes(other.modes) {
 
+        this->addressExpressions          = other.addressExpressions;
         this->alignedMemoryReference      = other.alignedMemoryReference;
         this->architecture                = other.architecture;
+        this->astChanges                  = other.astChanges;
+        this->budgetBackoff               = other.budgetBackoff;
         this->callbacks                   = other.callbacks;
         this->enableFlag                  = other.enableFlag;
+        this->estimatedMemory             = other.estimatedMemory;
+        this->evictionStats               = other.evictionStats;
+        this->expressionReferences        = other.expressionReferences;
+        this->expressionUsages            = other.expressionUsages;
+        this->expressionUsers             = other.expressionUsers;
+        this->expressionVariables         = other.expressionVariables;
+        this->indexSweepThreshold         = other.indexSweepThreshold;
+        this->indexedIds                  = other.indexedIds;
+        this->kindExpressions             = other.kindExpressions;
+        this->memoryBudget                = other.memoryBudget;
         this->memoryReference             = other.memoryReference;
         this->numberOfRegisters           = other.numberOfRegisters;
         this->symbolicExpressions         = other.symbolicExpressions;
         this->symbolicReg                 = other.symbolicReg;
+        this->symbolicVariableNames       = other.symbolicVariableNames;
         this->symbolicVariables           = other.symbolicVariables;
+        this->taintedExpressions          = other.taintedExpressions;
         this->uniqueSymExprId             = other.uniqueSymExprId;
         this->uniqueSymVarId              = other.uniqueSymVarId;
+        this->usageClock                  = other.usageClock;
+        this->variableUsers               = other.variableUsers;
       }
 
 
@@ -66,19 +93,36 @@ namespace triton {
         triton::engines::symbolic::SymbolicSimplification::operator=(other);
         triton::engines::symbolic::PathManager::operator=(other);
 
+        this->addressExpressions          = other.addressExpressions;
         this->alignedMemoryReference      = other.alignedMemoryReference;
         this->architecture                = other.architecture;
+        this->astChanges                  = other.astChanges;
+        this->budgetBackoff               = other.budgetBackoff;
         this->astCtxt                     = other.astCtxt;
         this->callbacks                   = other.callbacks;
         this->enableFlag                  = other.enableFlag;
+        this->estimatedMemory             = other.estimatedMemory;
+        this->evictionStats               = other.evictionStats;
+        this->expressionReferences        = other.expressionReferences;
+        this->expressionUsages            = other.expressionUsages;
+        this->expressionUsers             = other.expressionUsers;
+        this->expressionVariables         = other.expressionVariables;
+        this->indexSweepThreshold         = other.indexSweepThreshold;
+        this->indexedIds                  = other.indexedIds;
+        this->kindExpressions             = other.kindExpressions;
+        this->memoryBudget                = other.memoryBudget;
         this->memoryReference             = other.memoryReference;
         this->modes                       = other.modes;
         this->numberOfRegisters           = other.numberOfRegisters;
         this->symbolicExpressions         = other.symbolicExpressions;
         this->symbolicReg                 = other.symbolicReg;
+        this->symbolicVariableNames       = other.symbolicVariableNames;
         this->symbolicVariables           = other.symbolicVariables;
+        this->taintedExpressions          = other.taintedExpressions;
         this->uniqueSymExprId             = other.uniqueSymExprId;
         this->uniqueSymVarId              = other.uniqueSymVarId;
+        this->usageClock                  = other.usageClock;
+        this->variableUsers               = other.variableUsers;
 
         return *this;
       }
@@ -205,30 +249,25 @@ namespace triton {
 
       /* Returns the symbolic variable otherwise raises an exception */
       const SharedSymbolicVariable& SymbolicEngine::getSymbolicVariableFromId(triton::usize symVarId) const {
-        auto it = this->symbolicVariables.find(symVarId);
-        if (it == this->symbolicVariables.end())
+        const SharedSymbolicVariable* symVar = this->symbolicVariables.find(symVarId);
+        if (symVar == nullptr)
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::getSymbolicVariableFromId(): Unregistred variable.");
-        return it->second;
+        return *symVar;
       }
 
 
       /* Returns the symbolic variable otherwise returns nullptr */
       const SharedSymbolicVariable& SymbolicEngine::getSymbolicVariableFromName(const std::string& symVarName) const {
-        /*
-         * FIXME: When there is a ton of symvar, this loop takes a while to go through.
-         *        What about adding two maps {id:symvar} and {string:symvar}? See #648.
-         */
-        for (auto& sv: this->symbolicVariables) {
-          if (sv.second->getName() == symVarName)
-            return sv.second;
-        }
+        auto it = this->symbolicVariableNames.find(symVarName);
+        if (it != this->symbolicVariableNames.end())
+          return this->getSymbolicVariableFromId(it->second);
 
         throw triton::exceptions::SymbolicEngine("SymbolicEngine::getSymbolicVariableFromName(): Unregistred variable.");
       }
 
 
       /* Returns all symbolic variables */
-      const std::unordered_map<triton::usize, SharedSymbolicVariable>& SymbolicEngine::getSymbolicVariables(void) const {
+      const SymbolicTable<SharedSymbolicVariable>& SymbolicEngine::getSymbolicVariables(void) const {
         return this->symbolicVariables;
       }
 
@@ -305,16 +344,21 @@ namespace triton {
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::newSymbolicExpression(): not enough memory");
 
         /* Save and returns the new shared symbolic expression */
-        this->symbolicExpressions[id] = expr;
+        expr->setAstChanges(this->astChanges);
+        this->symbolicExpressions.insert(id, expr);
+        this->kindExpressions[type].push_back(id);
+        this->recordExpression(expr);
+        this->addIndexedIds(1);
         return expr;
       }
 
 
       /* Removes the symbolic expression corresponding to the id */
       void SymbolicEngine::removeSymbolicExpression(triton::usize symExprId) {
-        if (this->symbolicExpressions.find(symExprId) != this->symbolicExpressions.end()) {
-          /* Delete and remove the pointer */
-          this->symbolicExpressions.erase(symExprId);
+        /* Delete and remove the pointer */
+        if (this->symbolicExpressions.erase(symExprId)) {
+          this->forgetExpression(symExprId);
+          this->taintedExpressions.erase(symExprId);
 
           /* Concretize the register if it exists */
           for (triton::uint32 i = 0; i < this->numberOfRegisters; i++) {
@@ -339,14 +383,16 @@ namespace triton {
 
       /* Gets the shared symbolic expression from a symbolic id */
       SharedSymbolicExpression SymbolicEngine::getSymbolicExpressionFromId(triton::usize symExprId) const {
-        auto it = this->symbolicExpressions.find(symExprId);
-        if (it == this->symbolicExpressions.end())
+        const WeakSymbolicExpression* expr = this->symbolicExpressions.find(symExprId);
+        if (expr == nullptr)
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::getSymbolicExpressionFromId(): symbolic expression id not found");
 
-        if (auto sp = it->second.lock())
+        if (auto sp = expr->lock())
           return sp;
 
         this->symbolicExpressions.erase(symExprId);
+        this->forgetExpression(symExprId);
+        this->taintedExpressions.erase(symExprId);
         throw triton::exceptions::SymbolicEngine("SymbolicEngine::getSymbolicExpressionFromId(): symbolic expression is not available anymore");
       }
 
@@ -355,19 +401,15 @@ namespace triton {
       std::unordered_map<triton::usize, SharedSymbolicExpression> SymbolicEngine::getSymbolicExpressions(void) const {
         // Copy and clean up dead weak ref
         std::unordered_map<triton::usize, SharedSymbolicExpression> ret;
-        std::vector<triton::usize> toRemove;
 
-        for (auto& kv : this->symbolicExpressions) {
-          if (auto sp = kv.second.lock()) {
+        this->removeExpiredExpressions();
+
+        ret.reserve(this->symbolicExpressions.size());
+        for (const auto& kv : this->symbolicExpressions) {
+          if (auto sp = kv.second.lock())
             ret[kv.first] = sp;
-          } else {
-            toRemove.push_back(kv.first);
-          }
         }
 
-        for (auto id : toRemove)
-          this->symbolicExpressions.erase(id);
-
         return ret;
       }
 
@@ -375,19 +417,36 @@ namespace triton {
       /* Slices all expressions from a given one */
       std::map<triton::usize, SharedSymbolicExpression> SymbolicEngine::sliceExpressions(const SharedSymbolicExpression& expr) {
         std::map<triton::usize, SharedSymbolicExpression> exprs;
-        std::deque<triton::ast::SharedAbstractNode> worklist;
+        std::vector<triton::usize> worklist;
 
         if (expr == nullptr)
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::sliceExpressions(): expr cannot be null.");
 
+        /* Walk the def-use graph backward, the cost only depends on the slice size */
+        this->refreshChangedExpressions();
         exprs[expr->getId()] = expr;
-        triton::ast::nodesExtraction(&worklist, expr->getAst(), true /* unroll */, false /* revert */);
+        worklist.push_back(expr->getId());
+
+        while (!worklist.empty()) {
+          triton::usize id = worklist.back();
+          worklist.pop_back();
+
+          const std::vector<triton::usize>* references = this->expressionReferences.find(id);
+          if (references == nullptr)
+            continue;
+
+          for (triton::usize rid : *references) {
+            if (exprs.find(rid) != exprs.end())
+              continue;
+
+            const WeakSymbolicExpression* ref = this->symbolicExpressions.find(rid);
+            if (ref == nullptr)
+              continue;
 
-        for (auto&& n : worklist) {
-          if (n->getType() == triton::ast::REFERENCE_NODE) {
-            auto expr = reinterpret_cast<triton::ast::ReferenceNode*>(n.get())->getSymbolicExpression();
-            auto eid  = expr->getId();
-            exprs[eid] = expr;
+            if (auto sp = ref->lock()) {
+              exprs[rid] = sp;
+              worklist.push_back(rid);
+            }
           }
         }
 
@@ -395,23 +454,556 @@ namespace triton {
       }
 
 
-      /* Returns a list which contains all tainted expressions */
-      std::list<SharedSymbolicExpression> SymbolicEngine::getTaintedSymbolicExpressions(void) const {
-        std::list<SharedSymbolicExpression> taintedExprs;
-        std::vector<triton::usize> invalidSymExpr;
+      /* Returns all expressions depending on a given one */
+      std::map<triton::usize, SharedSymbolicExpression> SymbolicEngine::forwardSliceExpressions(const SharedSymbolicExpression& expr) const {
+        std::map<triton::usize, SharedSymbolicExpression> exprs;
+
+        if (expr == nullptr)
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::forwardSliceExpressions(): expr cannot be null.");
+
+        exprs[expr->getId()] = expr;
+        for (triton::usize id : this->getForwardSliceIds({expr->getId()})) {
+          const WeakSymbolicExpression* user = this->symbolicExpressions.find(id);
+          if (user == nullptr)
+            continue;
+          if (auto sp = user->lock())
+            exprs[id] = sp;
+        }
+
+        return exprs;
+      }
+
+
+      /* Returns all expressions depending on a symbolic variable */
+      std::map<triton::usize, SharedSymbolicExpression> SymbolicEngine::forwardSliceExpressions(const SharedSymbolicVariable& symVar) const {
+        std::map<triton::usize, SharedSymbolicExpression> exprs;
+
+        if (symVar == nullptr)
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::forwardSliceExpressions(): symVar cannot be null.");
+
+        /* Expressions directly using the variable */
+        this->refreshChangedExpressions();
+        std::vector<triton::usize> sources;
+        std::vector<triton::usize>* users = this->variableUsers.find(symVar->getId());
+        if (users != nullptr) {
+          std::vector<triton::usize> live;
+          for (triton::usize uid : *users) {
+            const std::vector<triton::usize>* variables = this->expressionVariables.find(uid);
+            if (variables != nullptr && std::binary_search(variables->begin(), variables->end(), symVar->getId()))
+              live.push_back(uid);
+          }
+          std::sort(live.begin(), live.end());
+          live.erase(std::unique(live.begin(), live.end()), live.end());
+          *users = live;
+          sources = live;
+        }
+
+        std::vector<triton::usize> slice = this->getForwardSliceIds(sources);
+        slice.insert(slice.end(), sources.begin(), sources.end());
+
+        for (triton::usize id : slice) {
+          const WeakSymbolicExpression* user = this->symbolicExpressions.find(id);
+          if (user == nullptr)
+            continue;
+          if (auto sp = user->lock())
+            exprs[id] = sp;
+        }
+
+        return exprs;
+      }
+
+
+      /* Returns the path constraints depending on a given expression */
+      std::vector<PathConstraint> SymbolicEngine::forwardSlicePathConstraints(const SharedSymbolicExpression& expr) const {
+        if (expr == nullptr)
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::forwardSlicePathConstraints(): expr cannot be null.");
+
+        std::vector<triton::usize> exprIds;
+        for (const auto& kv : this->forwardSliceExpressions(expr))
+          exprIds.push_back(kv.first);
+
+        return this->getDependentPathConstraints(exprIds, nullptr);
+      }
+
+
+      /* Returns the path constraints depending on a symbolic variable */
+      std::vector<PathConstraint> SymbolicEngine::forwardSlicePathConstraints(const SharedSymbolicVariable& symVar) const {
+        if (symVar == nullptr)
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::forwardSlicePathConstraints(): symVar cannot be null.");
+
+        std::vector<triton::usize> exprIds;
+        for (const auto& kv : this->forwardSliceExpressions(symVar))
+          exprIds.push_back(kv.first);
+
+        return this->getDependentPathConstraints(exprIds, symVar);
+      }
+
 
-        for (auto it = this->symbolicExpressions.begin(); it != this->symbolicExpressions.end(); it++) {
-          if (auto sp = it->second.lock()) {
-            if (sp->isTainted) {
-              taintedExprs.push_back(sp);
+      /* Returns the ids of the live expressions reached through the users edges */
+      std::vector<triton::usize> SymbolicEngine::getForwardSliceIds(const std::vector<triton::usize>& sources) const {
+        std::unordered_set<triton::usize> visited(sources.begin(), sources.end());
+        std::vector<triton::usize> worklist = sources;
+        std::vector<triton::usize> ret;
+
+        this->refreshChangedExpressions();
+
+        while (!worklist.empty()) {
+          triton::usize id = worklist.back();
+          worklist.pop_back();
+
+          std::vector<triton::usize>* users = this->expressionUsers.find(id);
+          if (users == nullptr)
+            continue;
+
+          /* Prune the stale edges while walking them */
+          triton::usize live = 0;
+          for (triton::usize index = 0; index < users->size(); index++) {
+            triton::usize uid = (*users)[index];
+            const std::vector<triton::usize>* references = this->expressionReferences.find(uid);
+
+            if (references == nullptr || !std::binary_search(references->begin(), references->end(), id))
+              continue;
+
+            (*users)[live++] = uid;
+            if (visited.insert(uid).second) {
+              ret.push_back(uid);
+              worklist.push_back(uid);
+            }
+          }
+          users->resize(live);
+        }
+
+        return ret;
+      }
+
+
+      /* Returns the path constraints using one of the expressions or the variable */
+      std::vector<PathConstraint> SymbolicEngine::getDependentPathConstraints(const std::vector<triton::usize>& exprIds, const SharedSymbolicVariable& symVar) const {
+        std::unordered_set<triton::usize> ids(exprIds.begin(), exprIds.end());
+        std::vector<PathConstraint> ret;
+
+        for (const auto& pco : this->pathConstraints) {
+          std::vector<triton::usize> references;
+          std::vector<triton::usize> variables;
+          bool dependent = false;
+
+          this->getAstDependencies(pco.getTakenPathConstraintAst(), references, variables);
+
+          for (triton::usize rid : references) {
+            if (ids.find(rid) != ids.end()) {
+              dependent = true;
+              break;
             }
-          } else {
-            invalidSymExpr.push_back(it->first);
           }
+
+          if (!dependent && symVar != nullptr)
+            dependent = std::binary_search(variables.begin(), variables.end(), symVar->getId());
+
+          if (dependent)
+            ret.push_back(pco);
+        }
+
+        return ret;
+      }
+
+
+      /* Collects the ids of the expressions and variables directly used by an AST */
+      triton::usize SymbolicEngine::getAstDependencies(const triton::ast::SharedAbstractNode& node, std::vector<triton::usize>& references, std::vector<triton::usize>& variables) const {
+        std::vector<triton::ast::AbstractNode*> worklist;
+        std::unordered_set<const triton::ast::AbstractNode*> visited;
+
+        if (node == nullptr)
+          return 0;
+
+        worklist.push_back(node.get());
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.back();
+          worklist.pop_back();
+
+          if (visited.insert(current).second == false)
+            continue;
+
+          switch (current->getType()) {
+            case triton::ast::REFERENCE_NODE:
+              references.push_back(reinterpret_cast<triton::ast::ReferenceNode*>(current)->getSymbolicExpression()->getId());
+              break;
+
+            case triton::ast::VARIABLE_NODE:
+              variables.push_back(reinterpret_cast<triton::ast::VariableNode*>(current)->getSymbolicVariable()->getId());
+              break;
+
+            default:
+              for (const auto& child : current->getChildren())
+                worklist.push_back(child.get());
+              break;
+          }
+        }
+
+        std::sort(references.begin(), references.end());
+        references.erase(std::unique(references.begin(), references.end()), references.end());
+
+        std::sort(variables.begin(), variables.end());
+        variables.erase(std::unique(variables.begin(), variables.end()), variables.end());
+
+        return visited.size();
+      }
+
+
+      /* Records the def-use edges and the memory usage of an expression */
+      void SymbolicEngine::recordExpression(const SharedSymbolicExpression& expr) const {
+        std::vector<triton::usize> references;
+        std::vector<triton::usize> variables;
+        triton::usize id = expr->getId();
+
+        /* References are not unrolled, so each node is only accounted by its own expression */
+        triton::usize nodes = this->getAstDependencies(expr->getAst(), references, variables);
+        triton::usize size  = sizeof(SymbolicExpression) + nodes * sizeof(triton::ast::AbstractNode);
+
+        ExpressionUsage* usage = this->expressionUsages.find(id);
+        if (usage != nullptr)
+          this->estimatedMemory -= usage->size;
+        else
+          usage = &this->expressionUsages.insert(id, ExpressionUsage());
+        usage->size    = size;
+        usage->lastUse = this->usageClock++;
+        usage->ast     = expr->getAst();
+        this->estimatedMemory += size;
+
+        for (triton::usize rid : references) {
+          std::vector<triton::usize>* users = this->expressionUsers.find(rid);
+          if (users == nullptr)
+            users = &this->expressionUsers.insert(rid, std::vector<triton::usize>());
+          users->push_back(id);
+        }
+
+        for (triton::usize vid : variables) {
+          std::vector<triton::usize>* users = this->variableUsers.find(vid);
+          if (users == nullptr)
+            users = &this->variableUsers.insert(vid, std::vector<triton::usize>());
+          users->push_back(id);
+        }
+
+        /* Users edges of the previous AST (if any) become stale and are pruned lazily */
+        this->expressionReferences.insert(id, references);
+        this->expressionVariables.insert(id, variables);
+      }
+
+
+      /* Records again the expressions whose AST has been changed by the user */
+      void SymbolicEngine::refreshChangedExpressions(void) const {
+        if (this->astChanges->empty())
+          return;
+
+        std::vector<triton::usize> ids;
+        ids.swap(*this->astChanges);
+        std::sort(ids.begin(), ids.end());
+        ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+        for (triton::usize id : ids) {
+          const WeakSymbolicExpression* expr = this->symbolicExpressions.find(id);
+          if (expr == nullptr)
+            continue;
+
+          auto sp = expr->lock();
+          if (sp == nullptr)
+            continue;
+
+          /* The engine records its own changes itself */
+          const ExpressionUsage* usage = this->expressionUsages.find(id);
+          if (usage == nullptr || usage->ast.lock() != sp->getAst())
+            this->recordExpression(sp);
         }
+      }
+
+
+      /* Removes the def-use edges and the memory usage of an expression */
+      void SymbolicEngine::forgetExpression(triton::usize symExprId) const {
+        const ExpressionUsage* usage = this->expressionUsages.find(symExprId);
+        if (usage != nullptr) {
+          this->estimatedMemory -= usage->size;
+          this->expressionUsages.erase(symExprId);
+        }
+
+        this->expressionReferences.erase(symExprId);
+        this->expressionVariables.erase(symExprId);
+        this->expressionUsers.erase(symExprId);
+      }
+
 
-        for (auto id : invalidSymExpr)
+      /* Removes the dead expressions from the table and from the def-use graph */
+      void SymbolicEngine::removeExpiredExpressions(void) const {
+        std::vector<triton::usize> expired;
+
+        for (const auto& kv : this->symbolicExpressions) {
+          if (kv.second.expired())
+            expired.push_back(kv.first);
+        }
+
+        for (triton::usize id : expired) {
           this->symbolicExpressions.erase(id);
+          this->forgetExpression(id);
+          this->taintedExpressions.erase(id);
+        }
+
+        /* Prune the dead ids of the lazy indexes */
+        auto isDead = [this](triton::usize id) { return !this->symbolicExpressions.contains(id); };
+
+        for (auto it = this->addressExpressions.begin(); it != this->addressExpressions.end();) {
+          it->second.erase(std::remove_if(it->second.begin(), it->second.end(), isDead), it->second.end());
+          if (it->second.empty())
+            it = this->addressExpressions.erase(it);
+          else
+            it++;
+        }
+
+        this->indexedIds = 0;
+        for (auto& kv : this->addressExpressions)
+          this->indexedIds += kv.second.size();
+
+        for (auto& kv : this->kindExpressions) {
+          kv.second.erase(std::remove_if(kv.second.begin(), kv.second.end(), isDead), kv.second.end());
+          this->indexedIds += kv.second.size();
+        }
+
+        this->indexSweepThreshold = std::max<triton::usize>(4096, 2 * this->indexedIds);
+      }
+
+
+      /* Accounts ids added to the indexes */
+      void SymbolicEngine::addIndexedIds(triton::usize count) {
+        /* The sweep is linear in the indexes, running it once they doubled keeps its amortized cost constant */
+        this->indexedIds += count;
+        if (this->indexedIds > this->indexSweepThreshold)
+          this->removeExpiredExpressions();
+      }
+
+
+      /* Marks an expression as used */
+      void SymbolicEngine::touchExpression(triton::usize symExprId) {
+        ExpressionUsage* usage = this->expressionUsages.find(symExprId);
+        if (usage != nullptr)
+          usage->lastUse = this->usageClock++;
+      }
+
+
+      /* Returns the ids of the expressions reachable from the path constraints */
+      std::unordered_set<triton::usize> SymbolicEngine::getPathConstraintsExpressionIds(void) const {
+        std::unordered_set<triton::usize> ids;
+        std::vector<triton::usize> worklist;
+
+        this->refreshChangedExpressions();
+        for (const auto& pco : this->pathConstraints) {
+          std::vector<triton::usize> references;
+          std::vector<triton::usize> variables;
+
+          this->getAstDependencies(pco.getTakenPathConstraintAst(), references, variables);
+          for (triton::usize rid : references) {
+            if (ids.insert(rid).second)
+              worklist.push_back(rid);
+          }
+        }
+
+        while (!worklist.empty()) {
+          triton::usize id = worklist.back();
+          worklist.pop_back();
+
+          const std::vector<triton::usize>* references = this->expressionReferences.find(id);
+          if (references == nullptr)
+            continue;
+
+          for (triton::usize rid : *references) {
+            if (ids.insert(rid).second)
+              worklist.push_back(rid);
+          }
+        }
+
+        return ids;
+      }
+
+
+      /* Sets the memory budget */
+      void SymbolicEngine::setMemoryBudget(triton::usize bytes) {
+        this->memoryBudget  = bytes;
+        this->budgetBackoff = 0;
+      }
+
+
+      /* Returns the memory budget */
+      triton::usize SymbolicEngine::getMemoryBudget(void) const {
+        return this->memoryBudget;
+      }
+
+
+      /* Returns the estimated memory used by the symbolic expressions */
+      triton::usize SymbolicEngine::getEstimatedMemory(void) const {
+        return this->estimatedMemory;
+      }
+
+
+      /* Returns the statistics of the memory budget eviction */
+      const EvictionStatistics& SymbolicEngine::getEvictionStatistics(void) const {
+        return this->evictionStats;
+      }
+
+
+      /* Concretizes the least recently used registers and memory cells until the budget is met */
+      void SymbolicEngine::enforceMemoryBudget(void) {
+        /* A holder of a symbolic expression: a register (isMemory == false) or a memory cell */
+        struct Holder {
+          triton::usize lastUse;
+          bool isMemory;
+          triton::uint64 location;
+        };
+
+        /* A symbolic input is an expression of a bare symbolic variable (see convert*ToSymbolicVariable) */
+        auto isSymbolicInput = [](const SharedSymbolicExpression& se) {
+          triton::ast::AbstractNode* node = se->getAst().get();
+          if (node->getType() == triton::ast::EXTRACT_NODE)
+            node = node->getChildren()[2].get();
+          else if (node->getType() == triton::ast::ZX_NODE)
+            node = node->getChildren()[1].get();
+          return node->getType() == triton::ast::VARIABLE_NODE;
+        };
+
+        if (this->memoryBudget == 0 || this->estimatedMemory <= this->memoryBudget) {
+          this->budgetBackoff = 0;
+          return;
+        }
+
+        /* The last pass could not meet the budget, wait for the usage to change */
+        if (this->budgetBackoff != 0 && this->estimatedMemory >= this->budgetBackoff && this->estimatedMemory - this->budgetBackoff < std::max<triton::usize>(1, this->memoryBudget / 8))
+          return;
+        this->budgetBackoff = 0;
+
+        /* Dead expressions may be enough */
+        triton::usize expressions = this->symbolicExpressions.size();
+        triton::usize memory      = this->estimatedMemory;
+
+        this->removeExpiredExpressions();
+        if (this->estimatedMemory <= this->memoryBudget) {
+          this->evictionStats.releasedExpressions += (expressions - this->symbolicExpressions.size());
+          this->evictionStats.releasedBytes       += (memory - this->estimatedMemory);
+          return;
+        }
+
+        this->evictionStats.passes++;
+
+        /* The path predicate is never weakened: its expressions are kept symbolic */
+        std::unordered_set<triton::usize> protectedIds = this->getPathConstraintsExpressionIds();
+        std::vector<Holder> holders;
+
+        for (triton::uint32 i = 0; i < this->numberOfRegisters; i++) {
+          const SharedSymbolicExpression& se = this->symbolicReg[i];
+          if (se == nullptr || protectedIds.find(se->getId()) != protectedIds.end() || isSymbolicInput(se))
+            continue;
+          const ExpressionUsage* usage = this->expressionUsages.find(se->getId());
+          holders.push_back(Holder{(usage != nullptr) ? usage->lastUse : 0, false, i});
+        }
+
+        for (const auto& kv : this->memoryReference) {
+          const SharedSymbolicExpression& se = kv.second;
+          if (se == nullptr || protectedIds.find(se->getId()) != protectedIds.end() || isSymbolicInput(se))
+            continue;
+          const ExpressionUsage* usage = this->expressionUsages.find(se->getId());
+          holders.push_back(Holder{(usage != nullptr) ? usage->lastUse : 0, true, kv.first});
+        }
+
+        std::sort(holders.begin(), holders.end(), [](const Holder& a, const Holder& b) { return a.lastUse < b.lastUse; });
+
+        /* Evict by batches down to 3/4 of the budget to not run a pass per instruction */
+        triton::usize target = this->memoryBudget - (this->memoryBudget / 4);
+        triton::usize batch  = std::max<triton::usize>(1, holders.size() / 8);
+        triton::usize index  = 0;
+
+        while (index < holders.size() && this->estimatedMemory > target) {
+          for (triton::usize end = std::min(holders.size(), index + batch); index < end; index++) {
+            if (holders[index].isMemory) {
+              this->concretizeMemory(holders[index].location);
+              this->evictionStats.evictedMemoryCells++;
+            }
+            else {
+              this->symbolicReg[holders[index].location] = nullptr;
+              this->evictionStats.evictedRegisters++;
+            }
+          }
+          this->removeExpiredExpressions();
+        }
+
+        /* Only the path predicate and the symbolic inputs are left */
+        if (this->estimatedMemory > this->memoryBudget)
+          this->budgetBackoff = this->estimatedMemory;
+
+        this->evictionStats.releasedExpressions += (expressions - this->symbolicExpressions.size());
+        this->evictionStats.releasedBytes       += (memory - this->estimatedMemory);
+      }
+
+
+      /* Returns a view on the tainted symbolic expressions */
+      SymbolicExpressionView<std::set<triton::usize>> SymbolicEngine::getTaintedSymbolicExpressionsView(void) const {
+        return SymbolicExpressionView<std::set<triton::usize>>(&this->symbolicExpressions, &this->taintedExpressions, true);
+      }
+
+
+      /* Returns a view on the symbolic expressions created by the instructions at an address */
+      SymbolicExpressionView<std::vector<triton::usize>> SymbolicEngine::getSymbolicExpressionsAtAddress(triton::uint64 addr) const {
+        auto it = this->addressExpressions.find(addr);
+        if (it == this->addressExpressions.end())
+          return SymbolicExpressionView<std::vector<triton::usize>>(&this->symbolicExpressions, nullptr);
+        return SymbolicExpressionView<std::vector<triton::usize>>(&this->symbolicExpressions, &it->second);
+      }
+
+
+      /* Returns a view on the symbolic expressions of a kind */
+      SymbolicExpressionView<std::vector<triton::usize>> SymbolicEngine::getSymbolicExpressionsOfKind(triton::engines::symbolic::expression_e kind) const {
+        auto it = this->kindExpressions.find(kind);
+        if (it == this->kindExpressions.end())
+          return SymbolicExpressionView<std::vector<triton::usize>>(&this->symbolicExpressions, nullptr);
+        return SymbolicExpressionView<std::vector<triton::usize>>(&this->symbolicExpressions, &it->second);
+      }
+
+
+      /* Indexes the symbolic expressions of a processed instruction */
+      void SymbolicEngine::indexInstructionExpressions(const triton::arch::Instruction& inst) {
+        if (inst.symbolicExpressions.empty())
+          return;
+
+        auto& ids = this->addressExpressions[inst.getAddress()];
+        for (const auto& se : inst.symbolicExpressions) {
+          ids.push_back(se->getId());
+          this->updateTaintIndex(se);
+        }
+
+        this->addIndexedIds(inst.symbolicExpressions.size());
+      }
+
+
+      /* Updates the taint index of an expression */
+      void SymbolicEngine::updateTaintIndex(const SharedSymbolicExpression& expr) {
+        if (expr->isTainted)
+          this->taintedExpressions.insert(expr->getId());
+        else
+          this->taintedExpressions.erase(expr->getId());
+      }
+
+
+      /* Returns a list which contains all tainted expressions */
+      std::list<SharedSymbolicExpression> SymbolicEngine::getTaintedSymbolicExpressions(void) const {
+        std::list<SharedSymbolicExpression> taintedExprs;
+
+        for (auto it = this->taintedExpressions.begin(); it != this->taintedExpressions.end();) {
+          const WeakSymbolicExpression* expr = this->symbolicExpressions.find(*it);
+          SharedSymbolicExpression sp = (expr != nullptr) ? expr->lock() : nullptr;
+
+          /* Prune the dead ids while walking the index */
+          if (sp == nullptr) {
+            it = this->taintedExpressions.erase(it);
+            continue;
+          }
+
+          if (sp->isTainted)
+            taintedExprs.push_back(sp);
+          it++;
+        }
 
         return taintedExprs;
       }
@@ -453,6 +1045,7 @@ namespace triton {
            this->setConcreteVariableValue(symVar, expression->getAst()->evaluate());
 
         expression->setAst(tmp);
+        this->recordExpression(expression);
 
         return symVar;
       }
@@ -496,6 +1089,7 @@ namespace triton {
           }
           else {
             se->setAst(tmp);
+            this->recordExpression(se);
           }
           /* Defines the origin of the expression */
           se->setOriginMemory(triton::arch::MemoryAccess(memAddr+index, BYTE_SIZE));
@@ -536,6 +1130,7 @@ namespace triton {
         } else {
           /* Set the AST node */
           expression->setAst(tmp);
+          this->recordExpression(expression);
         }
 
         return symVar;
@@ -550,8 +1145,8 @@ namespace triton {
         if (symVar == nullptr)
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::newSymbolicVariable(): Cannot allocate a new symbolic variable");
 
-        this->symbolicVariables[uniqueId] = symVar;
-        return this->symbolicVariables[uniqueId];
+        this->symbolicVariableNames[symVar->getName()] = uniqueId;
+        return this->symbolicVariables.insert(uniqueId, symVar);
       }
 
 
@@ -678,6 +1273,7 @@ namespace triton {
           /* Check if the memory cell is already symbolic */
           if (symMem != nullptr) {
             tmp = this->astCtxt.reference(symMem);
+            this->touchExpression(symMem->getId());
             opVec.push_back(this->astCtxt.extract((BYTE_SIZE_BIT - 1), 0, tmp));
           }
           /* Otherwise, use the concerte value */
@@ -736,6 +1332,7 @@ namespace triton {
         /* Check if the register is already symbolic */
         if (const SharedSymbolicExpression& symReg = this->getSymbolicRegister(reg)) {
           node = this->astCtxt.extract(high, low, this->astCtxt.reference(symReg));
+          this->touchExpression(symReg->getId());
         }
         /* Otherwise, use the concerte value */
         else {
@@ -995,10 +1592,10 @@ namespace triton {
 
       /* Returns true if the symbolic expression ID exists */
       bool SymbolicEngine::isSymbolicExpressionIdExists(triton::usize symExprId) const {
-        auto it = this->symbolicExpressions.find(symExprId);
+        const WeakSymbolicExpression* expr = this->symbolicExpressions.find(symExprId);
 
-        if (it != this->symbolicExpressions.end())
-          return (it->second.use_count() > 0);
+        if (expr != nullptr)
+          return (expr->use_count() > 0);
 
         return false;
       }
@@ -1099,12 +1696,12 @@ namespace triton {
 
 
       const triton::uint512& SymbolicEngine::getConcreteVariableValue(const SharedSymbolicVariable& symVar) const {
-        return this->astCtxt.getVariableValue(symVar->getName());
+        return this->astCtxt.getVariableValue(symVar->getId());
       }
 
 
       void SymbolicEngine::setConcreteVariableValue(const SharedSymbolicVariable& symVar, const triton::uint512& value) {
-        this->astCtxt.updateVariable(symVar->getName(), value);
+        this->astCtxt.updateVariable(symVar, value);
       }
 
     }; /* symbolic namespace */
@@ -34,6 +34,7 @@ namespace triton {
 
       SymbolicExpression::SymbolicExpression(const SymbolicExpression& other) {
         this->ast            = other.ast;
+        this->astChanges     = other.astChanges;
         this->comment        = other.comment;
         this->id             = other.id;
         this->isTainted      = other.isTainted;
@@ -45,6 +46,7 @@ namespace triton {
 
       SymbolicExpression& SymbolicExpression::operator=(const SymbolicExpression& other) {
         this->ast            = other.ast;
+        this->astChanges     = other.astChanges;
         this->comment        = other.comment;
         this->id             = other.id;
         this->isTainted      = other.isTainted;
@@ -158,6 +160,15 @@ namespace triton {
         }
         this->ast = node;
         this->ast->init();
+
+        /* Let the symbolic engine refresh its def-use graph */
+        if (auto changes = this->astChanges.lock())
+          changes->push_back(this->id);
+      }
+
+
+      void SymbolicExpression::setAstChanges(const std::shared_ptr<std::vector<triton::usize>>& changes) {
+        this->astChanges = changes;
       }
 
 
@@ -0,0 +1,402 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <bitset>
+#include <cstring>
+
+#include <triton/shadowMemory.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace taint {
+
+      /* The number of bits set in a word */
+      static triton::uint32 popcount(triton::uint64 word) {
+        return static_cast<triton::uint32>(std::bitset<64>(word).count());
+      }
+
+
+      /* The mask of the bits [low, low + size) of a word, size in [1, 64] */
+      static triton::uint64 wordMask(triton::uint32 low, triton::uint32 size) {
+        triton::uint64 mask = (size == 64) ? ~0ULL : ((1ULL << size) - 1);
+        return mask << low;
+      }
+
+
+      /* The number of trailing zero bits of a word, 64 if the word is null */
+      static triton::uint32 countTrailingZeros(triton::uint64 word) {
+        if (word == 0)
+          return 64;
+        return popcount((word & (~word + 1)) - 1);
+      }
+
+
+      /* Appends a range, merged with the last one if they are contiguous */
+      static void appendRange(std::vector<std::pair<triton::uint64, triton::uint64>>& ranges, triton::uint64 addr, triton::uint64 size) {
+        if (!ranges.empty() && ranges.back().first + ranges.back().second == addr)
+          ranges.back().second += size;
+        else
+          ranges.push_back(std::make_pair(addr, size));
+      }
+
+
+      const triton::uint32 ShadowMemory::PAGE_BITS;
+      const triton::uint32 ShadowMemory::TABLE_BITS;
+      const triton::uint64 ShadowMemory::PAGE_SIZE;
+      const triton::uint64 ShadowMemory::TABLE_PAGES;
+      const triton::uint64 ShadowMemory::TABLE_SIZE;
+
+
+      ShadowMemory::ShadowMemory()
+        : bytes(0),
+          labelled(0) {
+      }
+
+
+      ShadowMemory::ShadowMemory(const ShadowMemory& other)
+        : bytes(0),
+          labelled(0) {
+        *this = other;
+      }
+
+
+      ShadowMemory& ShadowMemory::operator=(const ShadowMemory& other) {
+        if (this == &other)
+          return *this;
+
+        this->tables.clear();
+        for (const auto& item : other.tables) {
+          std::unique_ptr<Table> table(new Table());
+          table->count = item.second->count;
+          for (triton::uint64 index = 0; index < TABLE_PAGES; index++) {
+            if (item.second->pages[index])
+              table->pages[index].reset(new Page(*item.second->pages[index]));
+          }
+          this->tables[item.first] = std::move(table);
+        }
+
+        this->bytes    = other.bytes;
+        this->labelled = other.labelled;
+        return *this;
+      }
+
+
+      const ShadowMemory::Page* ShadowMemory::getPage(triton::uint64 addr) const {
+        auto it = this->tables.find(addr >> (PAGE_BITS + TABLE_BITS));
+        if (it == this->tables.end())
+          return nullptr;
+        return it->second->pages[(addr >> PAGE_BITS) & (TABLE_PAGES - 1)].get();
+      }
+
+
+      ShadowMemory::Page* ShadowMemory::getPage(triton::uint64 addr) {
+        auto it = this->tables.find(addr >> (PAGE_BITS + TABLE_BITS));
+        if (it == this->tables.end())
+          return nullptr;
+        return it->second->pages[(addr >> PAGE_BITS) & (TABLE_PAGES - 1)].get();
+      }
+
+
+      triton::uint64 ShadowMemory::getMissingSize(triton::uint64 addr, triton::uint64 size) const {
+        if (this->tables.find(addr >> (PAGE_BITS + TABLE_BITS)) != this->tables.end())
+          return 0;
+        return std::min<triton::uint64>(size, TABLE_SIZE - (addr & (TABLE_SIZE - 1)));
+      }
+
+
+      void ShadowMemory::setInPage(triton::uint64 addr, triton::uint64 size, bool flag) {
+        triton::uint64 key   = addr >> (PAGE_BITS + TABLE_BITS);
+        triton::uint64 index = (addr >> PAGE_BITS) & (TABLE_PAGES - 1);
+        triton::uint64 start = addr & (PAGE_SIZE - 1);
+        triton::uint64 end   = start + size;
+
+        auto it = this->tables.find(key);
+        if (it == this->tables.end()) {
+          if (!flag)
+            return;
+          std::unique_ptr<Table> table(new Table());
+          table->count = 0;
+          it = this->tables.insert(std::make_pair(key, std::move(table))).first;
+        }
+
+        Table* table = it->second.get();
+        std::unique_ptr<Page>& page = table->pages[index];
+        if (!page) {
+          if (!flag)
+            return;
+          page.reset(new Page());
+          std::memset(page->bits, 0, sizeof(page->bits));
+          page->count = 0;
+          table->count++;
+        }
+
+        /* Whole words are updated at once */
+        for (triton::uint64 offset = start; offset < end;) {
+          triton::uint32 low   = static_cast<triton::uint32>(offset & 63);
+          triton::uint32 count = static_cast<triton::uint32>(std::min<triton::uint64>(64 - low, end - offset));
+          triton::uint64 mask  = wordMask(low, count);
+          triton::uint64& word = page->bits[offset >> 6];
+
+          if (flag) {
+            triton::uint32 added = popcount(mask & ~word);
+            page->count += added;
+            this->bytes += added;
+            word |= mask;
+          }
+          else {
+            triton::uint32 removed = popcount(mask & word);
+            page->count -= removed;
+            this->bytes -= removed;
+            word &= ~mask;
+          }
+
+          offset += count;
+        }
+
+        /* A cleared byte loses its label */
+        if (!flag && !page->labels.empty())
+          std::fill(page->labels.begin() + start, page->labels.begin() + end, 0);
+
+        /* A page and a table only exist while they hold set bytes */
+        if (page->count == 0) {
+          if (!page->labels.empty())
+            this->labelled--;
+          page.reset();
+          if (--table->count == 0)
+            this->tables.erase(it);
+        }
+      }
+
+
+      bool ShadowMemory::isSetInPage(const Page* page, triton::uint64 addr, triton::uint64 size) {
+        triton::uint64 start = addr & (PAGE_SIZE - 1);
+        triton::uint64 end   = start + size;
+
+        for (triton::uint64 offset = start; offset < end;) {
+          triton::uint32 low   = static_cast<triton::uint32>(offset & 63);
+          triton::uint32 count = static_cast<triton::uint32>(std::min<triton::uint64>(64 - low, end - offset));
+          if (page->bits[offset >> 6] & wordMask(low, count))
+            return true;
+          offset += count;
+        }
+
+        return false;
+      }
+
+
+      std::vector<std::pair<triton::uint64, triton::uint64>> ShadowMemory::getTableRanges(triton::uint64 addr, triton::uint64 size) const {
+        std::vector<std::pair<triton::uint64, triton::uint64>> ranges;
+
+        for (const auto& item : this->tables) {
+          triton::uint64 base   = (item.first << (PAGE_BITS + TABLE_BITS));
+          triton::uint64 last   = base + (TABLE_SIZE - 1);
+          triton::uint64 offset = base - addr; /* The offset of the table into the range, modulo 2^64 */
+
+          if (base < addr && addr <= last) {
+            /* The range starts inside the table, and may wrap around into its lower part */
+            ranges.push_back(std::make_pair(addr, std::min<triton::uint64>(size, (last - addr) + 1)));
+            if (offset < size)
+              ranges.push_back(std::make_pair(base, std::min<triton::uint64>(size - offset, addr - base)));
+          }
+          else if (offset < size) {
+            ranges.push_back(std::make_pair(base, std::min<triton::uint64>(size - offset, TABLE_SIZE)));
+          }
+        }
+
+        return ranges;
+      }
+
+
+      void ShadowMemory::set(triton::uint64 addr, triton::uint64 size, bool flag) {
+        /* A large clear only visits the existing tables */
+        if (flag == false && (size / TABLE_SIZE) > this->tables.size()) {
+          for (const auto& range : this->getTableRanges(addr, size))
+            this->setPages(range.first, range.second, flag);
+          return;
+        }
+
+        this->setPages(addr, size, flag);
+      }
+
+
+      void ShadowMemory::setPages(triton::uint64 addr, triton::uint64 size, bool flag) {
+        while (size) {
+          triton::uint64 chunk = flag ? 0 : this->getMissingSize(addr, size);
+
+          /* There is nothing to clear in a missing table */
+          if (chunk == 0) {
+            chunk = std::min<triton::uint64>(size, PAGE_SIZE - (addr & (PAGE_SIZE - 1)));
+            this->setInPage(addr, chunk, flag);
+          }
+
+          addr += chunk;
+          size -= chunk;
+        }
+      }
+
+
+      bool ShadowMemory::isSet(triton::uint64 addr, triton::uint64 size) const {
+        if (this->bytes == 0)
+          return false;
+
+        /* A large check only visits the existing tables */
+        if ((size / TABLE_SIZE) > this->tables.size()) {
+          for (const auto& range : this->getTableRanges(addr, size)) {
+            if (this->isSetPages(range.first, range.second))
+              return true;
+          }
+          return false;
+        }
+
+        return this->isSetPages(addr, size);
+      }
+
+
+      bool ShadowMemory::isSetPages(triton::uint64 addr, triton::uint64 size) const {
+        while (size) {
+          triton::uint64 chunk = this->getMissingSize(addr, size);
+
+          /* There is nothing to check in a missing table */
+          if (chunk == 0) {
+            chunk = std::min<triton::uint64>(size, PAGE_SIZE - (addr & (PAGE_SIZE - 1)));
+            const Page* page = this->getPage(addr);
+            if (page != nullptr && ShadowMemory::isSetInPage(page, addr, chunk))
+              return true;
+          }
+
+          addr += chunk;
+          size -= chunk;
+        }
+
+        return false;
+      }
+
+
+      std::set<triton::uint64> ShadowMemory::getAddresses(void) const {
+        std::set<triton::uint64> addresses;
+
+        for (const auto& item : this->tables) {
+          for (triton::uint64 index = 0; index < TABLE_PAGES; index++) {
+            const Page* page = item.second->pages[index].get();
+            if (page == nullptr)
+              continue;
+
+            triton::uint64 base = (((item.first << TABLE_BITS) | index) << PAGE_BITS);
+            for (triton::uint64 word = 0; word < PAGE_SIZE / 64; word++) {
+              for (triton::uint64 bits = page->bits[word]; bits; bits &= bits - 1)
+                addresses.insert(base + word * 64 + popcount((bits & (~bits + 1)) - 1));
+            }
+          }
+        }
+
+        return addresses;
+      }
+
+
+      std::vector<std::pair<triton::uint64, triton::uint64>> ShadowMemory::getRanges(void) const {
+        std::vector<std::pair<triton::uint64, triton::uint64>> ranges;
+        std::vector<triton::uint64> keys;
+
+        /* The tables are visited by address */
+        keys.reserve(this->tables.size());
+        for (const auto& item : this->tables)
+          keys.push_back(item.first);
+        std::sort(keys.begin(), keys.end());
+
+        for (triton::uint64 key : keys) {
+          const Table* table = this->tables.at(key).get();
+          for (triton::uint64 index = 0; index < TABLE_PAGES; index++) {
+            const Page* page = table->pages[index].get();
+            if (page == nullptr)
+              continue;
+
+            triton::uint64 base = (((key << TABLE_BITS) | index) << PAGE_BITS);
+            if (page->count == PAGE_SIZE) {
+              appendRange(ranges, base, PAGE_SIZE);
+              continue;
+            }
+
+            /* The runs of set bits of each word */
+            for (triton::uint64 word = 0; word < PAGE_SIZE / 64; word++) {
+              triton::uint64 bits     = page->bits[word];
+              triton::uint32 position = 0;
+              while (bits) {
+                triton::uint32 skip = countTrailingZeros(bits);
+                bits >>= skip;
+                position += skip;
+                triton::uint32 run = countTrailingZeros(~bits);
+                appendRange(ranges, base + word * 64 + position, run);
+                position += run;
+                bits = (run == 64) ? 0 : (bits >> run);
+              }
+            }
+          }
+        }
+
+        return ranges;
+      }
+
+
+      void ShadowMemory::setLabel(triton::uint64 addr, triton::uint64 size, triton::uint32 label) {
+        while (size) {
+          triton::uint64 start = addr & (PAGE_SIZE - 1);
+          triton::uint64 chunk = std::min<triton::uint64>(size, PAGE_SIZE - start);
+          Page* page = this->getPage(addr);
+
+          /* Only the set bytes are labelled */
+          if (page != nullptr && (label != 0 || !page->labels.empty())) {
+            if (page->labels.empty()) {
+              page->labels.resize(PAGE_SIZE, 0);
+              this->labelled++;
+            }
+            for (triton::uint64 offset = start; offset < start + chunk; offset++) {
+              if (page->bits[offset >> 6] & (1ULL << (offset & 63)))
+                page->labels[offset] = label;
+            }
+          }
+
+          addr += chunk;
+          size -= chunk;
+        }
+      }
+
+
+      triton::uint32 ShadowMemory::getLabel(triton::uint64 addr) const {
+        const Page* page = this->getPage(addr);
+        if (page == nullptr || page->labels.empty())
+          return 0;
+        return page->labels[addr & (PAGE_SIZE - 1)];
+      }
+
+
+      bool ShadowMemory::hasLabels(void) const {
+        return this->labelled != 0;
+      }
+
+
+      triton::usize ShadowMemory::getSize(void) const {
+        return this->bytes;
+      }
+
+
+      bool ShadowMemory::isEmpty(void) const {
+        return this->bytes == 0;
+      }
+
+
+      void ShadowMemory::clear(void) {
+        this->tables.clear();
+        this->bytes    = 0;
+        this->labelled = 0;
+      }
+
+    }; /* taint namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -5,6 +5,9 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
+
+#include <triton/cpuSize.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/taintEngine.hpp>
 
@@ -32,6 +35,8 @@ namespace triton {
         this->symbolicEngine   = other.symbolicEngine;
         this->taintedMemory    = other.taintedMemory;
         this->taintedRegisters = other.taintedRegisters;
+        this->labels           = other.labels;
+        this->registerLabels   = other.registerLabels;
       }
 
 
@@ -42,6 +47,8 @@ namespace triton {
         this->symbolicEngine   = other.symbolicEngine;
         this->taintedMemory    = other.taintedMemory;
         this->taintedRegisters = other.taintedRegisters;
+        this->labels           = other.labels;
+        this->registerLabels   = other.registerLabels;
         return *this;
       }
 
@@ -56,9 +63,128 @@ namespace triton {
       }
 
 
+      bool TaintEngine::isLabelling(void) const {
+        return this->modes.isModeEnabled(triton::modes::TAINT_LABELS);
+      }
+
+
+      /* The pointer registers spread their labels like their taint */
+      triton::uint32 TaintEngine::getMemoryLabelSet(const triton::arch::MemoryAccess& mem) const {
+        triton::uint64 addr = mem.getAddress();
+        triton::uint32 size = mem.getSize();
+        triton::uint32 set  = 0;
+
+        if (this->taintedMemory.hasLabels()) {
+          for (triton::uint32 index = 0; index < size; index++)
+            set = this->labels.merge(set, this->getMemoryLabelSet(addr + index));
+        }
+
+        return this->labels.merge(set, this->getPointerLabelSet(mem));
+      }
+
+
+      triton::uint32 TaintEngine::getPointerLabelSet(const triton::arch::MemoryAccess& mem) const {
+        triton::uint32 set = 0;
+
+        if (this->registerLabels.empty() || !this->modes.isModeEnabled(triton::modes::TAINT_THROUGH_POINTERS))
+          return 0;
+
+        set = this->labels.merge(set, this->getRegisterLabelSet(mem.getConstBaseRegister()));
+        set = this->labels.merge(set, this->getRegisterLabelSet(mem.getConstIndexRegister()));
+        set = this->labels.merge(set, this->getRegisterLabelSet(mem.getConstSegmentRegister()));
+
+        return set;
+      }
+
+
+      triton::uint32 TaintEngine::getMemoryLabelSet(triton::uint64 addr) const {
+        return this->taintedMemory.getLabel(addr);
+      }
+
+
+      /* The labels live in the shadow pages of the tainted bytes, untainting a byte drops its label */
+      void TaintEngine::setMemoryLabelSet(triton::uint64 addr, triton::uint32 size, triton::uint32 set) {
+        this->taintedMemory.setLabel(addr, size, set);
+      }
+
+
+      triton::uint32 TaintEngine::getRegisterLabelSet(const triton::arch::Register& reg) const {
+        triton::uint32 set = 0;
+
+        auto it = this->registerLabels.find(reg.getParent());
+        if (it == this->registerLabels.end())
+          return 0;
+
+        const std::vector<triton::uint32>& bytes = it->second;
+        triton::uint32 high = std::min<triton::uint32>((reg.getHigh() / BYTE_SIZE_BIT) + 1, static_cast<triton::uint32>(bytes.size()));
+        for (triton::uint32 index = (reg.getLow() / BYTE_SIZE_BIT); index < high; index++)
+          set = this->labels.merge(set, bytes[index]);
+
+        return set;
+      }
+
+
+      void TaintEngine::setRegisterLabelSet(const triton::arch::Register& reg, triton::uint32 set) {
+        triton::uint32 low  = (reg.getLow() / BYTE_SIZE_BIT);
+        triton::uint32 high = (reg.getHigh() / BYTE_SIZE_BIT) + 1;
+
+        auto it = this->registerLabels.find(reg.getParent());
+        if (it == this->registerLabels.end()) {
+          if (set == 0)
+            return;
+          it = this->registerLabels.insert(std::make_pair(reg.getParent(), std::vector<triton::uint32>())).first;
+        }
+
+        std::vector<triton::uint32>& bytes = it->second;
+        if (set != 0 && bytes.size() < high)
+          bytes.resize(high, 0);
+
+        for (triton::uint32 index = low; index < high && index < bytes.size(); index++)
+          bytes[index] = set;
+
+        /* A register is only kept while one of its bytes is labelled */
+        if (set == 0 && std::all_of(bytes.begin(), bytes.end(), [](triton::uint32 item) { return item == 0; }))
+          this->registerLabels.erase(it);
+      }
+
+
+      triton::uint64 TaintEngine::getRegisterMask(const triton::arch::Register& reg) {
+        triton::uint32 low   = (reg.getLow() / BYTE_SIZE_BIT);
+        triton::uint32 count = (reg.getHigh() / BYTE_SIZE_BIT) - low + 1;
+        triton::uint64 mask  = (count >= 64) ? ~0ULL : ((1ULL << count) - 1);
+        return mask << low;
+      }
+
+
+      /* Writes the taint of a register like the symbolic engine writes its value */
+      bool TaintEngine::writeRegister(const triton::arch::Register& regDst, bool flag, triton::uint32 set) {
+        /* A write of 32 bits or more zeroes the upper bytes of the parent register (e.g. eax into rax) */
+        if (regDst.getSize() >= DWORD_SIZE)
+          this->untaintRegister(this->cpu.getParentRegister(regDst));
+
+        if (flag == !TAINTED) {
+          this->untaintRegister(regDst);
+          return !TAINTED;
+        }
+
+        /* Without the TAINT_LABELS mode the labels are not propagated, but an assignment (set == 0) still drops the old ones */
+        this->taintRegister(regDst);
+        if (this->isLabelling() || set == 0)
+          this->setRegisterLabelSet(regDst, set);
+
+        return TAINTED;
+      }
+
+
       /* Returns the tainted addresses */
-      const std::set<triton::uint64>& TaintEngine::getTaintedMemory(void) const {
-        return this->taintedMemory;
+      std::set<triton::uint64> TaintEngine::getTaintedMemory(void) const {
+        return this->taintedMemory.getAddresses();
+      }
+
+
+      /* Returns the tainted ranges of memory */
+      std::vector<std::pair<triton::uint64, triton::uint64>> TaintEngine::getTaintedMemoryRanges(void) const {
+        return this->taintedMemory.getRanges();
       }
 
 
@@ -66,8 +192,8 @@ namespace triton {
       std::set<const triton::arch::Register*> TaintEngine::getTaintedRegisters(void) const {
         std::set<const triton::arch::Register*> res;
 
-        for (auto id : this->taintedRegisters)
-          res.insert(&this->cpu.getRegister(id));
+        for (const auto& item : this->taintedRegisters)
+          res.insert(&this->cpu.getRegister(item.first));
 
         return res;
       }
@@ -75,13 +201,8 @@ namespace triton {
 
       /* Returns true of false if the memory address is currently tainted */
       bool TaintEngine::isMemoryTainted(const triton::arch::MemoryAccess& mem, bool mode) const {
-        triton::uint64 addr = mem.getAddress();
-        triton::uint32 size = mem.getSize();
-
-        for (triton::uint32 index = 0; index < size; index++) {
-          if (this->taintedMemory.find(addr+index) != this->taintedMemory.end())
-            return TAINTED;
-        }
+        if (this->taintedMemory.isSet(mem.getAddress(), mem.getSize()))
+          return TAINTED;
 
         /* Spread the taint through pointers if the mode is enabled */
         if (mode && this->modes.isModeEnabled(triton::modes::TAINT_THROUGH_POINTERS)) {
@@ -99,10 +220,17 @@ namespace triton {
 
       /* Returns true of false if the address is currently tainted */
       bool TaintEngine::isMemoryTainted(triton::uint64 addr, triton::uint32 size) const {
-        for (triton::uint32 index = 0; index < size; index++) {
-          if (this->taintedMemory.find(addr+index) != this->taintedMemory.end())
-            return TAINTED;
-        }
+        if (this->taintedMemory.isSet(addr, size))
+          return TAINTED;
+
+        return !TAINTED;
+      }
+
+
+      /* Returns true of false if the range of memory is currently tainted */
+      bool TaintEngine::isMemoryRangeTainted(triton::uint64 addr, triton::uint64 size) const {
+        if (this->taintedMemory.isSet(addr, size))
+          return TAINTED;
 
         return !TAINTED;
       }
@@ -110,7 +238,8 @@ namespace triton {
 
       /* Returns true of false if the register is currently tainted */
       bool TaintEngine::isRegisterTainted(const triton::arch::Register& reg) const {
-        if (this->taintedRegisters.find(reg.getParent()) != this->taintedRegisters.end())
+        auto it = this->taintedRegisters.find(reg.getParent());
+        if (it != this->taintedRegisters.end() && (it->second & this->getRegisterMask(reg)))
           return TAINTED;
 
         return !TAINTED;
@@ -133,7 +262,7 @@ namespace triton {
       bool TaintEngine::taintRegister(const triton::arch::Register& reg) {
         if (!this->isEnabled())
           return this->isRegisterTainted(reg);
-        this->taintedRegisters.insert(reg.getParent());
+        this->taintedRegisters[reg.getParent()] |= this->getRegisterMask(reg);
 
         return TAINTED;
       }
@@ -143,7 +272,16 @@ namespace triton {
       bool TaintEngine::untaintRegister(const triton::arch::Register& reg) {
         if (!this->isEnabled())
           return this->isRegisterTainted(reg);
-        this->taintedRegisters.erase(reg.getParent());
+
+        auto it = this->taintedRegisters.find(reg.getParent());
+        if (it != this->taintedRegisters.end()) {
+          it->second &= ~this->getRegisterMask(reg);
+          if (it->second == 0)
+            this->taintedRegisters.erase(it);
+        }
+
+        if (!this->registerLabels.empty())
+          this->setRegisterLabelSet(reg, 0);
 
         return !TAINTED;
       }
@@ -193,14 +331,10 @@ namespace triton {
 
       /* Taint the memory */
       bool TaintEngine::taintMemory(const triton::arch::MemoryAccess& mem) {
-        triton::uint64 addr = mem.getAddress();
-        triton::uint32 size = mem.getSize();
-
         if (!this->isEnabled())
           return this->isMemoryTainted(mem);
 
-        for (triton::uint32 index = 0; index < size; index++)
-          this->taintedMemory.insert(addr+index);
+        this->taintedMemory.set(mem.getAddress(), mem.getSize(), TAINTED);
 
         return TAINTED;
       }
@@ -210,21 +344,73 @@ namespace triton {
       bool TaintEngine::taintMemory(triton::uint64 addr) {
         if (!this->isEnabled())
           return this->isMemoryTainted(addr);
-        this->taintedMemory.insert(addr);
+        this->taintedMemory.set(addr, 1, TAINTED);
         return TAINTED;
       }
 
 
-      /* Untaint the memory */
-      bool TaintEngine::untaintMemory(const triton::arch::MemoryAccess& mem) {
+      /* Taint the range of memory */
+      bool TaintEngine::taintMemoryRange(triton::uint64 addr, triton::uint64 size) {
+        if (!this->isEnabled())
+          return this->isMemoryRangeTainted(addr, size);
+        this->taintedMemory.set(addr, size, TAINTED);
+        return TAINTED;
+      }
+
+
+      /* Taint the memory and label its bytes */
+      bool TaintEngine::taintMemoryWithLabel(const triton::arch::MemoryAccess& mem, triton::uint32 label) {
         triton::uint64 addr = mem.getAddress();
         triton::uint32 size = mem.getSize();
 
         if (!this->isEnabled())
           return this->isMemoryTainted(mem);
 
+        this->taintMemory(mem);
+        triton::uint32 singleton = this->labels.getSingleton(label);
         for (triton::uint32 index = 0; index < size; index++)
-          this->taintedMemory.erase(addr+index);
+          this->setMemoryLabelSet(addr + index, 1, this->labels.merge(this->getMemoryLabelSet(addr + index), singleton));
+
+        return TAINTED;
+      }
+
+
+      /* Taint the register and label it */
+      bool TaintEngine::taintRegisterWithLabel(const triton::arch::Register& reg, triton::uint32 label) {
+        if (!this->isEnabled())
+          return this->isRegisterTainted(reg);
+
+        this->taintRegister(reg);
+        triton::uint32 singleton = this->labels.getSingleton(label);
+        triton::uint32 high      = (reg.getHigh() / BYTE_SIZE_BIT) + 1;
+
+        std::vector<triton::uint32>& bytes = this->registerLabels[reg.getParent()];
+        if (bytes.size() < high)
+          bytes.resize(high, 0);
+
+        for (triton::uint32 index = (reg.getLow() / BYTE_SIZE_BIT); index < high; index++)
+          bytes[index] = this->labels.merge(bytes[index], singleton);
+
+        return TAINTED;
+      }
+
+
+      std::vector<triton::uint32> TaintEngine::getMemoryTaintLabels(const triton::arch::MemoryAccess& mem) const {
+        return this->labels.getLabels(this->getMemoryLabelSet(mem));
+      }
+
+
+      std::vector<triton::uint32> TaintEngine::getRegisterTaintLabels(const triton::arch::Register& reg) const {
+        return this->labels.getLabels(this->getRegisterLabelSet(reg));
+      }
+
+
+      /* Untaint the memory */
+      bool TaintEngine::untaintMemory(const triton::arch::MemoryAccess& mem) {
+        if (!this->isEnabled())
+          return this->isMemoryTainted(mem);
+
+        this->taintedMemory.set(mem.getAddress(), mem.getSize(), !TAINTED);
 
         return !TAINTED;
       }
@@ -234,7 +420,16 @@ namespace triton {
       bool TaintEngine::untaintMemory(triton::uint64 addr) {
         if (!this->isEnabled())
           return this->isMemoryTainted(addr);
-        this->taintedMemory.erase(addr);
+        this->taintedMemory.set(addr, 1, !TAINTED);
+        return !TAINTED;
+      }
+
+
+      /* Untaint the range of memory */
+      bool TaintEngine::untaintMemoryRange(triton::uint64 addr, triton::uint64 size) {
+        if (!this->isEnabled())
+          return this->isMemoryRangeTainted(addr, size);
+        this->taintedMemory.set(addr, size, !TAINTED);
         return !TAINTED;
       }
 
@@ -306,6 +501,7 @@ namespace triton {
           if (byte == nullptr)
             continue;
           byte->isTainted = flag;
+          this->symbolicEngine->updateTaintIndex(byte);
         }
 
         return flag;
@@ -326,6 +522,7 @@ namespace triton {
           if (byte == nullptr)
             continue;
           byte->isTainted = this->isMemoryTainted(memAddrDst + i) | this->isMemoryTainted(memAddrSrc + i);
+          this->symbolicEngine->updateTaintIndex(byte);
         }
 
         return flag;
@@ -345,6 +542,7 @@ namespace triton {
           if (byte == nullptr)
             continue;
           byte->isTainted = flag;
+          this->symbolicEngine->updateTaintIndex(byte);
         }
 
         return flag;
@@ -379,6 +577,7 @@ namespace triton {
           if (byte == nullptr)
             continue;
           byte->isTainted = flag;
+          this->symbolicEngine->updateTaintIndex(byte);
         }
 
         return flag;
@@ -399,6 +598,7 @@ namespace triton {
           if (byte == nullptr)
             continue;
           byte->isTainted = this->isMemoryTainted(memAddrSrc + i);
+          this->symbolicEngine->updateTaintIndex(byte);
         }
 
         return flag;
@@ -418,6 +618,7 @@ namespace triton {
           if (byte == nullptr)
             continue;
           byte->isTainted = flag;
+          this->symbolicEngine->updateTaintIndex(byte);
         }
 
         return flag;
@@ -444,13 +645,7 @@ namespace triton {
         if (!this->isEnabled())
           return this->isRegisterTainted(regDst);
 
-        if (this->isRegisterTainted(regSrc)) {
-          this->taintRegister(regDst);
-          return TAINTED;
-        }
-
-        this->untaintRegister(regDst);
-        return !TAINTED;
+        return this->writeRegister(regDst, this->isRegisterTainted(regSrc), this->isLabelling() ? this->getRegisterLabelSet(regSrc) : 0);
       }
 
 
@@ -458,8 +653,7 @@ namespace triton {
       bool TaintEngine::assignmentRegisterImmediate(const triton::arch::Register& regDst) {
         if (!this->isEnabled())
           return this->isRegisterTainted(regDst);
-        this->untaintRegister(regDst);
-        return !TAINTED;
+        return this->writeRegister(regDst, !TAINTED, 0);
       }
 
 
@@ -468,13 +662,10 @@ namespace triton {
         if (!this->isEnabled())
           return this->isRegisterTainted(regDst);
 
-        if (this->isMemoryTainted(memSrc)) {
-          this->taintRegister(regDst);
-          return TAINTED;
-        }
+        if (this->isMemoryTainted(memSrc))
+          return this->writeRegister(regDst, TAINTED, this->isLabelling() ? this->getMemoryLabelSet(memSrc) : 0);
 
-        this->untaintRegister(regDst);
-        return !TAINTED;
+        return this->writeRegister(regDst, !TAINTED, 0);
       }
 
 
@@ -491,6 +682,7 @@ namespace triton {
         for (triton::uint32 offset = 0; offset < readSize; offset++) {
           if (this->isMemoryTainted(addrSrc+offset)) {
             this->taintMemory(addrDst+offset);
+            this->setMemoryLabelSet(addrDst+offset, 1, this->isLabelling() ? this->getMemoryLabelSet(addrSrc+offset) : 0);
             isTainted = TAINTED;
           }
           else
@@ -501,6 +693,11 @@ namespace triton {
         if (this->modes.isModeEnabled(triton::modes::TAINT_THROUGH_POINTERS)) {
           if (this->isMemoryTainted(memSrc)) {
             this->taintMemory(memDst);
+            if (this->isLabelling()) {
+              triton::uint32 pointer = this->getPointerLabelSet(memSrc);
+              for (triton::uint32 offset = 0; offset < memDst.getSize(); offset++)
+                this->setMemoryLabelSet(addrDst+offset, 1, this->labels.merge(this->getMemoryLabelSet(addrDst+offset), pointer));
+            }
             isTainted = TAINTED;
           }
         }
@@ -526,6 +723,7 @@ namespace triton {
         /* Check source */
         if (this->isRegisterTainted(regSrc)) {
           this->taintMemory(memDst);
+          this->setMemoryLabelSet(memDst.getAddress(), memDst.getSize(), this->isLabelling() ? this->getRegisterLabelSet(regSrc) : 0);
           return TAINTED;
         }
 
@@ -539,7 +737,7 @@ namespace triton {
       bool TaintEngine::unionRegisterImmediate(const triton::arch::Register& regDst) {
         if (!this->isEnabled())
           return this->isRegisterTainted(regDst);
-        return this->isRegisterTainted(regDst);
+        return this->writeRegister(regDst, this->isRegisterTainted(regDst), this->getRegisterLabelSet(regDst));
       }
 
 
@@ -548,12 +746,8 @@ namespace triton {
         if (!this->isEnabled())
           return this->isRegisterTainted(regDst);
 
-        if (this->isRegisterTainted(regSrc)) {
-          this->taintRegister(regDst);
-          return TAINTED;
-        }
-
-        return this->isRegisterTainted(regDst);
+        bool flag = this->isRegisterTainted(regDst) | this->isRegisterTainted(regSrc);
+        return this->writeRegister(regDst, flag, this->labels.merge(this->getRegisterLabelSet(regDst), this->getRegisterLabelSet(regSrc)));
       }
 
 
@@ -571,6 +765,8 @@ namespace triton {
         for (triton::uint32 offset = 0; offset < writeSize; offset++) {
           if (this->isMemoryTainted(addrSrc+offset)) {
             this->taintMemory(addrDst+offset);
+            if (this->isLabelling())
+              this->setMemoryLabelSet(addrDst+offset, 1, this->labels.merge(this->getMemoryLabelSet(addrDst+offset), this->getMemoryLabelSet(addrSrc+offset)));
             isTainted = TAINTED;
           }
         }
@@ -579,6 +775,11 @@ namespace triton {
         if (this->modes.isModeEnabled(triton::modes::TAINT_THROUGH_POINTERS)) {
           if (this->isMemoryTainted(memSrc)) {
             this->taintMemory(memDst);
+            if (this->isLabelling()) {
+              triton::uint32 pointer = this->getPointerLabelSet(memSrc);
+              for (triton::uint32 offset = 0; offset < writeSize; offset++)
+                this->setMemoryLabelSet(addrDst+offset, 1, this->labels.merge(this->getMemoryLabelSet(addrDst+offset), pointer));
+            }
             isTainted = TAINTED;
           }
         }
@@ -597,12 +798,8 @@ namespace triton {
         if (!this->isEnabled())
           return this->isRegisterTainted(regDst);
 
-        if (this->isMemoryTainted(memSrc)) {
-          this->taintRegister(regDst);
-          return TAINTED;
-        }
-
-        return this->isRegisterTainted(regDst);
+        bool flag = this->isRegisterTainted(regDst) | this->isMemoryTainted(memSrc);
+        return this->writeRegister(regDst, flag, this->labels.merge(this->getRegisterLabelSet(regDst), this->isLabelling() ? this->getMemoryLabelSet(memSrc) : 0));
       }
 
 
@@ -626,6 +823,11 @@ namespace triton {
 
         if (this->isRegisterTainted(regSrc)) {
           this->taintMemory(memDst);
+          if (this->isLabelling()) {
+            triton::uint32 set = this->getRegisterLabelSet(regSrc);
+            for (triton::uint32 offset = 0; offset < memDst.getSize(); offset++)
+              this->setMemoryLabelSet(memDst.getAddress()+offset, 1, this->labels.merge(this->getMemoryLabelSet(memDst.getAddress()+offset), set));
+          }
           return TAINTED;
         }
 
@@ -0,0 +1,89 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <iterator>
+
+#include <triton/exceptions.hpp>
+#include <triton/taintLabels.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace taint {
+
+      TaintLabels::TaintLabels() {
+        this->clear();
+      }
+
+
+      triton::uint32 TaintLabels::intern(const std::vector<triton::uint32>& labels) {
+        auto it = this->ids.find(labels);
+        if (it != this->ids.end())
+          return it->second;
+
+        triton::uint32 id = static_cast<triton::uint32>(this->sets.size());
+        this->sets.push_back(labels);
+        this->ids[labels] = id;
+
+        return id;
+      }
+
+
+      triton::uint32 TaintLabels::getSingleton(triton::uint32 label) {
+        return this->intern(std::vector<triton::uint32>(1, label));
+      }
+
+
+      triton::uint32 TaintLabels::merge(triton::uint32 set1, triton::uint32 set2) {
+        if (set1 == set2 || set2 == 0)
+          return set1;
+
+        if (set1 == 0)
+          return set2;
+
+        if (set1 >= this->sets.size() || set2 >= this->sets.size())
+          throw triton::exceptions::TaintEngine("TaintLabels::merge(): Invalid set of labels.");
+
+        triton::uint64 key = (set1 < set2) ? ((static_cast<triton::uint64>(set1) << 32) | set2) : ((static_cast<triton::uint64>(set2) << 32) | set1);
+        auto it = this->unions.find(key);
+        if (it != this->unions.end())
+          return it->second;
+
+        std::vector<triton::uint32> labels;
+        std::set_union(this->sets[set1].begin(), this->sets[set1].end(), this->sets[set2].begin(), this->sets[set2].end(), std::back_inserter(labels));
+
+        triton::uint32 id = this->intern(labels);
+        this->unions[key] = id;
+
+        return id;
+      }
+
+
+      const std::vector<triton::uint32>& TaintLabels::getLabels(triton::uint32 set) const {
+        if (set >= this->sets.size())
+          throw triton::exceptions::TaintEngine("TaintLabels::getLabels(): Invalid set of labels.");
+        return this->sets[set];
+      }
+
+
+      triton::usize TaintLabels::getNumberOfSets(void) const {
+        return this->sets.size();
+      }
+
+
+      void TaintLabels::clear(void) {
+        this->sets.clear();
+        this->ids.clear();
+        this->unions.clear();
+        this->intern(std::vector<triton::uint32>());
+      }
+
+    }; /* taint namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -417,6 +417,12 @@ namespace triton {
         //! [**symbolic api**] - Returns the logical conjunction AST of path constraints.
         TRITON_EXPORT triton::ast::SharedAbstractNode getPathConstraintsAst(void);
 
+        //! [**symbolic api**] - Returns the logical conjunction AST of the `count` first path constraints.
+        TRITON_EXPORT triton::ast::SharedAbstractNode getPathConstraintsAst(triton::usize count);
+
+        //! [**symbolic api**] - Returns the logical conjunction AST of the `index` first path constraints and of the negation of the constraint `index`.
+        TRITON_EXPORT triton::ast::SharedAbstractNode getFlippedPathConstraintsAst(triton::usize index);
+
         //! [**symbolic api**] - Adds a path constraint.
         TRITON_EXPORT void addPathConstraint(const triton::arch::Instruction& inst, const triton::engines::symbolic::SharedSymbolicExpression& expr);
 
@@ -459,14 +465,50 @@ namespace triton {
         //! [**symbolic api**] - Slices all expressions from a given one.
         TRITON_EXPORT std::map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> sliceExpressions(const triton::engines::symbolic::SharedSymbolicExpression& expr);
 
+        //! [**symbolic api**] - Returns all expressions depending on a given one (forward slice), the given one included.
+        TRITON_EXPORT std::map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> forwardSliceExpressions(const triton::engines::symbolic::SharedSymbolicExpression& expr) const;
+
+        //! [**symbolic api**] - Returns all expressions depending on a symbolic variable (forward slice).
+        TRITON_EXPORT std::map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> forwardSliceExpressions(const triton::engines::symbolic::SharedSymbolicVariable& symVar) const;
+
+        //! [**symbolic api**] - Returns the path constraints depending on a given expression.
+        TRITON_EXPORT std::vector<triton::engines::symbolic::PathConstraint> forwardSlicePathConstraints(const triton::engines::symbolic::SharedSymbolicExpression& expr) const;
+
+        //! [**symbolic api**] - Returns the path constraints depending on a symbolic variable.
+        TRITON_EXPORT std::vector<triton::engines::symbolic::PathConstraint> forwardSlicePathConstraints(const triton::engines::symbolic::SharedSymbolicVariable& symVar) const;
+
         //! [**symbolic api**] - Returns the list of the tainted symbolic expressions.
         TRITON_EXPORT std::list<triton::engines::symbolic::SharedSymbolicExpression> getTaintedSymbolicExpressions(void) const;
 
+        //! [**symbolic api**] - Returns a view on the tainted symbolic expressions.
+        TRITON_EXPORT triton::engines::symbolic::SymbolicExpressionView<std::set<triton::usize>> getTaintedSymbolicExpressionsView(void) const;
+
+        //! [**symbolic api**] - Returns a view on the symbolic expressions created by the instructions at an address.
+        TRITON_EXPORT triton::engines::symbolic::SymbolicExpressionView<std::vector<triton::usize>> getSymbolicExpressionsAtAddress(triton::uint64 addr) const;
+
+        //! [**symbolic api**] - Returns a view on the symbolic expressions of a kind.
+        TRITON_EXPORT triton::engines::symbolic::SymbolicExpressionView<std::vector<triton::usize>> getSymbolicExpressionsOfKind(triton::engines::symbolic::expression_e kind) const;
+
+        //! [**symbolic api**] - Sets the memory budget (in bytes) of the symbolic expressions. 0 means unlimited.
+        TRITON_EXPORT void setMemoryBudget(triton::usize bytes);
+
+        //! [**symbolic api**] - Returns the memory budget (in bytes) of the symbolic expressions.
+        TRITON_EXPORT triton::usize getMemoryBudget(void) const;
+
+        //! [**symbolic api**] - Returns the estimated memory (in bytes) used by the symbolic expressions.
+        TRITON_EXPORT triton::usize getEstimatedMemory(void) const;
+
+        //! [**symbolic api**] - Concretizes the least recently used expressions until the memory budget is met.
+        TRITON_EXPORT void enforceMemoryBudget(void);
+
+        //! [**symbolic api**] - Returns the statistics of the memory budget eviction.
+        TRITON_EXPORT const triton::engines::symbolic::EvictionStatistics& getEvictionStatistics(void) const;
+
         //! [**symbolic api**] - Returns all symbolic expressions as a map of <SymExprId : SymExpr>
         TRITON_EXPORT std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> getSymbolicExpressions(void) const;
 
         //! [**symbolic api**] - Returns all symbolic variables as a map of <SymVarId : SymVar>
-        TRITON_EXPORT const std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable>& getSymbolicVariables(void) const;
+        TRITON_EXPORT const triton::engines::symbolic::SymbolicTable<triton::engines::symbolic::SharedSymbolicVariable>& getSymbolicVariables(void) const;
 
         //! [**symbolic api**] - Gets the concrete value of a symbolic variable.
         TRITON_EXPORT const triton::uint512& getConcreteVariableValue(const triton::engines::symbolic::SharedSymbolicVariable& symVar) const;
@@ -487,8 +529,11 @@ namespace triton {
          * \details
          * **item1**: symbolic variable id<br>
          * **item2**: model
+         *
+         * The status of the query (sat, unsat, timeout, ...) is written into `status` if it is not null and the unset
+         * `limits` are taken from the limits of the context.
          */
-        TRITON_EXPORT std::map<triton::uint32, triton::engines::solver::SolverModel> getModel(const triton::ast::SharedAbstractNode& node) const;
+        TRITON_EXPORT std::map<triton::uint32, triton::engines::solver::SolverModel> getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status=nullptr, const triton::engines::solver::SolverLimits& limits=triton::engines::solver::SolverLimits()) const;
 
         /*!
          * \brief [**solver api**] - Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned.
@@ -497,10 +542,61 @@ namespace triton {
          * **item1**: symbolic variable id<br>
          * **item2**: model
          */
-        TRITON_EXPORT std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit) const;
+        TRITON_EXPORT std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status=nullptr, const triton::engines::solver::SolverLimits& limits=triton::engines::solver::SolverLimits()) const;
+
+        //! Returns true if an expression is satisfiable. The status of the query is written into `status` if it is not null.
+        TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status=nullptr, const triton::engines::solver::SolverLimits& limits=triton::engines::solver::SolverLimits()) const;
+
+        //! [**solver api**] - Computes a model of the path constraints before `index` and of the negation of the constraint `index`. With z3, the path is asserted incrementally into a session kept across queries. If the query is unsat or unanswered, the fallbacks of the optimistic strategy are solved and `optimistic` tells if the model only satisfies a part of the path.
+        TRITON_EXPORT std::map<triton::uint32, triton::engines::solver::SolverModel> getFlippedPathConstraintsModel(triton::usize index, triton::engines::solver::status_e* status=nullptr, bool* optimistic=nullptr);
+
+        //! [**solver api**] - Returns true if the path constraints before `index` and the negation of the constraint `index` are satisfiable. With z3, the path is asserted incrementally into a session kept across queries.
+        TRITON_EXPORT bool isFlippedPathConstraintsSat(triton::usize index, triton::engines::solver::status_e* status=nullptr);
+
+        //! [**solver api**] - Enumerates up to `limit` distinct values of a bitvector expression (e.g. a jump target or a pointer) under the path constraints. The models are blocked on the value of the expression only.
+        TRITON_EXPORT std::vector<triton::uint512> getPathValues(const triton::ast::SharedAbstractNode& node, triton::usize limit, triton::engines::solver::status_e* status=nullptr);
+
+        //! [**solver api**] - Returns the smallest (unsigned) value of a bitvector expression under the path constraints.
+        TRITON_EXPORT triton::uint512 getPathMinValue(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status=nullptr);
+
+        //! [**solver api**] - Returns the greatest (unsigned) value of a bitvector expression under the path constraints.
+        TRITON_EXPORT triton::uint512 getPathMaxValue(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status=nullptr);
+
+        //! [**solver api**] - Sets the limits (wall time, memory and conflicts) of the queries of the context.
+        TRITON_EXPORT void setSolverLimits(const triton::engines::solver::SolverLimits& limits);
+
+        //! [**solver api**] - Returns the limits of the queries of the context.
+        TRITON_EXPORT const triton::engines::solver::SolverLimits& getSolverLimits(void) const;
+
+        //! [**solver api**] - Interrupts the query being solved. May be called from another thread, the query answers `INTERRUPTED`.
+        TRITON_EXPORT void interruptSolver(void);
+
+        /*!
+         * \brief [**solver api**] - Solves the flip of every multiple-branch path constraint concurrently and returns the models indexed by path constraint.
+         *
+         * \details
+         * The flip of the path constraint `k` is the conjunction of the `k` first taken constraints and of the negation of the constraint `k`.
+         * With z3, the flips are solved by `maxThreads` workers (0 means one less than the number of cores) in independent z3 contexts,
+         * `timeout` (in milliseconds, 0 means the limit of the context) bounds each query and `callback` receives each model as soon as it is computed.
+         * An empty model means unsat or timeout. The callback runs while the workers read the ASTs of the path, it must not modify
+         * the context (no processing, no new path constraint, no `setAst`). `interruptSolver()` stops the workers.
+         */
+        TRITON_EXPORT std::map<triton::usize, std::map<triton::uint32, triton::engines::solver::SolverModel>> solveAllBranchFlips(triton::usize maxThreads=0, triton::uint32 timeout=0, const triton::engines::solver::BranchFlipCallback& callback=nullptr);
+
+        //! [**solver api**] - Sets the configurations raced by the portfolio mode. With at least two configurations, each query is solved by all of them in parallel and the first answer wins.
+        TRITON_EXPORT void setSolverPortfolio(const std::vector<triton::engines::solver::SolverConfiguration>& configurations);
+
+        //! [**solver api**] - Returns the configurations raced by the portfolio mode.
+        TRITON_EXPORT const std::vector<triton::engines::solver::SolverConfiguration>& getSolverPortfolio(void) const;
+
+        //! [**solver api**] - Returns the number of wins of each configuration of the portfolio.
+        TRITON_EXPORT const std::vector<triton::usize>& getSolverPortfolioWins(void) const;
 
-        //! Returns true if an expression is satisfiable.
-        TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node) const;
+        //! [**solver api**] - Returns the name of the configuration which answered the last query raced by the portfolio.
+        TRITON_EXPORT const std::string& getSolverPortfolioWinner(void) const;
+
+        //! [**solver api**] - Releases the incremental solver session.
+        TRITON_EXPORT void resetSolverSession(void);
 
         //! Returns the kind of solver as triton::engines::solver::solver_e.
         TRITON_EXPORT triton::engines::solver::solver_e getSolver(void) const;
@@ -514,6 +610,9 @@ namespace triton {
         //! Initializes a custom solver.
         TRITON_EXPORT void setCustomSolver(triton::engines::solver::SolverInterface* customSolver);
 
+        //! [**solver api**] - Initializes an external solver process which speaks SMT-LIB v2 on its standard input and output (e.g. `{"z3", "-in"}`).
+        TRITON_EXPORT void setSmtLibSolver(const std::vector<std::string>& command);
+
         //! Returns true if the solver is valid.
         TRITON_EXPORT bool isSolverValid(void) const;
 
@@ -523,6 +622,69 @@ namespace triton {
         //! [**solver api**] - Converts a Triton's AST to a Z3's AST, perform a Z3 simplification and returns a Triton's AST.
         TRITON_EXPORT triton::ast::SharedAbstractNode processZ3Simplification(const triton::ast::SharedAbstractNode& node) const;
 
+        //! [**solver api**] - Sets the maximum number of entries of the solver cache (0, the default, disables the cache).
+        TRITON_EXPORT void setSolverCacheCapacity(triton::usize capacity);
+
+        //! [**solver api**] - Returns the maximum number of entries of the solver cache.
+        TRITON_EXPORT triton::usize getSolverCacheCapacity(void) const;
+
+        //! [**solver api**] - Returns the statistics of the solver cache.
+        TRITON_EXPORT const triton::engines::solver::SolverCacheStatistics& getSolverCacheStatistics(void) const;
+
+        //! [**solver api**] - Clears the solver cache.
+        TRITON_EXPORT void clearSolverCache(void);
+
+        //! [**solver api**] - Opens (or creates) a persistent cache of the solver answers shared across runs and processes. The log is compacted past `maxSize` bytes.
+        TRITON_EXPORT void openSolverPersistentCache(const std::string& path, triton::usize maxSize=(64 << 20));
+
+        //! [**solver api**] - Closes the persistent cache of the solver answers.
+        TRITON_EXPORT void closeSolverPersistentCache(void);
+
+        //! [**solver api**] - Returns true if a persistent cache of the solver answers is opened.
+        TRITON_EXPORT bool isSolverPersistentCacheOpened(void) const;
+
+        //! [**solver api**] - Returns the statistics of the persistent cache of the solver answers.
+        TRITON_EXPORT const triton::engines::solver::PersistentSolverCacheStatistics& getSolverPersistentCacheStatistics(void) const;
+
+        //! [**solver api**] - Starts appending the solver queries to a capture file (SMT-LIB scripts with their timing, status and the address of the instruction being processed). The capture can be replayed by `triton-solver-bench`.
+        TRITON_EXPORT void startSolverRecording(const std::string& path);
+
+        //! [**solver api**] - Stops recording the solver queries.
+        TRITON_EXPORT void stopSolverRecording(void);
+
+        //! [**solver api**] - Returns true if the solver queries are recorded.
+        TRITON_EXPORT bool isSolverRecording(void) const;
+
+        //! [**solver api**] - Sets the maximum number of evaluations of a query by the local search (see the SOLVER_LOCAL_SEARCH mode).
+        TRITON_EXPORT void setSolverLocalSearchBudget(triton::usize budget);
+
+        //! [**solver api**] - Returns the maximum number of evaluations of a query by the local search.
+        TRITON_EXPORT triton::usize getSolverLocalSearchBudget(void) const;
+
+        //! [**solver api**] - Returns the statistics of the local search.
+        TRITON_EXPORT const triton::engines::solver::LocalSearchStatistics& getSolverLocalSearchStatistics(void) const;
+
+        //! [**solver api**] - Returns the statistics of the interval solver (see the SOLVER_INTERVALS mode).
+        TRITON_EXPORT const triton::engines::solver::IntervalSolverStatistics& getSolverIntervalStatistics(void) const;
+
+        //! [**solver api**] - Sets the maximum number of recent models tried before the solver (see the SOLVER_MODEL_REUSE mode).
+        TRITON_EXPORT void setSolverModelPoolCapacity(triton::usize capacity);
+
+        //! [**solver api**] - Returns the maximum number of recent models tried before the solver.
+        TRITON_EXPORT triton::usize getSolverModelPoolCapacity(void) const;
+
+        //! [**solver api**] - Returns the statistics of the concrete values and recent models tried before the solver.
+        TRITON_EXPORT const triton::engines::solver::ModelPoolStatistics& getSolverModelPoolStatistics(void) const;
+
+        //! [**solver api**] - Returns the statistics of the rewriting of the queries (see the SOLVER_PREPROCESSING mode).
+        TRITON_EXPORT const triton::engines::solver::QueryPreprocessorStatistics& getSolverPreprocessingStatistics(void) const;
+
+        //! [**solver api**] - Sets the fallbacks of the flipped branches whose query is unsat or unanswered (see getFlippedPathConstraintsModel()).
+        TRITON_EXPORT void setSolverOptimisticStrategy(triton::engines::solver::optimistic_e strategy);
+
+        //! [**solver api**] - Returns the fallbacks of the flipped branches whose query is unsat or unanswered.
+        TRITON_EXPORT triton::engines::solver::optimistic_e getSolverOptimisticStrategy(void) const;
+
 
 
         /* Taint engine API ============================================================================== */
@@ -534,7 +696,10 @@ namespace triton {
         TRITON_EXPORT triton::engines::taint::TaintEngine* getTaintEngine(void);
 
         //! [**taint api**] - Returns the tainted addresses.
-        TRITON_EXPORT const std::set<triton::uint64>& getTaintedMemory(void) const;
+        TRITON_EXPORT std::set<triton::uint64> getTaintedMemory(void) const;
+
+        //! [**taint api**] - Returns the tainted memory as coalesced ranges (address, size), sorted by address.
+        TRITON_EXPORT std::vector<std::pair<triton::uint64, triton::uint64>> getTaintedMemoryRanges(void) const;
 
         //! [**taint api**] - Returns the tainted registers.
         TRITON_EXPORT std::set<const triton::arch::Register*> getTaintedRegisters(void) const;
@@ -554,6 +719,9 @@ namespace triton {
         //! [**taint api**] - Returns true if the memory is tainted.
         TRITON_EXPORT bool isMemoryTainted(const triton::arch::MemoryAccess& mem) const;
 
+        //! [**taint api**] - Returns true if one of the `size` bytes from `addr` is tainted.
+        TRITON_EXPORT bool isMemoryRangeTainted(triton::uint64 addr, triton::uint64 size) const;
+
         //! [**taint api**] - Returns true if the register is tainted.
         TRITON_EXPORT bool isRegisterTainted(const triton::arch::Register& reg) const;
 
@@ -572,15 +740,33 @@ namespace triton {
         //! [**taint api**] - Taints a memory. Returns TAINTED if the memory has been tainted correctly. Otherwise it returns the last defined state.
         TRITON_EXPORT bool taintMemory(const triton::arch::MemoryAccess& mem);
 
+        //! [**taint api**] - Taints `size` bytes from `addr`. Returns TAINTED if the range has been tainted correctly. Otherwise it returns the last defined state.
+        TRITON_EXPORT bool taintMemoryRange(triton::uint64 addr, triton::uint64 size);
+
         //! [**taint api**] - Taints a register. Returns TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
         TRITON_EXPORT bool taintRegister(const triton::arch::Register& reg);
 
+        //! [**taint api**] - Taints a memory and adds a label to each of its bytes (see the TAINT_LABELS mode). Returns TAINTED if the memory has been tainted correctly. Otherwise it returns the last defined state.
+        TRITON_EXPORT bool taintMemoryWithLabel(const triton::arch::MemoryAccess& mem, triton::uint32 label);
+
+        //! [**taint api**] - Taints a register and adds a label to it (see the TAINT_LABELS mode). Returns TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
+        TRITON_EXPORT bool taintRegisterWithLabel(const triton::arch::Register& reg, triton::uint32 label);
+
+        //! [**taint api**] - Returns the labels (sorted) which flow into a memory.
+        TRITON_EXPORT std::vector<triton::uint32> getMemoryTaintLabels(const triton::arch::MemoryAccess& mem) const;
+
+        //! [**taint api**] - Returns the labels (sorted) which flow into a register.
+        TRITON_EXPORT std::vector<triton::uint32> getRegisterTaintLabels(const triton::arch::Register& reg) const;
+
         //! [**taint api**] - Untaints an address. Returns !TAINTED if the address has been untainted correctly. Otherwise it returns the last defined state.
         TRITON_EXPORT bool untaintMemory(triton::uint64 addr);
 
         //! [**taint api**] - Untaints a memory. Returns !TAINTED if the memory has been untainted correctly. Otherwise it returns the last defined state.
         TRITON_EXPORT bool untaintMemory(const triton::arch::MemoryAccess& mem);
 
+        //! [**taint api**] - Untaints `size` bytes from `addr`. Returns !TAINTED if the range has been untainted correctly. Otherwise it returns the last defined state.
+        TRITON_EXPORT bool untaintMemoryRange(triton::uint64 addr, triton::uint64 size);
+
         //! [**taint api**] - Untaints a register. Returns !TAINTED if the register has been untainted correctly. Otherwise it returns the last defined state.
         TRITON_EXPORT bool untaintRegister(const triton::arch::Register& reg);
 
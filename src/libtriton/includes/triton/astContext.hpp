@@ -9,6 +9,8 @@
 #define TRITON_AST_CONTEXT_H
 
 #include <map>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <triton/ast.hpp>
@@ -55,8 +57,11 @@ namespace triton {
         //! String formater for ast
         triton::ast::representations::AstRepresentation astRepresentation;
 
-        //! Map a concrete value and ast node for a variable name.
-        std::map<std::string, std::pair<triton::ast::SharedAbstractNode, triton::uint512>> valueMapping;
+        //! Map a concrete value and ast node for a variable id (used as index).
+        std::vector<std::pair<triton::ast::SharedAbstractNode, triton::uint512>> valueMapping;
+
+        //! Map a variable name to its variable id.
+        std::unordered_map<std::string, triton::usize> variableNames;
 
       public:
         //! Constructor
@@ -264,7 +269,10 @@ namespace triton {
         TRITON_EXPORT SharedAbstractNode zx(triton::uint32 sizeExt, const SharedAbstractNode& expr);
 
         //! Initializes a variable in the context
-        TRITON_EXPORT void initVariable(const std::string& name, const triton::uint512& value, const SharedAbstractNode& node);
+        TRITON_EXPORT void initVariable(const triton::engines::symbolic::SharedSymbolicVariable& symVar, const triton::uint512& value, const SharedAbstractNode& node);
+
+        //! Updates a variable value in this context
+        TRITON_EXPORT void updateVariable(const triton::engines::symbolic::SharedSymbolicVariable& symVar, const triton::uint512& value);
 
         //! Updates a variable value in this context
         TRITON_EXPORT void updateVariable(const std::string& name, const triton::uint512& value);
@@ -272,6 +280,9 @@ namespace triton {
         //! Gets a variable node from its name.
         SharedAbstractNode getVariableNode(const std::string& name);
 
+        //! Gets a variable value from its id.
+        TRITON_EXPORT const triton::uint512& getVariableValue(triton::usize varId) const;
+
         //! Gets a variable value from its name.
         TRITON_EXPORT const triton::uint512& getVariableValue(const std::string& varName) const;
 
@@ -9,6 +9,7 @@
 #define TRITON_ASTSMTREPRESENTATION_HPP
 
 #include <iostream>
+#include <string>
 
 #include <triton/astRepresentationInterface.hpp>
 #include <triton/ast.hpp>
@@ -45,6 +46,9 @@ namespace triton {
           //! Constructor.
           TRITON_EXPORT AstSmtRepresentation();
 
+          //! Returns a name as a SMT-LIB symbol, between bars if it is not a simple symbol. The bars and backslashes of such a name become underscores.
+          TRITON_EXPORT static std::string getSymbol(const std::string& name);
+
           //! Displays the node according to the representation mode.
           TRITON_EXPORT std::ostream& print(std::ostream& stream, triton::ast::AbstractNode* node);
 
@@ -0,0 +1,130 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_CONSTRAINTEVALUATOR_HPP
+#define TRITON_CONSTRAINTEVALUATOR_HPP
+
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/astEnums.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/symbolicVariable.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \class ConstraintEvaluator
+       *  \brief Evaluates a constraint on assignments of its symbolic variables.
+       *
+       *  \details
+       *  The constraint is compiled once into a flat list of operations (the sub-trees without symbolic variable
+       *  are folded into constants and the references are inlined), which is then evaluated on any assignment of
+       *  its variables without updating the values of the AST context. Besides the truth value, the evaluator
+       *  computes a distance to satisfaction (0 if the constraint is satisfied) used to guide a search: the
+       *  distance of a comparison is the gap between its operands, a conjunction sums the distances of its
+       *  operands and a disjunction takes the smallest one.
+       */
+      class ConstraintEvaluator {
+        private:
+          //! An operation of the compiled constraint.
+          struct Operation {
+            //! The kind of node.
+            triton::ast::ast_e type;
+
+            //! The size of the result.
+            triton::uint32 size;
+
+            //! The mask of the result.
+            triton::uint512 mask;
+
+            //! The constant value (constants) or the index of the variable (variables).
+            triton::uint512 value;
+
+            //! The integer parameters (low bit of an extraction, rotation, size of an extension).
+            triton::uint32 param;
+
+            //! The indexes of the operands.
+            std::vector<triton::usize> operands;
+          };
+
+          //! The compiled constraint, an operand always comes before its users.
+          std::vector<Operation> operations;
+
+          //! The symbolic variables of the constraint.
+          std::vector<triton::engines::symbolic::SharedSymbolicVariable> variables;
+
+          //! The values of the operations computed by the last evaluation.
+          mutable std::vector<triton::uint512> values;
+
+          //! False if the constraint contains a node which cannot be evaluated.
+          bool supported;
+
+          //! The root of the constraint.
+          triton::ast::SharedAbstractNode root;
+
+          //! Compiles the constraint.
+          void compile(const triton::ast::SharedAbstractNode& node);
+
+          //! Computes the values of all the operations.
+          void run(const std::vector<triton::uint512>& assignment) const;
+
+          //! Returns the distance of an operation to `true` (or to `false` if `negated`).
+          triton::uint512 getDistance(triton::usize index, bool negated) const;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT ConstraintEvaluator(const triton::ast::SharedAbstractNode& node);
+
+          //! Returns false if the constraint contains a node which cannot be evaluated (e.g. a `let`).
+          TRITON_EXPORT bool isSupported(void) const;
+
+          //! Returns the symbolic variables of the constraint. An assignment holds one value per variable, in this order.
+          TRITON_EXPORT const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& getVariables(void) const;
+
+          //! Returns the assignment made of the current concrete values of the variables.
+          TRITON_EXPORT std::vector<triton::uint512> getConcreteAssignment(void) const;
+
+          //! Returns true if the constraint is satisfied by an assignment.
+          TRITON_EXPORT bool evaluate(const std::vector<triton::uint512>& assignment) const;
+
+          //! Returns the value of the expression (e.g. a bitvector) on an assignment.
+          TRITON_EXPORT triton::uint512 getValue(const std::vector<triton::uint512>& assignment) const;
+
+          //! Returns the distance of an assignment to the satisfaction of the constraint, 0 if it is satisfied.
+          TRITON_EXPORT triton::uint512 getDistance(const std::vector<triton::uint512>& assignment) const;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_CONSTRAINTEVALUATOR_HPP */
@@ -0,0 +1,192 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_INTERVALSOLVER_HPP
+#define TRITON_INTERVALSOLVER_HPP
+
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/symbolicVariable.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! Statistics of the interval solver.
+      struct IntervalSolverStatistics {
+        //! Number of queries submitted.
+        triton::usize queries;
+
+        //! Number of queries decided sat.
+        triton::usize sat;
+
+        //! Number of queries decided unsat.
+        triton::usize unsat;
+
+        //! Constructor.
+        IntervalSolverStatistics() : queries(0), sat(0), unsat(0) {}
+      };
+
+      /*! \class IntervalSolver
+       *  \brief A decision procedure for conjunctions of linear comparisons over the variables.
+       *
+       *  \details
+       *  The fragment is made of conjunctions of (possibly negated) comparisons between linear combinations of
+       *  variables of at most 64 bits (`bvadd`, `bvsub`, `bvmul` and `bvshl` by a constant, `concat`, `zero_extend`
+       *  and the no-op extractions and masks) which cannot wrap around, plus any constraint on a single variable
+       *  of at most 8 bits, which is enumerated. The domains of the variables are narrowed by bounds propagation
+       *  (this includes the difference bounds `x - y <= c`), an empty domain proves the query unsat, then a model
+       *  is built by a short search starting from the concrete values. A query outside the fragment, or which is
+       *  not decided within the budget, is left to the solver.
+       */
+      class IntervalSolver {
+        private:
+          //! The domain of a variable.
+          struct Domain {
+            //! The lower bound.
+            triton::sint512 lo;
+
+            //! The upper bound.
+            triton::sint512 hi;
+
+            //! The allowed values of a variable of at most 8 bits (empty for the larger ones).
+            std::vector<bool> allowed;
+          };
+
+          //! A linear combination of the variables and a constant.
+          struct Term {
+            //! The coefficients indexed by variable.
+            std::map<triton::usize, triton::sint512> coefs;
+
+            //! The constant.
+            triton::sint512 constant;
+
+            //! The smallest value of the term over the domains of the variables.
+            triton::sint512 min;
+
+            //! The greatest value of the term over the domains of the variables.
+            triton::sint512 max;
+          };
+
+          //! A constraint `sum(coef * var) + constant <op> 0`, `op` is EQUAL_NODE, DISTINCT_NODE or BVULE_NODE.
+          struct Linear {
+            //! The coefficients indexed by variable.
+            std::map<triton::usize, triton::sint512> coefs;
+
+            //! The constant.
+            triton::sint512 constant;
+
+            //! The comparison with 0.
+            triton::ast::ast_e op;
+          };
+
+          //! The maximum number of nodes of the search of a model.
+          triton::usize budget;
+
+          //! The statistics of the solver.
+          IntervalSolverStatistics stats;
+
+          //! The variables of the query being solved.
+          std::vector<triton::engines::symbolic::SharedSymbolicVariable> variables;
+
+          //! The index of the variables of the query being solved, by id.
+          std::map<triton::usize, triton::usize> indexes;
+
+          //! The linear constraints of the query being solved.
+          std::vector<Linear> constraints;
+
+          //! The number of search nodes left.
+          triton::usize nodes;
+
+          //! The translations of the nodes of the query being linearized (false if outside the fragment).
+          std::unordered_map<const triton::ast::AbstractNode*, std::pair<bool, Term>> terms;
+
+          //! Returns the index of a variable, registering it if needed. Returns false if the variable is too large.
+          bool getIndex(const triton::engines::symbolic::SharedSymbolicVariable& var, std::vector<Domain>& domains, triton::usize& index);
+
+          //! Translates a bitvector expression into a linear term. Returns false if the expression is outside the fragment.
+          bool linearize(const triton::ast::SharedAbstractNode& node, std::vector<Domain>& domains, Term& term, triton::uint32 depth);
+
+          //! Translates a node into a linear term, its children through linearize().
+          bool linearizeNode(const triton::ast::SharedAbstractNode& node, std::vector<Domain>& domains, Term& term, triton::uint32 depth);
+
+          //! Adds a (negated) constraint to the problem. Returns false if the constraint is outside the fragment.
+          bool addConstraint(const triton::ast::SharedAbstractNode& node, bool negated, std::vector<Domain>& domains, bool& contradiction);
+
+          //! Adds a constraint on a single small variable by enumerating its values.
+          bool addTable(const triton::ast::SharedAbstractNode& node, bool negated, std::vector<Domain>& domains, bool& contradiction);
+
+          //! Narrows the domains to a fixpoint (or a bounded number of rounds). Returns false if a domain is empty.
+          bool propagate(std::vector<Domain>& domains) const;
+
+          //! Narrows the domains with `sum(coef * var) + constant <= 0`. Returns false if a domain is empty.
+          bool propagateLe(const std::map<triton::usize, triton::sint512>& coefs, const triton::sint512& constant, std::vector<Domain>& domains, bool& changed) const;
+
+          //! Looks for a model by labeling the variables. Returns true if all the variables are fixed and satisfy the constraints.
+          bool search(std::vector<Domain>& domains, const std::vector<triton::uint512>& concrete);
+
+          //! Returns true if the fixed domains satisfy all the constraints.
+          bool check(const std::vector<Domain>& domains) const;
+
+          //! Raises the lower bound of a domain.
+          static bool setMin(Domain& domain, const triton::sint512& value, bool& changed);
+
+          //! Lowers the upper bound of a domain.
+          static bool setMax(Domain& domain, const triton::sint512& value, bool& changed);
+
+          //! Removes a value from a domain (only at the bounds for the large variables).
+          static bool remove(Domain& domain, const triton::sint512& value, bool& changed);
+
+          //! Moves the bounds of a domain on allowed values. Returns false if the domain is empty.
+          static bool normalize(Domain& domain);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT IntervalSolver(triton::usize budget=256);
+
+          //! Decides a query. Returns SAT (with a model), UNSAT, or UNKNOWN if the query is outside the fragment or undecided.
+          TRITON_EXPORT triton::engines::solver::status_e solve(const triton::ast::SharedAbstractNode& node, std::map<triton::uint32, SolverModel>& model);
+
+          //! Returns the statistics of the solver.
+          TRITON_EXPORT const IntervalSolverStatistics& getStatistics(void) const;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_INTERVALSOLVER_HPP */
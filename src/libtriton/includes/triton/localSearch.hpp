@@ -0,0 +1,102 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_LOCALSEARCH_HPP
+#define TRITON_LOCALSEARCH_HPP
+
+#include <map>
+#include <random>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! Statistics of the local search.
+      struct LocalSearchStatistics {
+        //! Number of queries searched.
+        triton::usize queries;
+
+        //! Number of queries solved by the search.
+        triton::usize solved;
+
+        //! Number of evaluations of the constraints.
+        triton::usize evaluations;
+
+        //! Constructor.
+        LocalSearchStatistics() : queries(0), solved(0), evaluations(0) {}
+      };
+
+      /*! \class LocalSearch
+       *  \brief A cheap search of a model tried before the solver.
+       *
+       *  \details
+       *  Starting from the current concrete values of the variables, the search minimizes the distance of the
+       *  constraint to its satisfaction (see ConstraintEvaluator) with gradient steps growing exponentially on
+       *  each variable, then single bit flips, and restarts a random variable when it is stuck. It gives up after
+       *  `budget` evaluations of the constraint. It can only find models, a failure tells nothing about the
+       *  satisfiability of the constraint.
+       */
+      class LocalSearch {
+        private:
+          //! The maximum number of evaluations per query.
+          triton::usize budget;
+
+          //! The statistics of the search.
+          LocalSearchStatistics stats;
+
+          //! The generator of the random restarts (fixed seed, the search is deterministic).
+          std::mt19937 random;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT LocalSearch(triton::usize budget=1000);
+
+          //! Looks for a model of a constraint. Returns false if the budget has been exhausted or if the constraint cannot be evaluated.
+          TRITON_EXPORT bool solve(const triton::ast::SharedAbstractNode& node, std::map<triton::uint32, SolverModel>& model);
+
+          //! Sets the maximum number of evaluations per query.
+          TRITON_EXPORT void setBudget(triton::usize budget);
+
+          //! Returns the maximum number of evaluations per query.
+          TRITON_EXPORT triton::usize getBudget(void) const;
+
+          //! Returns the statistics of the search.
+          TRITON_EXPORT const LocalSearchStatistics& getStatistics(void) const;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_LOCALSEARCH_HPP */
@@ -0,0 +1,106 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_MODELPOOL_HPP
+#define TRITON_MODELPOOL_HPP
+
+#include <list>
+#include <map>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! Statistics of the pool of models.
+      struct ModelPoolStatistics {
+        //! Number of queries checked.
+        triton::usize queries;
+
+        //! Number of queries satisfied by the current concrete values.
+        triton::usize concreteHits;
+
+        //! Number of queries satisfied by a recent model.
+        triton::usize poolHits;
+
+        //! Constructor.
+        ModelPoolStatistics() : queries(0), concreteHits(0), poolHits(0) {}
+      };
+
+      /*! \class ModelPool
+       *  \brief The recently found models, tried on a query before the solver.
+       *
+       *  \details
+       *  A query is first evaluated with the current concrete values of its variables, then with each recent
+       *  model (most recent first), the variables missing from a model keeping their concrete value. The model
+       *  which satisfies the query moves to the front of the pool.
+       */
+      class ModelPool {
+        private:
+          //! The maximum number of models.
+          triton::usize capacity;
+
+          //! The recent models (value by variable id), the most recent first.
+          std::list<std::map<triton::usize, triton::uint512>> models;
+
+          //! The statistics of the pool.
+          ModelPoolStatistics stats;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT ModelPool(triton::usize capacity=16);
+
+          //! Looks for an assignment satisfying a query among the concrete values and the recent models.
+          TRITON_EXPORT bool lookup(const triton::ast::SharedAbstractNode& node, std::map<triton::uint32, SolverModel>& model);
+
+          //! Adds a model to the pool.
+          TRITON_EXPORT void insert(const std::map<triton::uint32, SolverModel>& model);
+
+          //! Sets the maximum number of models (0 only tries the concrete values).
+          TRITON_EXPORT void setCapacity(triton::usize capacity);
+
+          //! Returns the maximum number of models.
+          TRITON_EXPORT triton::usize getCapacity(void) const;
+
+          //! Returns the statistics of the pool.
+          TRITON_EXPORT const ModelPoolStatistics& getStatistics(void) const;
+
+          //! Removes all the models.
+          TRITON_EXPORT void clear(void);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_MODELPOOL_HPP */
@@ -30,10 +30,17 @@ namespace triton {
       ALIGNED_MEMORY,                 //!< [symbolic] Keep a map of aligned memory.
       AST_OPTIMIZATIONS,              //!< [AST] Classical arithmetic optimisations to reduce the depth of the trees.
       CONCRETIZE_UNDEFINED_REGISTERS, //!< [symbolic] Concretize every registers tagged as undefined (see #750).
+      CONSTRAINTS_INDEPENDENCE,       //!< [solver] Only solve the independent constraints which are not satisfied by the concrete values.
       ONLY_ON_SYMBOLIZED,             //!< [symbolic] Perform symbolic execution only on symbolized expressions.
       ONLY_ON_TAINTED,                //!< [symbolic] Perform symbolic execution only on tainted instructions.
       PC_TRACKING_SYMBOLIC,           //!< [symbolic] Track path constraints only if they are symbolized.
+      SOLVER_INTERVALS,               //!< [solver] Decide the conjunctions of linear comparisons over the variables with interval reasoning before sending a query to the solver.
+      SOLVER_LOCAL_SEARCH,            //!< [solver] Look for a model with a local search over the concrete values before sending a query to the solver.
+      SOLVER_MODEL_COMPLETION,        //!< [solver] Complete the models with the concrete values of the variables of the query the solver left unassigned.
+      SOLVER_MODEL_REUSE,             //!< [solver] Try the concrete values and the recently found models before sending a query to the solver.
+      SOLVER_PREPROCESSING,           //!< [solver] Remove the duplicated constraints, substitute the variables fixed by equalities and drop the implied bounds before sending a query to the solver.
       SYMBOLIZE_INDEX_ROTATION,       //!< [symbolic] Symbolize index rotation for bvrol and bvror (see #751). This mode increases the complexity of solving.
+      TAINT_LABELS,                   //!< [taint] Propagate the sets of labels (e.g. the offsets of the input bytes) which flow into the tainted bytes and registers.
       TAINT_THROUGH_POINTERS,         //!< [taint] Spread the taint if an index pointer is already tainted (see #725).
     };
 
@@ -43,8 +43,18 @@ namespace triton {
      */
 
       /*! \class PathManager
-          \brief The path manager class. */
+          \brief The path manager class.
+
+          \details
+          The conjunction of the path constraints is maintained incrementally. Taken constraints are grouped
+          into flat `land` blocks of `blockSize` constraints as they are added, and the predicate of a prefix
+          is a flat `land` of the complete blocks and of the remaining constraints. Each prefix is built once
+          and cached, so asking again for the predicate at a constraint index is O(1). */
       class PathManager {
+        public:
+          //! Number of taken constraints per block of the conjunction.
+          static const triton::usize blockSize = 64;
+
         private:
           //! Modes API.
           triton::modes::Modes& modes;
@@ -52,6 +62,21 @@ namespace triton {
           //! AstContext API
           triton::ast::AstContext& astCtxt;
 
+          //! The `(= true true)` node, first operand of every conjunction.
+          mutable triton::ast::SharedAbstractNode top;
+
+          //! The conjunctions of the complete blocks of taken constraints.
+          std::vector<triton::ast::SharedAbstractNode> blocks;
+
+          //! The cached conjunctions of the prefixes, indexed by the number of constraints (nullptr if not built yet).
+          mutable std::vector<triton::ast::SharedAbstractNode> prefixes;
+
+          //! Returns the `(= true true)` node.
+          const triton::ast::SharedAbstractNode& getTopNode(void) const;
+
+          //! Fills the operands of the conjunction of the `count` first constraints.
+          void getPrefixOperands(triton::usize count, std::vector<triton::ast::SharedAbstractNode>& operands) const;
+
         protected:
           //! \brief The logical conjunction vector of path constraints.
           std::vector<triton::engines::symbolic::PathConstraint> pathConstraints;
@@ -72,6 +97,12 @@ namespace triton {
           //! Returns the logical conjunction AST of path constraints.
           TRITON_EXPORT triton::ast::SharedAbstractNode getPathConstraintsAst(void) const;
 
+          //! Returns the logical conjunction AST of the `count` first path constraints.
+          TRITON_EXPORT triton::ast::SharedAbstractNode getPathConstraintsAst(triton::usize count) const;
+
+          //! Returns the logical conjunction AST of the `index` first path constraints and of the negation of the constraint `index`.
+          TRITON_EXPORT triton::ast::SharedAbstractNode getFlippedPathConstraintsAst(triton::usize index) const;
+
           //! Returns the number of constraints.
           TRITON_EXPORT triton::usize getNumberOfPathConstraints(void) const;
 
@@ -0,0 +1,90 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_PATHVARIABLESINDEX_HPP
+#define TRITON_PATHVARIABLESINDEX_HPP
+
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/pathConstraint.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \class PathVariablesIndex
+       *  \brief The taken constraints of a path indexed by their variables.
+       *
+       *  \details
+       *  Like the incremental session, the index follows the prefix of a path: a sync only indexes the constraints
+       *  which differ from the indexed ones, so the variables of a constraint are looked for once. The constraints
+       *  of a prefix which transitively share variables with a query are then found from the variables of the
+       *  query, without walking the unrelated constraints.
+       */
+      class PathVariablesIndex {
+        private:
+          //! The indexed constraints.
+          std::vector<triton::ast::SharedAbstractNode> constraints;
+
+          //! The variable ids of each indexed constraint.
+          std::vector<std::vector<triton::usize>> variables;
+
+          //! The indexes of the constraints holding each variable, in increasing order.
+          std::unordered_map<triton::usize, std::vector<triton::usize>> owners;
+
+          //! Removes the indexed constraints from `count`.
+          void truncate(triton::usize count);
+
+        public:
+          //! Indexes the `count` first taken constraints of a path. The indexed constraints past `count` are kept while they match the path.
+          TRITON_EXPORT void sync(const std::vector<triton::engines::symbolic::PathConstraint>& path, triton::usize count);
+
+          /*!
+           * \brief Fills `related` with the constraints among the `count` first indexed ones which transitively share variables with a query.
+           *
+           * \details The constraints are given in the order of the path. Returns false if one of the others is falsified by the concrete values.
+           */
+          TRITON_EXPORT bool getRelatedConstraints(triton::usize count, const triton::ast::SharedAbstractNode& query, std::vector<triton::ast::SharedAbstractNode>& related) const;
+
+          //! Returns the number of indexed constraints.
+          TRITON_EXPORT triton::usize size(void) const;
+
+          //! Removes all the indexed constraints.
+          TRITON_EXPORT void clear(void);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_PATHVARIABLESINDEX_HPP */
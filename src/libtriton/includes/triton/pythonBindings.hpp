@@ -89,6 +89,12 @@ namespace triton {
       //! Initializes the MODE python namespace.
       void initModeNamespace(PyObject* modeDict);
 
+      //! Initializes the OPTIMISTIC python namespace.
+      void initOptimisticNamespace(PyObject* optimisticDict);
+
+      //! Initializes the SOLVER_STATE python namespace.
+      void initSolverStateNamespace(PyObject* solverStateDict);
+
       //! Initializes the SYMBOLIC python namespace.
       void initSymbolicNamespace(PyObject* symbolicDict);
 
@@ -0,0 +1,133 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_QUERYPREPROCESSOR_HPP
+#define TRITON_QUERYPREPROCESSOR_HPP
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/symbolicVariable.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! Statistics of the query preprocessor.
+      struct QueryPreprocessorStatistics {
+        //! Number of queries preprocessed.
+        triton::usize queries;
+
+        //! Number of duplicated constraints removed.
+        triton::usize duplicates;
+
+        //! Number of variables substituted by their value.
+        triton::usize substitutions;
+
+        //! Number of constraints removed because they are implied by a stronger bound on the same variable.
+        triton::usize implied;
+
+        //! Number of queries answered without the solver (sat or unsat).
+        triton::usize answered;
+
+        //! Constructor.
+        QueryPreprocessorStatistics() : queries(0), duplicates(0), substitutions(0), implied(0), answered(0) {}
+      };
+
+      /*! \class QueryPreprocessor
+       *  \brief Rewrites a conjunction of constraints into a smaller equisatisfiable one before it is sent to the solver.
+       *
+       *  \details
+       *  The conjunction is flattened and its duplicated constraints are removed. The variables fixed by an equality
+       *  with a constant (`x == c`, up to references, zero extensions and full extractions) or by an unsigned range
+       *  reduced to a single value are substituted by their value in the other constraints, which are folded when
+       *  they become constant; this is repeated until no variable is fixed anymore. Then, among the unsigned bounds
+       *  of a variable against constants, only the strongest lower and upper bounds are kept. The values of the
+       *  substituted variables are returned to complete the model of the rewritten query.
+       */
+      class QueryPreprocessor {
+        private:
+          //! An unsigned bound of a variable `lo <= x <= hi`.
+          struct Bound {
+            //! The variable.
+            triton::engines::symbolic::SharedSymbolicVariable variable;
+
+            //! The lower bound.
+            triton::uint512 lo;
+
+            //! The upper bound.
+            triton::uint512 hi;
+          };
+
+          //! The statistics of the preprocessor.
+          QueryPreprocessorStatistics stats;
+
+          //! Returns the variable under references, zero extensions and full extractions (nullptr if the node is not a variable).
+          static triton::engines::symbolic::SharedSymbolicVariable getVariable(const triton::ast::SharedAbstractNode& node, triton::uint32& size);
+
+          //! Returns true if a constraint is an unsigned comparison between a variable and a constant, and the range it allows.
+          static bool getBound(const triton::ast::SharedAbstractNode& node, Bound& bound);
+
+          //! Splits a constraint into the operands of its top-level conjunctions (references included).
+          static void split(const triton::ast::SharedAbstractNode& node, std::vector<triton::ast::SharedAbstractNode>& conjuncts);
+
+          //! Replaces the variables by their value. Returns nullptr if the constraint contains a node which cannot be rebuilt.
+          static triton::ast::SharedAbstractNode substitute(const triton::ast::SharedAbstractNode& node, const std::map<triton::usize, triton::ast::SharedAbstractNode>& values, std::unordered_map<const triton::ast::AbstractNode*, triton::ast::SharedAbstractNode>& rewritten);
+
+          //! Rebuilds a node with new children.
+          static triton::ast::SharedAbstractNode rebuild(const triton::ast::SharedAbstractNode& node, const std::vector<triton::ast::SharedAbstractNode>& children);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT QueryPreprocessor();
+
+          /*!
+           * \brief Rewrites a query.
+           *
+           * \details
+           * Returns UNSAT if the query is proven unsat, SAT if no constraint is left (`solved` is then a model of all the variables of the query, the free ones keep their concrete value),
+           * otherwise UNKNOWN: `query` must be solved and its model completed with the values of `solved`.
+           */
+          TRITON_EXPORT triton::engines::solver::status_e process(const triton::ast::SharedAbstractNode& node, triton::ast::SharedAbstractNode& query, std::map<triton::uint32, SolverModel>& solved);
+
+          //! Returns the statistics of the preprocessor.
+          TRITON_EXPORT const QueryPreprocessorStatistics& getStatistics(void) const;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_QUERYPREPROCESSOR_HPP */
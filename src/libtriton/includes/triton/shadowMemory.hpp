@@ -0,0 +1,176 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SHADOWMEMORY_H
+#define TRITON_SHADOWMEMORY_H
+
+#include <memory>
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Taint namespace
+    namespace taint {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup taint
+     *  @{
+     */
+
+      /*! \class ShadowMemory
+       *  \brief One bit of shadow per byte of memory, stored in a two-level page table.
+       *
+       *  \details
+       *  The address space is split into pages of 4 KiB whose bits are stored in a bitmap, pages are grouped
+       *  into tables of 2 MiB indexed by the upper bits of the address. A page or a table only exists while it
+       *  holds at least one set byte, so checking an untouched region costs one lookup per table and setting
+       *  or clearing a range updates whole 64-bit words of the bitmaps. The set bytes are enumerated as ranges
+       *  in a time proportional to the number of pages and ranges. A page may also hold a 32-bit label per byte,
+       *  allocated with its first label; the label of a byte is dropped when the byte is cleared.
+       */
+      class ShadowMemory {
+        public:
+          //! The number of bits of the offset into a page.
+          static const triton::uint32 PAGE_BITS = 12;
+
+          //! The number of bits of the index of a page into a table.
+          static const triton::uint32 TABLE_BITS = 9;
+
+          //! The number of bytes of a page.
+          static const triton::uint64 PAGE_SIZE = (1ULL << PAGE_BITS);
+
+          //! The number of pages of a table.
+          static const triton::uint64 TABLE_PAGES = (1ULL << TABLE_BITS);
+
+          //! The number of bytes of a table.
+          static const triton::uint64 TABLE_SIZE = (1ULL << (PAGE_BITS + TABLE_BITS));
+
+        private:
+          //! The bitmap of a page.
+          struct Page {
+            //! One bit per byte.
+            triton::uint64 bits[PAGE_SIZE / 64];
+
+            //! The number of set bytes.
+            triton::uint32 count;
+
+            //! The labels of the bytes (empty until a byte of the page is labelled).
+            std::vector<triton::uint32> labels;
+          };
+
+          //! The pages of a table (nullptr if no byte is set).
+          struct Table {
+            //! The pages.
+            std::unique_ptr<Page> pages[TABLE_PAGES];
+
+            //! The number of pages.
+            triton::uint32 count;
+          };
+
+          //! The tables indexed by the upper bits of the addresses.
+          std::unordered_map<triton::uint64, std::unique_ptr<Table>> tables;
+
+          //! The number of set bytes.
+          triton::usize bytes;
+
+          //! The number of pages which hold labels.
+          triton::usize labelled;
+
+          //! Returns the page of an address, nullptr if no byte of the page is set.
+          const Page* getPage(triton::uint64 addr) const;
+
+          //! Returns the page of an address, nullptr if no byte of the page is set.
+          Page* getPage(triton::uint64 addr);
+
+          //! Returns the number of bytes from `addr` (at most `size`) which can be skipped because their table does not exist.
+          triton::uint64 getMissingSize(triton::uint64 addr, triton::uint64 size) const;
+
+          //! Sets or clears `size` bytes from `addr` which belong to the same page.
+          void setInPage(triton::uint64 addr, triton::uint64 size, bool flag);
+
+          //! Returns true if one of the `size` bytes from `addr` is set. The bytes belong to the same page.
+          static bool isSetInPage(const Page* page, triton::uint64 addr, triton::uint64 size);
+
+          //! Sets or clears `size` bytes from `addr`, page by page.
+          void setPages(triton::uint64 addr, triton::uint64 size, bool flag);
+
+          //! Returns true if one of the `size` bytes from `addr` is set, checking page by page.
+          bool isSetPages(triton::uint64 addr, triton::uint64 size) const;
+
+          //! Returns the pieces of the `size` bytes from `addr` which belong to an existing table.
+          std::vector<std::pair<triton::uint64, triton::uint64>> getTableRanges(triton::uint64 addr, triton::uint64 size) const;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT ShadowMemory();
+
+          //! Constructor by copy.
+          TRITON_EXPORT ShadowMemory(const ShadowMemory& other);
+
+          //! Copies a ShadowMemory.
+          TRITON_EXPORT ShadowMemory& operator=(const ShadowMemory& other);
+
+          //! Sets or clears `size` bytes from `addr` (the range wraps around the address space).
+          TRITON_EXPORT void set(triton::uint64 addr, triton::uint64 size, bool flag);
+
+          //! Returns true if one of the `size` bytes from `addr` is set.
+          TRITON_EXPORT bool isSet(triton::uint64 addr, triton::uint64 size=1) const;
+
+          //! Returns the addresses of the set bytes.
+          TRITON_EXPORT std::set<triton::uint64> getAddresses(void) const;
+
+          //! Returns the coalesced ranges (address, size) of the set bytes, sorted by address.
+          TRITON_EXPORT std::vector<std::pair<triton::uint64, triton::uint64>> getRanges(void) const;
+
+          //! Sets the label of the set bytes among the `size` bytes from `addr` (0 removes their label).
+          TRITON_EXPORT void setLabel(triton::uint64 addr, triton::uint64 size, triton::uint32 label);
+
+          //! Returns the label of a byte (0 if the byte is not labelled).
+          TRITON_EXPORT triton::uint32 getLabel(triton::uint64 addr) const;
+
+          //! Returns true if a page holds labels.
+          TRITON_EXPORT bool hasLabels(void) const;
+
+          //! Returns the number of set bytes.
+          TRITON_EXPORT triton::usize getSize(void) const;
+
+          //! Returns true if no byte is set.
+          TRITON_EXPORT bool isEmpty(void) const;
+
+          //! Clears all the bytes.
+          TRITON_EXPORT void clear(void);
+      };
+
+    /*! @} End of taint namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SHADOWMEMORY_H */
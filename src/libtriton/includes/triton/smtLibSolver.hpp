@@ -0,0 +1,177 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SMTLIBSOLVER_H
+#define TRITON_SMTLIBSOLVER_H
+
+#include <atomic>
+#include <chrono>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverConfiguration.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverInterface.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/symbolicVariable.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \class SmtLibSolver
+       *  \brief A solver process driven through SMT-LIB v2 on its standard input and output.
+       *
+       *  \details
+       *  The process (e.g. `z3 -in`, `cvc5 --incremental` or `bitwuzla`) is started on the first query and kept
+       *  alive, each query is asserted between a `push` and a `pop` and the models are read back from `get-model`.
+       *  The limits are enforced from outside: the process is killed and restarted when a check runs out of time or
+       *  is interrupted, and its address space is bounded by the memory limit, so a crash or a memory blowup of the
+       *  solver only fails the query. Only available on Unix-like systems.
+       */
+      class SmtLibSolver : public SolverInterface {
+        private:
+          //! A parsed s-expression, an atom or a list.
+          struct SExpression {
+            //! The atom (empty for a list).
+            std::string atom;
+
+            //! The elements of a list.
+            std::vector<SExpression> list;
+          };
+
+          //! The command line of the solver.
+          std::vector<std::string> command;
+
+          //! The pid of the solver process (-1 if not running).
+          mutable std::atomic<triton::sint32> pid;
+
+          //! The end of the socket connected to the standard input and output of the process.
+          mutable triton::sint32 channel;
+
+          //! The bytes read from the process and not consumed yet.
+          mutable std::string pending;
+
+          //! The memory limit (in megabytes) the process has been started with.
+          mutable triton::uint32 memory;
+
+          //! True if the query has been interrupted.
+          mutable std::atomic<bool> interrupted;
+
+          //! Starts the process if it is not running (or if it runs with another memory limit).
+          void start(const SolverLimits& limits) const;
+
+          //! Kills the process.
+          void stop(void) const;
+
+          //! Sends commands to the process.
+          void send(const std::string& commands) const;
+
+          //! Reads the next s-expression printed by the process. Returns TIMEOUT, INTERRUPTED or UNKNOWN (the process died) on failure, SAT otherwise.
+          triton::engines::solver::status_e read(std::string& sexpr, const std::chrono::steady_clock::time_point& deadline) const;
+
+          //! Sends a `check-sat` and returns its answer.
+          triton::engines::solver::status_e check(const std::chrono::steady_clock::time_point& deadline) const;
+
+          //! Sends a `get-model` and returns the values of the variables (0 for the variables the solver did not assign).
+          std::map<triton::uint32, SolverModel> readModel(const std::map<std::string, triton::engines::symbolic::SharedSymbolicVariable>& variables, const std::chrono::steady_clock::time_point& deadline, triton::engines::solver::status_e& status) const;
+
+          //! Starts a query: pushes a scope and asserts the query. Returns the deadline of the query.
+          std::chrono::steady_clock::time_point startQuery(const triton::ast::SharedAbstractNode& node, const SolverLimits& limits, std::map<std::string, triton::engines::symbolic::SharedSymbolicVariable>& variables) const;
+
+          //! Ends a query: pops its scope if the process is still alive. A query interrupted by an exception stops the process instead.
+          void endQuery(void) const;
+
+          //! Parses an s-expression.
+          static SExpression parse(const std::string& sexpr, triton::usize& index);
+
+          //! Parses a bitvector literal (`#x`, `#b` or `(_ bvN size)`).
+          static triton::uint512 parseValue(const SExpression& value);
+
+        public:
+          //! Constructor. The first element of the command is the solver binary, looked up in the PATH.
+          TRITON_EXPORT SmtLibSolver(const std::vector<std::string>& command);
+
+          //! Destructor. Kills the process.
+          TRITON_EXPORT ~SmtLibSolver();
+
+          using SolverInterface::getModel;
+          using SolverInterface::getModels;
+          using SolverInterface::isSat;
+
+          //! Computes and returns a model from a symbolic constraint.
+          /*! \brief map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::map<triton::uint32, SolverModel> getModel(const triton::ast::SharedAbstractNode& node) const;
+
+          //! Computes and returns a model from a symbolic constraint under `limits`. The status of the query is written into `status` if it is not null.
+          TRITON_EXPORT std::map<triton::uint32, SolverModel> getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, const SolverLimits& limits) const;
+
+          //! Computes and returns several models from a symbolic constraint. The `limit` is the max number of models returned.
+          /*! \brief list of map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::list<std::map<triton::uint32, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit) const;
+
+          //! Computes and returns several models from a symbolic constraint under `limits`. The status of the query is written into `status` if it is not null.
+          TRITON_EXPORT std::list<std::map<triton::uint32, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, const SolverLimits& limits) const;
+
+          //! Returns true if an expression is satisfiable.
+          TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node) const;
+
+          //! Returns true if an expression is satisfiable under `limits`. The status of the query is written into `status` if it is not null.
+          TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, const SolverLimits& limits) const;
+
+          //! Interrupts the query being solved by killing the process. May be called from another thread.
+          TRITON_EXPORT void interrupt(void);
+
+          //! Returns the command line of the solver.
+          TRITON_EXPORT const std::vector<std::string>& getCommand(void) const;
+
+          //! Returns the name of the solver.
+          TRITON_EXPORT std::string getName(void) const;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SMTLIBSOLVER_H */
@@ -0,0 +1,305 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SOLVERCACHE_HPP
+#define TRITON_SOLVERCACHE_HPP
+
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/symbolicVariable.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! A 128-bit structural hash of a constraint.
+      typedef std::pair<triton::uint64, triton::uint64> ConstraintHash;
+
+      //! The canonical form of a set of constraints: the sorted and unique hashes of its conjuncts.
+      typedef std::vector<ConstraintHash> ConstraintsKey;
+
+      //! Statistics of the solver cache.
+      struct SolverCacheStatistics {
+        //! Number of queries answered by an entry of the same set of constraints.
+        triton::usize hits;
+
+        //! Number of queries answered unsat because they contain a known-unsat set of constraints.
+        triton::usize unsatSupersetHits;
+
+        //! Number of queries answered by the model of a larger set of constraints.
+        triton::usize satSubsetHits;
+
+        //! Number of queries sent to the solver.
+        triton::usize misses;
+
+        //! Number of entries evicted.
+        triton::usize evictions;
+
+        //! Constructor.
+        SolverCacheStatistics() : hits(0), unsatSupersetHits(0), satSubsetHits(0), misses(0), evictions(0) {}
+      };
+
+      //! An answer of the solver recorded into the cache.
+      struct SolverCacheEntry {
+        //! True if the set of constraints is satisfiable.
+        bool sat;
+
+        //! True if `model` holds a model of the set of constraints.
+        bool hasModel;
+
+        //! A model of the set of constraints (if `hasModel`).
+        std::map<triton::uint32, SolverModel> model;
+
+        //! Constructor.
+        SolverCacheEntry() : sat(false), hasModel(false) {}
+      };
+
+      /*! \class SolverCache
+       *  \brief A counterexample cache of the solver answers.
+       *
+       *  \details
+       *  Queries are keyed by the set of their conjuncts (structural hashes, references unrolled), so the
+       *  order and the duplication of the constraints do not matter. On top of exact matches, a query
+       *  containing a known-unsat set is unsat, and a model of a set of constraints is a model of all its
+       *  subsets (the model may then assign variables which are not in the query). Entries are evicted in
+       *  insertion order once the capacity is reached. The cache is disabled by default.
+       *
+       *  The supersets are looked up through the entries containing the least shared conjunct of the
+       *  query, and each unsat entry is indexed by its least shared conjunct at insertion, so a lookup
+       *  does not scan the whole cache.
+       */
+      class SolverCache {
+        private:
+          //! An entry and its bookkeeping.
+          struct Slot {
+            //! The insertion number of the entry.
+            triton::usize number;
+
+            //! The conjunct indexing the entry if it is unsat.
+            ConstraintHash witness;
+
+            //! The answer.
+            SolverCacheEntry entry;
+          };
+
+          //! The entries indexed by key.
+          typedef std::map<ConstraintsKey, Slot> Entries;
+
+          //! The maximum number of entries (0 disables the cache).
+          triton::usize capacity;
+
+          //! The next insertion number.
+          triton::usize number;
+
+          //! The entries.
+          Entries entries;
+
+          //! The entries by insertion number, the oldest first.
+          std::map<triton::usize, Entries::iterator> order;
+
+          //! The insertion numbers of the entries containing a conjunct.
+          std::map<ConstraintHash, std::set<triton::usize>> conjuncts;
+
+          //! The insertion numbers of the unsat entries indexed by a conjunct.
+          std::map<ConstraintHash, std::set<triton::usize>> witnesses;
+
+          //! The statistics.
+          SolverCacheStatistics stats;
+
+          //! Adds an entry to the indexes.
+          void indexEntry(Entries::iterator it);
+
+          //! Removes an entry from the indexes.
+          void unindexEntry(Entries::iterator it);
+
+          //! Removes the oldest entry.
+          void evictEntry(void);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT SolverCache(triton::usize capacity=0);
+
+          //! Returns the structural hash of a constraint. `hasVariables` is set if the constraint contains a symbolic variable. If `renaming` (variable id -> index) is not null, variables are hashed by their index instead of their id.
+          TRITON_EXPORT static ConstraintHash hashConstraint(const triton::ast::SharedAbstractNode& node, bool& hasVariables, const std::unordered_map<triton::usize, triton::usize>* renaming=nullptr);
+
+          //! Returns the canonical key of a set of constraints. `hasVariables` is set if a constraint contains a symbolic variable.
+          TRITON_EXPORT static ConstraintsKey getKey(const std::vector<triton::ast::SharedAbstractNode>& constraints, bool& hasVariables);
+
+          //! Looks for an answer. If `needModel` is true, only an unsat answer or an answer with a model is returned. Returns nullptr on miss.
+          TRITON_EXPORT const SolverCacheEntry* lookup(const ConstraintsKey& key, bool needModel);
+
+          //! Records an answer of the solver.
+          TRITON_EXPORT void insert(const ConstraintsKey& key, const SolverCacheEntry& entry);
+
+          //! Sets the maximum number of entries (0 disables the cache).
+          TRITON_EXPORT void setCapacity(triton::usize capacity);
+
+          //! Returns the maximum number of entries.
+          TRITON_EXPORT triton::usize getCapacity(void) const;
+
+          //! Returns the number of entries.
+          TRITON_EXPORT triton::usize size(void) const;
+
+          //! Returns the statistics.
+          TRITON_EXPORT const SolverCacheStatistics& getStatistics(void) const;
+
+          //! Removes all the entries and resets the statistics.
+          TRITON_EXPORT void clear(void);
+      };
+
+      //! Statistics of the persistent solver cache.
+      struct PersistentSolverCacheStatistics {
+        //! Number of queries answered by the store.
+        triton::usize hits;
+
+        //! Number of queries not found into the store.
+        triton::usize misses;
+
+        //! Number of records of the log which have been skipped because they are corrupted.
+        triton::usize corruptedRecords;
+
+        //! Number of compactions of the log.
+        triton::usize compactions;
+
+        //! Constructor.
+        PersistentSolverCacheStatistics() : hits(0), misses(0), corruptedRecords(0), compactions(0) {}
+      };
+
+      //! An answer of the solver recorded into the persistent cache.
+      struct PersistentSolverCacheEntry {
+        //! True if the query is satisfiable.
+        bool sat;
+
+        //! True if `values` holds a model of the query.
+        bool hasModel;
+
+        //! The model, indexed by the canonical index of the variables (see PersistentSolverCache::getKey()).
+        std::vector<triton::uint512> values;
+
+        //! The last use of the entry, used for the eviction.
+        triton::usize lastUse;
+
+        //! Constructor.
+        PersistentSolverCacheEntry() : sat(false), hasModel(false), lastUse(0) {}
+      };
+
+      /*! \class PersistentSolverCache
+       *  \brief An on-disk cache of the solver answers shared across runs.
+       *
+       *  \details
+       *  Queries are keyed by an alpha-renamed hash: conjuncts are ordered by their shape (their hash with
+       *  all variables hashed the same), variables are numbered by first occurrence in that order, then
+       *  the conjuncts are hashed with the variables replaced by their number. Two queries which only
+       *  differ by the numbering of their variables share the same key and a model is stored as the values
+       *  of the numbered variables.
+       *
+       *  The store is an append-only log of checksummed records indexed in memory, a corrupted or truncated
+       *  record is skipped. The records appended by the other processes are read on miss. Once the log is larger
+       *  than the maximum size, it is rewritten with the most recently used entries up to half the maximum size
+       *  and atomically renamed over the previous log. On POSIX systems, several processes can share the same
+       *  log: the appends and the compactions hold an advisory lock on `<path>.lock` and a compaction first reads
+       *  the records appended by the others, so that none is lost. The lock file also holds the generation of the
+       *  log, increased by each compaction, so that the others index the new log again. Elsewhere, the records
+       *  appended by another process during a compaction are lost.
+       */
+      class PersistentSolverCache {
+        private:
+          //! The path of the log.
+          std::string path;
+
+          //! The maximum size (in bytes) of the log.
+          triton::usize maxSize;
+
+          //! The number of bytes of the log already indexed.
+          triton::usize offset;
+
+          //! The generation of the indexed log, increased by the compactions (see the lock file of the log).
+          triton::uint64 generation;
+
+          //! The clock of the uses of the entries.
+          triton::usize clock;
+
+          //! The index of the log.
+          std::map<ConstraintHash, PersistentSolverCacheEntry> entries;
+
+          //! The statistics.
+          PersistentSolverCacheStatistics stats;
+
+          //! Serializes a record of the log.
+          static std::string serialize(const ConstraintHash& key, const PersistentSolverCacheEntry& entry);
+
+          //! Indexes the records of a chunk of the log. Returns the number of bytes consumed.
+          triton::usize parse(const std::string& data);
+
+          //! Indexes the records appended since the last read (the whole log if it has been compacted meanwhile).
+          void refresh(void);
+
+          //! Rewrites the log with the most recently used entries. The lock of the log must be held.
+          void compact(void);
+
+        public:
+          //! Constructor. Opens (or creates) the log and indexes its records.
+          TRITON_EXPORT PersistentSolverCache(const std::string& path, triton::usize maxSize);
+
+          //! Returns the alpha-renamed key of a set of constraints and fills `variables` with its variables in canonical order.
+          TRITON_EXPORT static ConstraintHash getKey(const std::vector<triton::ast::SharedAbstractNode>& constraints, std::vector<triton::engines::symbolic::SharedSymbolicVariable>& variables);
+
+          //! Looks for an answer. If `needModel` is true, only an unsat answer or an answer with a model is returned. Returns false on miss.
+          TRITON_EXPORT bool lookup(const ConstraintHash& key, bool needModel, PersistentSolverCacheEntry& entry);
+
+          //! Appends an answer of the solver to the log under its lock, and compacts it if it is too large.
+          TRITON_EXPORT void insert(const ConstraintHash& key, const PersistentSolverCacheEntry& entry);
+
+          //! Returns the path of the log.
+          TRITON_EXPORT const std::string& getPath(void) const;
+
+          //! Returns the maximum size (in bytes) of the log.
+          TRITON_EXPORT triton::usize getMaxSize(void) const;
+
+          //! Returns the number of indexed entries.
+          TRITON_EXPORT triton::usize size(void) const;
+
+          //! Returns the statistics.
+          TRITON_EXPORT const PersistentSolverCacheStatistics& getStatistics(void) const;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERCACHE_HPP */
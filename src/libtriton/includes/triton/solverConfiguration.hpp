@@ -0,0 +1,80 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SOLVERCONFIGURATION_HPP
+#define TRITON_SOLVERCONFIGURATION_HPP
+
+#include <string>
+
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! A configuration of the solver raced by the portfolio mode.
+      struct SolverConfiguration {
+        //! The name of the configuration, used to report the winner.
+        std::string name;
+
+        //! The z3 tactic building the solver (empty for the default solver).
+        std::string tactic;
+
+        //! The random seed of the solver (0 keeps the default seed).
+        triton::uint32 seed;
+
+        //! Constructor.
+        SolverConfiguration(const std::string& name="", const std::string& tactic="", triton::uint32 seed=0) : name(name), tactic(tactic), seed(seed) {}
+      };
+
+      //! The resource limits of a query (0 means no limit).
+      struct SolverLimits {
+        //! The wall time limit (in milliseconds) of each check.
+        triton::uint32 timeout;
+
+        //! The memory limit (in megabytes).
+        triton::uint32 memory;
+
+        //! The maximum number of conflicts of each check.
+        triton::uint32 conflicts;
+
+        //! Constructor.
+        SolverLimits(triton::uint32 timeout=0, triton::uint32 memory=0, triton::uint32 conflicts=0) : timeout(timeout), memory(memory), conflicts(conflicts) {}
+
+        //! Returns these limits where the unset ones are taken from `defaults`.
+        SolverLimits merge(const SolverLimits& defaults) const {
+          return SolverLimits(this->timeout ? this->timeout : defaults.timeout, this->memory ? this->memory : defaults.memory, this->conflicts ? this->conflicts : defaults.conflicts);
+        }
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERCONFIGURATION_HPP */
@@ -8,18 +8,39 @@
 #ifndef TRITON_SOLVERENGINE_HPP
 #define TRITON_SOLVERENGINE_HPP
 
+#include <atomic>
+#include <chrono>
+#include <functional>
 #include <iostream>
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #include <triton/ast.hpp>
+#include <triton/constraintEvaluator.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/intervalSolver.hpp>
+#include <triton/localSearch.hpp>
+#include <triton/modelPool.hpp>
+#include <triton/modes.hpp>
+#include <triton/pathConstraint.hpp>
+#include <triton/pathVariablesIndex.hpp>
+#include <triton/queryPreprocessor.hpp>
+#include <triton/smtLibSolver.hpp>
+#include <triton/solverCache.hpp>
+#include <triton/solverConfiguration.hpp>
 #include <triton/solverEnums.hpp>
 #include <triton/solverInterface.hpp>
 #include <triton/solverModel.hpp>
+#include <triton/solverRecorder.hpp>
+#include <triton/symbolicVariable.hpp>
 #include <triton/tritonTypes.hpp>
 #ifdef Z3_INTERFACE
+  #include <triton/z3Portfolio.hpp>
+  #include <triton/z3Session.hpp>
   #include <triton/z3Solver.hpp>
 #endif
 
@@ -46,9 +67,33 @@ namespace triton {
      *  @{
      */
 
+      //! A cluster of constraints which does not share symbolic variables with the other clusters.
+      struct ConstraintsCluster {
+        //! The constraints of the cluster.
+        std::vector<triton::ast::SharedAbstractNode> constraints;
+
+        //! The symbolic variables of the cluster, indexed by id.
+        std::map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable> variables;
+
+        //! True if the current concrete values satisfy all the constraints of the cluster.
+        bool satisfied;
+
+        //! Constructor.
+        ConstraintsCluster() : satisfied(true) {}
+      };
+
+
+      //! Receives the model of a branch flip (the index of the flipped path constraint and its model, empty if unsat or on timeout).
+      using BranchFlipCallback = std::function<void(triton::usize index, const std::map<triton::uint32, SolverModel>& model)>;
+
+
       /*! \interface SolverEngine
           \brief This class is used to interface with solvers */
       class SolverEngine {
+        private:
+          //! Modes API.
+          triton::modes::Modes& modes;
+
         protected:
           //! The kind of the current solver used.
           triton::engines::solver::solver_e kind;
@@ -56,9 +101,136 @@ namespace triton {
           //! Instance to the real solver class.
           std::unique_ptr<triton::engines::solver::SolverInterface> solver;
 
+          //! The cache of the solver answers.
+          mutable triton::engines::solver::SolverCache cache;
+
+          #ifdef Z3_INTERFACE
+          //! The incremental session of the z3 solver (created on first use).
+          mutable std::unique_ptr<triton::engines::solver::Z3Session> session;
+
+          //! The sessions of the running branch flip workers and the stop flags of their calls, reached by interrupt().
+          mutable std::list<std::pair<triton::engines::solver::Z3Session*, std::atomic<bool>*>> flipSessions;
+
+          //! The contexts of the running portfolio races and the stop flags of their calls, reached by interrupt().
+          mutable std::list<std::pair<z3::context*, std::atomic<bool>*>> raceContexts;
+
+          //! Protects the sessions of the branch flip workers and the contexts of the portfolio races.
+          mutable std::mutex flipSessionsMutex;
+          #endif
+
+          //! Returns the conjunction of the `count` first taken constraints of a path and of a query.
+          triton::ast::SharedAbstractNode getPathQuery(const std::vector<triton::engines::symbolic::PathConstraint>& path, triton::usize count, const triton::ast::SharedAbstractNode& query) const;
+
+          //! The configurations raced by the portfolio mode (enabled with at least two configurations).
+          std::vector<triton::engines::solver::SolverConfiguration> portfolio;
+
+          //! The number of wins of each configuration of the portfolio.
+          mutable std::vector<triton::usize> portfolioWins;
+
+          //! The name of the configuration which answered the last query raced by the portfolio.
+          mutable std::string portfolioWinner;
+
+          //! Records the winner of a race of the portfolio.
+          void notePortfolioWinner(triton::usize winner) const;
+
+          #ifdef Z3_INTERFACE
+          //! Races the portfolio on a query so that interrupt() reaches its contexts, and records the winner.
+          void racePortfolio(const triton::ast::SharedAbstractNode& query, bool needModel, triton::engines::solver::status_e& status, const SolverLimits& limits, std::map<triton::uint32, SolverModel>& model) const;
+          #endif
+
+          //! The default limits of the queries.
+          SolverLimits limits;
+
+          //! The local search tried before the solver (see the SOLVER_LOCAL_SEARCH mode).
+          mutable triton::engines::solver::LocalSearch localSearch;
+
+          //! The decision procedure of the linear comparisons tried before the solver (see the SOLVER_INTERVALS mode).
+          mutable triton::engines::solver::IntervalSolver intervalSolver;
+
+          //! The recently found models tried before the solver (see the SOLVER_MODEL_REUSE mode).
+          mutable triton::engines::solver::ModelPool modelPool;
+
+          //! The rewriting of the queries before the solver (see the SOLVER_PREPROCESSING mode).
+          mutable triton::engines::solver::QueryPreprocessor preprocessor;
+
+          //! Protects the state of the fast paths (local search, interval solver and pool of models), shared with the branch flip workers.
+          mutable std::mutex searchMutex;
+
+          //! The constraints of the last path given to the incremental queries, indexed by their variables.
+          mutable triton::engines::solver::PathVariablesIndex pathIndex;
+
+          //! Returns true if a fast path is enabled (SOLVER_MODEL_REUSE, SOLVER_INTERVALS or SOLVER_LOCAL_SEARCH modes).
+          bool hasFastPaths(void) const;
+
+          //! Rewrites a query before the solver (SOLVER_PREPROCESSING mode). Returns false if the query is answered by the rewriting, `status` is then set and `solved` is its model. Otherwise, `solved` holds the values of the variables removed from `simplified`.
+          bool preprocessQuery(const triton::ast::SharedAbstractNode& query, triton::ast::SharedAbstractNode& simplified, std::map<triton::uint32, SolverModel>& solved, triton::engines::solver::status_e& status) const;
+
+          //! Answers a query with a known assignment (SOLVER_MODEL_REUSE mode), the interval solver (SOLVER_INTERVALS mode) or the local search (SOLVER_LOCAL_SEARCH mode). Returns false if the query must be sent to the solver, otherwise `status` is set.
+          bool searchModel(const triton::ast::SharedAbstractNode& query, std::map<triton::uint32, SolverModel>& model, triton::engines::solver::status_e& status) const;
+
+          //! Like searchModel() for the `count` first constraints of an indexed path and a query, but only on the constraints sharing variables with the query. Returns false if the other constraints are not satisfied by the concrete values.
+          bool searchPathModel(const triton::engines::solver::PathVariablesIndex& index, triton::usize count, const triton::ast::SharedAbstractNode& query, std::map<triton::uint32, SolverModel>& model, triton::engines::solver::status_e& status) const;
+
+          //! Adds a model found by the solver to the pool of models (SOLVER_MODEL_REUSE mode).
+          void rememberModel(const std::map<triton::uint32, SolverModel>& model) const;
+
+          //! The fallbacks of the flipped branches whose query is unsat or unanswered.
+          triton::engines::solver::optimistic_e optimistic;
+
+          //! Computes a model of a query with the solver or the portfolio under `limits`. The status of the query is written into `status`, only sat and unsat answers are cached.
+          std::map<triton::uint32, SolverModel> getSolverModel(const triton::ast::SharedAbstractNode& query, triton::engines::solver::status_e& status, const SolverLimits& limits) const;
+
+          //! Checks the satisfiability of a query with the solver or the portfolio under `limits`. The status of the query is written into `status`.
+          bool isSolverSat(const triton::ast::SharedAbstractNode& query, triton::engines::solver::status_e& status, const SolverLimits& limits) const;
+
+          //! Finds a value of a bitvector expression under the `count` first taken constraints of a path and a constraint, without incremental session. Returns the status of the query.
+          triton::engines::solver::status_e getPathValue(const std::vector<triton::engines::symbolic::PathConstraint>& path, triton::usize count, const ConstraintEvaluator& evaluator, const triton::ast::SharedAbstractNode& constraint, triton::uint512& value) const;
+
+          //! Computes the smallest or the greatest value of a bitvector expression under the `count` first taken constraints of a path.
+          triton::uint512 getBoundValue(const std::vector<triton::engines::symbolic::PathConstraint>& path, triton::usize count, const triton::ast::SharedAbstractNode& node, bool maximize, triton::engines::solver::status_e* status) const;
+
+          //! The persistent cache of the solver answers (nullptr if there is none).
+          std::unique_ptr<triton::engines::solver::PersistentSolverCache> persistentCache;
+
+          //! The recorder of the queries (nullptr if the queries are not recorded).
+          std::unique_ptr<triton::engines::solver::SolverRecorder> recorder;
+
+          //! The address of the instruction being processed, recorded with the queries.
+          triton::uint64 queryAddress;
+
+          //! Records a query started at `start`.
+          void recordQuery(const std::string& kind, const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e status, const std::chrono::steady_clock::time_point& start) const;
+
+          //! Computes a model of a conjunction through the persistent cache.
+          std::map<triton::uint32, SolverModel> getPersistentModel(const triton::ast::SharedAbstractNode& query, const std::vector<triton::ast::SharedAbstractNode>& conjuncts, triton::engines::solver::status_e& status, const SolverLimits& limits) const;
+
+          //! Checks the satisfiability of a conjunction through the persistent cache.
+          bool isPersistentSat(const triton::ast::SharedAbstractNode& query, const std::vector<triton::ast::SharedAbstractNode>& conjuncts, triton::engines::solver::status_e& status, const SolverLimits& limits) const;
+
+          //! Computes a model of a conjunction through the cache.
+          std::map<triton::uint32, SolverModel> getCachedModel(const triton::ast::SharedAbstractNode& query, const std::vector<triton::ast::SharedAbstractNode>& conjuncts, triton::engines::solver::status_e& status, const SolverLimits& limits) const;
+
+          //! Completes a model with the concrete values of the variables of a query the solver left unassigned (SOLVER_MODEL_COMPLETION mode).
+          void completeModel(const triton::ast::SharedAbstractNode& query, std::map<triton::uint32, SolverModel>& model) const;
+
+          //! Checks the satisfiability of a conjunction through the cache.
+          bool isCachedSat(const triton::ast::SharedAbstractNode& query, const std::vector<triton::ast::SharedAbstractNode>& conjuncts, triton::engines::solver::status_e& status, const SolverLimits& limits) const;
+
+          //! Splits a constraint into the operands of its top-level conjunctions.
+          void splitConjunction(const triton::ast::SharedAbstractNode& node, std::vector<triton::ast::SharedAbstractNode>& conjuncts) const;
+
+          //! Computes the model of a constraint by solving only its unsatisfied independent clusters.
+          std::map<triton::uint32, SolverModel> getIndependentModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e& status, const SolverLimits& limits) const;
+
+          //! Returns true if a constraint is satisfiable by solving only its unsatisfied independent clusters.
+          bool isIndependentSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e& status, const SolverLimits& limits) const;
+
         public:
           //! Constructor.
-          TRITON_EXPORT SolverEngine();
+          TRITON_EXPORT SolverEngine(triton::modes::Modes& modes);
+
+          //! Partitions a conjunction into clusters of constraints which do not share symbolic variables.
+          TRITON_EXPORT std::vector<ConstraintsCluster> getIndependentClusters(const triton::ast::SharedAbstractNode& node) const;
 
           //! Returns the kind of solver as triton::engines::solver::solver_e.
           TRITON_EXPORT triton::engines::solver::solver_e getSolver(void) const;
@@ -72,17 +244,20 @@ namespace triton {
           //! Initializes a custom solver.
           TRITON_EXPORT void setCustomSolver(triton::engines::solver::SolverInterface* customSolver);
 
+          //! Initializes an external solver process which speaks SMT-LIB v2 (e.g. `{"z3", "-in"}`).
+          TRITON_EXPORT void setSmtLibSolver(const std::vector<std::string>& command);
+
           //! Returns true if the solver is valid.
           TRITON_EXPORT bool isValid(void) const;
 
-          //! Computes and returns a model from a symbolic constraint.
+          //! Computes and returns a model from a symbolic constraint. The status of the query is written into `status` if it is not null, the unset `limits` are taken from the default limits.
           /*! \brief map of symbolic variable id -> model
            *
            * \details
            * **item1**: symbolic variable id<br>
            * **item2**: model
            */
-          TRITON_EXPORT std::map<triton::uint32, SolverModel> getModel(const triton::ast::SharedAbstractNode& node) const;
+          TRITON_EXPORT std::map<triton::uint32, SolverModel> getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status=nullptr, const SolverLimits& limits=SolverLimits()) const;
 
           //! Computes and returns several models from a symbolic constraint. The `limit` is the max number of models returned.
           /*! \brief list of map of symbolic variable id -> model
@@ -91,13 +266,141 @@ namespace triton {
            * **item1**: symbolic variable id<br>
            * **item2**: model
            */
-          TRITON_EXPORT std::list<std::map<triton::uint32, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit) const;
+          TRITON_EXPORT std::list<std::map<triton::uint32, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status=nullptr, const SolverLimits& limits=SolverLimits()) const;
+
+          //! Returns true if an expression is satisfiable. The status of the query is written into `status` if it is not null, the unset `limits` are taken from the default limits.
+          TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status=nullptr, const SolverLimits& limits=SolverLimits()) const;
+
+          //! Computes a model of the `count` first taken constraints of a path and of a query. With z3, the path is asserted incrementally into a session kept across queries.
+          TRITON_EXPORT std::map<triton::uint32, SolverModel> getIncrementalModel(const std::vector<triton::engines::symbolic::PathConstraint>& path, triton::usize count, const triton::ast::SharedAbstractNode& query, triton::engines::solver::status_e* status=nullptr) const;
+
+          //! Returns true if the `count` first taken constraints of a path and a query are satisfiable. With z3, the path is asserted incrementally into a session kept across queries.
+          TRITON_EXPORT bool isIncrementalSat(const std::vector<triton::engines::symbolic::PathConstraint>& path, triton::usize count, const triton::ast::SharedAbstractNode& query, triton::engines::solver::status_e* status=nullptr) const;
+
+          /*!
+           * \brief Computes a model of the `count` first taken constraints of a path and of a query, with the optimistic fallbacks.
+           *
+           * \details
+           * If the whole query is unsat or unanswered (except when interrupted), the fallbacks of the optimistic strategy are solved in turn:
+           * the query and the prefix constraints which share a variable with it (OPTIMISTIC_DEPENDENT), then the query alone. The model of a
+           * fallback satisfies only a part of the path, `optimistic` is then set to true and the model must be validated (e.g. by re-execution).
+           */
+          TRITON_EXPORT std::map<triton::uint32, SolverModel> getOptimisticModel(const std::vector<triton::engines::symbolic::PathConstraint>& path, triton::usize count, const triton::ast::SharedAbstractNode& query, bool* optimistic=nullptr, triton::engines::solver::status_e* status=nullptr) const;
+
+          //! Enumerates up to `limit` distinct values of a bitvector expression under the `count` first taken constraints of a path. The models are blocked on the value of the expression only, the status is SAT once all the values (or `limit` of them) are found.
+          TRITON_EXPORT std::vector<triton::uint512> getValues(const std::vector<triton::engines::symbolic::PathConstraint>& path, triton::usize count, const triton::ast::SharedAbstractNode& node, triton::usize limit, triton::engines::solver::status_e* status=nullptr) const;
+
+          //! Returns the smallest (unsigned) value of a bitvector expression under the `count` first taken constraints of a path. On a timeout, the best value found so far is returned with the status of the query.
+          TRITON_EXPORT triton::uint512 getMinValue(const std::vector<triton::engines::symbolic::PathConstraint>& path, triton::usize count, const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status=nullptr) const;
+
+          //! Returns the greatest (unsigned) value of a bitvector expression under the `count` first taken constraints of a path. On a timeout, the best value found so far is returned with the status of the query.
+          TRITON_EXPORT triton::uint512 getMaxValue(const std::vector<triton::engines::symbolic::PathConstraint>& path, triton::usize count, const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status=nullptr) const;
+
+          //! Sets the fallbacks of the flipped branches whose query is unsat or unanswered.
+          TRITON_EXPORT void setOptimisticStrategy(triton::engines::solver::optimistic_e strategy);
+
+          //! Returns the fallbacks of the flipped branches whose query is unsat or unanswered.
+          TRITON_EXPORT triton::engines::solver::optimistic_e getOptimisticStrategy(void) const;
+
+          //! Sets the default limits of the queries.
+          TRITON_EXPORT void setLimits(const SolverLimits& limits);
+
+          //! Returns the default limits of the queries.
+          TRITON_EXPORT const SolverLimits& getLimits(void) const;
+
+          //! Interrupts the query being solved by the solver, the incremental session, the portfolio race or the branch flip workers. May be called from another thread, the query answers `INTERRUPTED`.
+          TRITON_EXPORT void interrupt(void);
+
+          /*!
+           * \brief Solves several branch flips of a path concurrently and returns their models indexed by the index of the flipped path constraint.
+           *
+           * \details
+           * A flip is the index `k` of a path constraint and a query, it is solved with the `k` first taken constraints of the path.
+           * With z3, the flips are distributed on `maxThreads` workers (0 means one less than the number of cores), each one owning
+           * an incremental session in its own z3 context, and `timeout` (in milliseconds, 0 means the default limit) bounds each query. The
+           * callback is called from the calling thread as soon as each flip is solved. Other solvers solve the flips sequentially.
+           * The workers solve a copy of the path but still read its ASTs and the concrete values, so the callback must not modify the context
+           * (no processing, no new path constraint, no `setAst`, no new concrete value). An interrupt stops the workers: the flips being solved answer an empty model and the others are not reported.
+           */
+          TRITON_EXPORT std::map<triton::usize, std::map<triton::uint32, SolverModel>> solveBranchFlips(const std::vector<triton::engines::symbolic::PathConstraint>& path, const std::vector<std::pair<triton::usize, triton::ast::SharedAbstractNode>>& flips, triton::usize maxThreads, triton::uint32 timeout, const BranchFlipCallback& callback) const;
+
+          //! Sets the configurations raced by the portfolio mode. With at least two configurations, each query sent to z3 is solved by all of them in parallel and the first answer wins.
+          TRITON_EXPORT void setPortfolio(const std::vector<SolverConfiguration>& configurations);
 
-          //! Returns true if an expression is satisfiable.
-          TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node) const;
+          //! Returns the configurations raced by the portfolio mode.
+          TRITON_EXPORT const std::vector<SolverConfiguration>& getPortfolio(void) const;
+
+          //! Returns the number of wins of each configuration of the portfolio.
+          TRITON_EXPORT const std::vector<triton::usize>& getPortfolioWins(void) const;
+
+          //! Returns the name of the configuration which answered the last query raced by the portfolio.
+          TRITON_EXPORT const std::string& getPortfolioWinner(void) const;
+
+          //! Releases the incremental session and the index of its path.
+          TRITON_EXPORT void resetIncrementalSession(void);
 
           //! Returns the name of the solver.
           TRITON_EXPORT std::string getName(void) const;
+
+          //! Sets the maximum number of entries of the solver cache (0, the default, disables the cache).
+          TRITON_EXPORT void setCacheCapacity(triton::usize capacity);
+
+          //! Returns the maximum number of entries of the solver cache.
+          TRITON_EXPORT triton::usize getCacheCapacity(void) const;
+
+          //! Returns the statistics of the solver cache.
+          TRITON_EXPORT const SolverCacheStatistics& getCacheStatistics(void) const;
+
+          //! Clears the solver cache.
+          TRITON_EXPORT void clearCache(void);
+
+          //! Opens (or creates) a persistent cache of the solver answers shared across runs. The log is compacted past `maxSize` bytes.
+          TRITON_EXPORT void openPersistentCache(const std::string& path, triton::usize maxSize);
+
+          //! Closes the persistent cache.
+          TRITON_EXPORT void closePersistentCache(void);
+
+          //! Returns true if a persistent cache is opened.
+          TRITON_EXPORT bool isPersistentCacheOpened(void) const;
+
+          //! Returns the statistics of the persistent cache.
+          TRITON_EXPORT const PersistentSolverCacheStatistics& getPersistentCacheStatistics(void) const;
+
+          //! Starts appending the queries (with their timing, status and address) to a capture file.
+          TRITON_EXPORT void startRecording(const std::string& path);
+
+          //! Stops recording the queries.
+          TRITON_EXPORT void stopRecording(void);
+
+          //! Returns true if the queries are recorded.
+          TRITON_EXPORT bool isRecording(void) const;
+
+          //! Sets the maximum number of evaluations of a query by the local search.
+          TRITON_EXPORT void setLocalSearchBudget(triton::usize budget);
+
+          //! Returns the maximum number of evaluations of a query by the local search.
+          TRITON_EXPORT triton::usize getLocalSearchBudget(void) const;
+
+          //! Returns the statistics of the local search.
+          TRITON_EXPORT const LocalSearchStatistics& getLocalSearchStatistics(void) const;
+
+          //! Returns the statistics of the interval solver.
+          TRITON_EXPORT const IntervalSolverStatistics& getIntervalSolverStatistics(void) const;
+
+          //! Returns the statistics of the rewriting of the queries.
+          TRITON_EXPORT const QueryPreprocessorStatistics& getPreprocessorStatistics(void) const;
+
+          //! Sets the maximum number of recent models tried before the solver.
+          TRITON_EXPORT void setModelPoolCapacity(triton::usize capacity);
+
+          //! Returns the maximum number of recent models tried before the solver.
+          TRITON_EXPORT triton::usize getModelPoolCapacity(void) const;
+
+          //! Returns the statistics of the pool of models.
+          TRITON_EXPORT const ModelPoolStatistics& getModelPoolStatistics(void) const;
+
+          //! Sets the address of the instruction being processed, recorded with the queries.
+          TRITON_EXPORT void setQueryAddress(triton::uint64 address);
       };
 
     /*! @} End of solver namespace */
@@ -40,6 +40,24 @@ namespace triton {
         #ifdef Z3_INTERFACE
         SOLVER_Z3,          /*!< z3 solver. */
         #endif
+        SOLVER_SMTLIB = 3,  /*!< external SMT-LIB solver process. */
+      };
+
+      /*! The different status of a query */
+      enum status_e {
+        UNSAT = 0,   /*!< the query is unsatisfiable. */
+        SAT,         /*!< the query is satisfiable. */
+        TIMEOUT,     /*!< the time limit has been reached. */
+        OUTOFMEM,    /*!< the memory limit has been reached. */
+        INTERRUPTED, /*!< the query has been interrupted. */
+        UNKNOWN,     /*!< the solver did not answer (e.g. the conflict limit has been reached). */
+      };
+
+      /*! The fallbacks of a flipped branch whose query is unsat or unanswered */
+      enum optimistic_e {
+        OPTIMISTIC_DISABLED = 0, /*!< only complete models are returned. */
+        OPTIMISTIC_LAST,         /*!< falls back to the negated branch alone. */
+        OPTIMISTIC_DEPENDENT,    /*!< falls back to the negated branch and the prefix constraints sharing a variable with it, then to the negated branch alone. */
       };
 
     /*! @} End of solver namespace */
@@ -13,6 +13,8 @@
 
 #include <triton/ast.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/solverConfiguration.hpp>
+#include <triton/solverEnums.hpp>
 #include <triton/solverModel.hpp>
 #include <triton/tritonTypes.hpp>
 
@@ -55,6 +57,19 @@ namespace triton {
            */
           TRITON_EXPORT virtual std::map<triton::uint32, SolverModel> getModel(const triton::ast::SharedAbstractNode& node) const = 0;
 
+          //! Computes and returns a model from a symbolic constraint under `limits`. The status of the query is written into `status` if it is not null. By default, the limits are ignored and a query without model is `UNKNOWN`.
+          TRITON_EXPORT virtual std::map<triton::uint32, SolverModel> getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, const SolverLimits& limits) const {
+            std::map<triton::uint32, SolverModel> ret = this->getModel(node);
+            if (status != nullptr)
+              *status = ret.empty() ? triton::engines::solver::UNKNOWN : triton::engines::solver::SAT;
+            return ret;
+          }
+
+          //! Computes and returns a model from a symbolic constraint with the default limits. The status of the query is written into `status` if it is not null.
+          TRITON_EXPORT std::map<triton::uint32, SolverModel> getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status) const {
+            return this->getModel(node, status, SolverLimits());
+          }
+
           //! Computes and returns several models from a symbolic constraint. The `limit` is the max number of models returned.
           /*! \brief list of map of symbolic variable id -> model
            *
@@ -64,9 +79,38 @@ namespace triton {
            */
           TRITON_EXPORT virtual std::list<std::map<triton::uint32, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit) const = 0;
 
+          //! Computes and returns several models from a symbolic constraint under `limits`. The status of the query is written into `status` if it is not null. By default, the limits are ignored and a query without model is `UNKNOWN`.
+          TRITON_EXPORT virtual std::list<std::map<triton::uint32, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, const SolverLimits& limits) const {
+            std::list<std::map<triton::uint32, SolverModel>> ret = this->getModels(node, limit);
+            if (status != nullptr)
+              *status = ret.empty() ? triton::engines::solver::UNKNOWN : triton::engines::solver::SAT;
+            return ret;
+          }
+
+          //! Computes and returns several models from a symbolic constraint with the default limits. The status of the query is written into `status` if it is not null.
+          TRITON_EXPORT std::list<std::map<triton::uint32, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status) const {
+            return this->getModels(node, limit, status, SolverLimits());
+          }
+
           //! Returns true if an expression is satisfiable.
           TRITON_EXPORT virtual bool isSat(const triton::ast::SharedAbstractNode& node) const = 0;
 
+          //! Returns true if an expression is satisfiable under `limits`. The status of the query is written into `status` if it is not null. By default, the limits are ignored and an unsatisfiable answer is `UNKNOWN`.
+          TRITON_EXPORT virtual bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, const SolverLimits& limits) const {
+            bool ret = this->isSat(node);
+            if (status != nullptr)
+              *status = ret ? triton::engines::solver::SAT : triton::engines::solver::UNKNOWN;
+            return ret;
+          }
+
+          //! Returns true if an expression is satisfiable with the default limits. The status of the query is written into `status` if it is not null.
+          TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status) const {
+            return this->isSat(node, status, SolverLimits());
+          }
+
+          //! Interrupts the query being solved. May be called from another thread, does nothing by default.
+          TRITON_EXPORT virtual void interrupt(void) {};
+
           //! Returns the name of the solver.
           TRITON_EXPORT virtual std::string getName(void) const = 0;
       };
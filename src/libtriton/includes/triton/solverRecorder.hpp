@@ -0,0 +1,121 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SOLVERRECORDER_HPP
+#define TRITON_SOLVERRECORDER_HPP
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! A query of the solver read from a capture.
+      struct SolverRecord {
+        //! The number of the query into the capture.
+        triton::usize id;
+
+        //! The kind of query (`getModel`, `getModels` or `isSat`).
+        std::string kind;
+
+        //! The address of the instruction processed when the query has been sent.
+        triton::uint64 address;
+
+        //! The answer of the solver.
+        triton::engines::solver::status_e status;
+
+        //! The time (in microseconds) spent to answer.
+        triton::uint64 time;
+
+        //! The query as a SMT-LIB script.
+        std::string smt;
+
+        //! Constructor.
+        SolverRecord() : id(0), address(0), status(triton::engines::solver::UNKNOWN), time(0) {}
+      };
+
+      /*! \class SolverRecorder
+       *  \brief Appends the queries of the solver to a capture file.
+       *
+       *  \details
+       *  Each record is a self-contained SMT-LIB script (declarations of the variables, one `define-fun` per
+       *  symbolic expression referenced by the query so that shared sub-expressions are printed once, the
+       *  assertion and a `check-sat`) preceded by a header of `; @key value` comments (kind, address, status
+       *  and time) and followed by `; @end`. A capture can be replayed by `triton-solver-bench` or by any
+       *  SMT-LIB solver.
+       */
+      class SolverRecorder {
+        private:
+          //! The path of the capture.
+          std::string path;
+
+          //! The capture.
+          std::ofstream stream;
+
+          //! The number of the first query recorded by this recorder, following the queries already in the capture.
+          triton::usize first;
+
+          //! The number of recorded queries.
+          triton::usize count;
+
+        public:
+          //! Constructor. Opens (or creates) the capture, new queries are appended and numbered after the existing ones.
+          TRITON_EXPORT SolverRecorder(const std::string& path);
+
+          //! Returns a query as a SMT-LIB script, ended by a `check-sat` if `checkSat` is true.
+          TRITON_EXPORT static std::string toSmtLib(const triton::ast::SharedAbstractNode& node, bool checkSat=true);
+
+          //! Returns the name of a status as written into the captures.
+          TRITON_EXPORT static std::string getStatusName(triton::engines::solver::status_e status);
+
+          //! Reads the records of a capture.
+          TRITON_EXPORT static std::vector<SolverRecord> load(const std::string& path);
+
+          //! Appends a query to the capture.
+          TRITON_EXPORT void record(const std::string& kind, triton::uint64 address, const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e status, triton::uint64 time);
+
+          //! Returns the path of the capture.
+          TRITON_EXPORT const std::string& getPath(void) const;
+
+          //! Returns the number of queries recorded by this recorder.
+          TRITON_EXPORT triton::usize getCount(void) const;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERRECORDER_HPP */
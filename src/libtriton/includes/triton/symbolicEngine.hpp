@@ -11,8 +11,11 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include <triton/architecture.hpp>
 #include <triton/ast.hpp>
@@ -24,7 +27,9 @@
 #include <triton/register.hpp>
 #include <triton/symbolicEnums.hpp>
 #include <triton/symbolicExpression.hpp>
+#include <triton/symbolicExpressionView.hpp>
 #include <triton/symbolicSimplification.hpp>
+#include <triton/symbolicTable.hpp>
 #include <triton/symbolicVariable.hpp>
 #include <triton/tritonTypes.hpp>
 
@@ -53,6 +58,28 @@ namespace triton {
      *  @{
      */
 
+      //! Statistics of the memory budget eviction.
+      struct EvictionStatistics {
+        //! Number of eviction passes.
+        triton::usize passes;
+
+        //! Number of registers concretized by the eviction.
+        triton::usize evictedRegisters;
+
+        //! Number of memory cells concretized by the eviction.
+        triton::usize evictedMemoryCells;
+
+        //! Number of symbolic expressions released after the evictions.
+        triton::usize releasedExpressions;
+
+        //! Estimated number of bytes released after the evictions.
+        triton::usize releasedBytes;
+
+        //! Constructor.
+        EvictionStatistics() : passes(0), evictedRegisters(0), evictedMemoryCells(0), releasedExpressions(0), releasedBytes(0) {}
+      };
+
+
       //! \class SymbolicEngine
       /*! \brief The symbolic engine class. */
       class SymbolicEngine
@@ -72,21 +99,89 @@ namespace triton {
           //! Symbolic variables id.
           triton::usize uniqueSymVarId;
 
-          /*! \brief The map of symbolic variables
+          //! The table of symbolic variables indexed by variable id.
+          SymbolicTable<SharedSymbolicVariable> symbolicVariables;
+
+          /*! \brief The map of symbolic variable names
+           *
+           * \details
+           * **item1**: variable name<br>
+           * **item2**: variable id
+           */
+          std::unordered_map<std::string, triton::usize> symbolicVariableNames;
+
+          //! The table of symbolic expressions indexed by expression id.
+          mutable SymbolicTable<WeakSymbolicExpression> symbolicExpressions;
+
+          //! Def-use graph: sorted ids of the expressions directly referenced by an expression.
+          mutable SymbolicTable<std::vector<triton::usize>> expressionReferences;
+
+          //! Def-use graph: sorted ids of the variables directly used by an expression.
+          mutable SymbolicTable<std::vector<triton::usize>> expressionVariables;
+
+          //! Def-use graph: ids of the expressions referencing an expression. Stale entries are pruned lazily.
+          mutable SymbolicTable<std::vector<triton::usize>> expressionUsers;
+
+          //! Def-use graph: ids of the expressions using a variable. Stale entries are pruned lazily.
+          mutable SymbolicTable<std::vector<triton::usize>> variableUsers;
+
+          //! Memory bookkeeping of an expression.
+          struct ExpressionUsage {
+            //! Estimated size in bytes of the expression and of its own AST nodes.
+            triton::usize size;
+
+            //! Last time the expression was created or read (see `usageClock`).
+            triton::usize lastUse;
+
+            //! The AST the edges have been recorded from.
+            triton::ast::WeakAbstractNode ast;
+          };
+
+          //! Memory bookkeeping of the expressions indexed by expression id.
+          mutable SymbolicTable<ExpressionUsage> expressionUsages;
+
+          //! Logical clock used to order expression uses.
+          mutable triton::usize usageClock;
+
+          //! Ids of the expressions whose AST has been changed through `SymbolicExpression::setAst` since the last refresh of the def-use graph.
+          std::shared_ptr<std::vector<triton::usize>> astChanges;
+
+          //! Estimated size in bytes of the registered expressions.
+          mutable triton::usize estimatedMemory;
+
+          //! Memory budget in bytes (0 means unlimited).
+          triton::usize memoryBudget;
+
+          //! Estimated memory left by the last pass which could not meet the budget (0 if none). No pass runs until the usage changes.
+          triton::usize budgetBackoff;
+
+          //! Statistics of the evictions.
+          mutable EvictionStatistics evictionStats;
+
+          //! Index of the tainted expression ids.
+          mutable std::set<triton::usize> taintedExpressions;
+
+          /*! \brief Index of the expression ids per instruction address. Dead ids are swept with the expressions (see `indexSweepThreshold`).
            *
            * \details
-           * **item1**: variable id<br>
-           * **item2**: symbolic variable
+           * **item1**: instruction address<br>
+           * **item2**: expression ids
            */
-          std::unordered_map<triton::usize, SharedSymbolicVariable> symbolicVariables;
+          mutable std::unordered_map<triton::uint64, std::vector<triton::usize>> addressExpressions;
 
-          /*! \brief The map of symbolic expressions
+          /*! \brief Index of the expression ids per kind. Dead ids are swept with the expressions (see `indexSweepThreshold`).
            *
            * \details
-           * **item1**: symbolic reference id<br>
-           * **item2**: symbolic expression
+           * **item1**: kind of expression<br>
+           * **item2**: expression ids
            */
-          mutable std::unordered_map<triton::usize, WeakSymbolicExpression> symbolicExpressions;
+          mutable std::map<triton::engines::symbolic::expression_e, std::vector<triton::usize>> kindExpressions;
+
+          //! Number of ids held by `addressExpressions` and `kindExpressions`.
+          mutable triton::usize indexedIds;
+
+          //! Number of indexed ids beyond which the dead expressions are swept (twice the live ones after a sweep).
+          mutable triton::usize indexSweepThreshold;
 
           /*! \brief map of address -> symbolic expression
            *
@@ -141,6 +236,36 @@ namespace triton {
           //! Adds a symbolic memory reference.
           void addMemoryReference(triton::uint64 mem, const SharedSymbolicExpression& expr);
 
+          //! Collects the ids of the expressions and variables directly used by an AST (references are not unrolled). Returns the number of nodes visited.
+          triton::usize getAstDependencies(const triton::ast::SharedAbstractNode& node, std::vector<triton::usize>& references, std::vector<triton::usize>& variables) const;
+
+          //! Records the def-use edges and the memory usage of an expression. Must be called each time the expression's AST is changed.
+          void recordExpression(const SharedSymbolicExpression& expr) const;
+
+          //! Records again the expressions whose AST has been changed by the user (see `astChanges`). Must be called before walking the def-use graph.
+          void refreshChangedExpressions(void) const;
+
+          //! Removes the def-use edges and the memory usage of an expression.
+          void forgetExpression(triton::usize symExprId) const;
+
+          //! Marks an expression as used (LRU order of the memory budget).
+          void touchExpression(triton::usize symExprId);
+
+          //! Returns the ids of the expressions reachable from the path constraints.
+          std::unordered_set<triton::usize> getPathConstraintsExpressionIds(void) const;
+
+          //! Removes the dead expressions from the table, the def-use graph and the indexes.
+          void removeExpiredExpressions(void) const;
+
+          //! Accounts ids added to the indexes and sweeps the dead expressions once the indexes doubled.
+          void addIndexedIds(triton::usize count);
+
+          //! Returns the ids of the live expressions reached through the `users` edges. `sources` are not included.
+          std::vector<triton::usize> getForwardSliceIds(const std::vector<triton::usize>& sources) const;
+
+          //! Returns the path constraints using one of the expressions or the variable.
+          std::vector<PathConstraint> getDependentPathConstraints(const std::vector<triton::usize>& exprIds, const SharedSymbolicVariable& symVar) const;
+
           //! Returns the AST corresponding to the shift operation. Mainly used for AArch64 operands.
           triton::ast::SharedAbstractNode getShiftAst(triton::arch::aarch64::shift_e type, triton::uint32 value, const triton::ast::SharedAbstractNode& node);
 
@@ -259,6 +384,18 @@ namespace triton {
           //! Slices all expressions from a given one.
           TRITON_EXPORT std::map<triton::usize, SharedSymbolicExpression> sliceExpressions(const SharedSymbolicExpression& expr);
 
+          //! Returns all expressions depending on a given one (forward slice), the given one included.
+          TRITON_EXPORT std::map<triton::usize, SharedSymbolicExpression> forwardSliceExpressions(const SharedSymbolicExpression& expr) const;
+
+          //! Returns all expressions depending on a symbolic variable (forward slice).
+          TRITON_EXPORT std::map<triton::usize, SharedSymbolicExpression> forwardSliceExpressions(const SharedSymbolicVariable& symVar) const;
+
+          //! Returns the path constraints depending on a given expression.
+          TRITON_EXPORT std::vector<PathConstraint> forwardSlicePathConstraints(const SharedSymbolicExpression& expr) const;
+
+          //! Returns the path constraints depending on a symbolic variable.
+          TRITON_EXPORT std::vector<PathConstraint> forwardSlicePathConstraints(const SharedSymbolicVariable& symVar) const;
+
           //! Returns the list of the tainted symbolic expressions.
           TRITON_EXPORT std::list<SharedSymbolicExpression> getTaintedSymbolicExpressions(void) const;
 
@@ -266,7 +403,46 @@ namespace triton {
           TRITON_EXPORT std::unordered_map<triton::usize, SharedSymbolicExpression> getSymbolicExpressions(void) const;
 
           //! Returns all symbolic variables.
-          TRITON_EXPORT const std::unordered_map<triton::usize, SharedSymbolicVariable>& getSymbolicVariables(void) const;
+          TRITON_EXPORT const SymbolicTable<SharedSymbolicVariable>& getSymbolicVariables(void) const;
+
+          //! Returns a view on the tainted symbolic expressions.
+          TRITON_EXPORT SymbolicExpressionView<std::set<triton::usize>> getTaintedSymbolicExpressionsView(void) const;
+
+          //! Returns a view on the symbolic expressions created by the instructions at an address.
+          TRITON_EXPORT SymbolicExpressionView<std::vector<triton::usize>> getSymbolicExpressionsAtAddress(triton::uint64 addr) const;
+
+          //! Returns a view on the symbolic expressions of a kind.
+          TRITON_EXPORT SymbolicExpressionView<std::vector<triton::usize>> getSymbolicExpressionsOfKind(triton::engines::symbolic::expression_e kind) const;
+
+          //! Indexes the symbolic expressions of a processed instruction (address and taint).
+          TRITON_EXPORT void indexInstructionExpressions(const triton::arch::Instruction& inst);
+
+          //! Updates the taint index of an expression. Must be called when `isTainted` is changed out of the instruction processing.
+          TRITON_EXPORT void updateTaintIndex(const SharedSymbolicExpression& expr);
+
+          //! Sets the memory budget (in bytes) of the symbolic expressions. 0 means unlimited.
+          TRITON_EXPORT void setMemoryBudget(triton::usize bytes);
+
+          //! Returns the memory budget (in bytes) of the symbolic expressions.
+          TRITON_EXPORT triton::usize getMemoryBudget(void) const;
+
+          //! Returns the estimated memory (in bytes) used by the symbolic expressions.
+          TRITON_EXPORT triton::usize getEstimatedMemory(void) const;
+
+          /*!
+           * \brief Enforces the memory budget.
+           *
+           * \details
+           * If the estimated memory is above the budget, the registers and memory cells holding the least
+           * recently used expressions which are not reachable from the path constraints are concretized
+           * until the estimated memory drops under 3/4 of the budget. The path predicate and the symbolic
+           * inputs (expressions of a bare symbolic variable) are never altered. When they alone exceed the
+           * budget, no pass runs until the estimated memory drops or grows by 1/8 of the budget.
+           */
+          TRITON_EXPORT void enforceMemoryBudget(void);
+
+          //! Returns the statistics of the memory budget eviction.
+          TRITON_EXPORT const EvictionStatistics& getEvictionStatistics(void) const;
 
           //! Concretizes all symbolic memory references.
           TRITON_EXPORT void concretizeAllMemory(void);
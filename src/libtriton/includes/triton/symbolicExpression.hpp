@@ -10,6 +10,7 @@
 
 #include <string>
 #include <memory>
+#include <vector>
 
 #include <triton/ast.hpp>
 #include <triton/dllexport.hpp>
@@ -66,6 +67,9 @@ namespace triton {
           //! The origin register if `kind` is equal to `triton::engines::symbolic::REG`, `REG_INVALID` otherwise.
           triton::arch::Register originRegister;
 
+          //! The log of the changed ASTs of the symbolic engine owning the expression. `setAst` appends the expression id to it.
+          std::weak_ptr<std::vector<triton::usize>> astChanges;
+
         public:
           //! True if the symbolic expression is tainted.
           bool isTainted;
@@ -124,6 +128,9 @@ namespace triton {
           //! Sets a root node.
           TRITON_EXPORT void setAst(const triton::ast::SharedAbstractNode& node);
 
+          //! Sets the log the expression id is appended to each time the AST is changed.
+          TRITON_EXPORT void setAstChanges(const std::shared_ptr<std::vector<triton::usize>>& changes);
+
           //! Sets a comment to the symbolic expression.
           TRITON_EXPORT void setComment(const std::string& comment);
 
@@ -0,0 +1,143 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SYMBOLICEXPRESSIONVIEW_H
+#define TRITON_SYMBOLICEXPRESSIONVIEW_H
+
+#include <triton/symbolicExpression.hpp>
+#include <triton/symbolicTable.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      /*! \class SymbolicExpressionView
+       *  \brief A read-only view over a set of symbolic expression ids.
+       *
+       *  \details
+       *  The view does not copy anything. It walks an index of the symbolic engine and
+       *  resolves each id through the expressions table, skipping the expressions which
+       *  have been removed or released. A view is invalidated by any modification of the
+       *  symbolic engine.
+       */
+      template <typename Container>
+      class SymbolicExpressionView {
+        private:
+          //! The expressions table.
+          const SymbolicTable<WeakSymbolicExpression>* table;
+
+          //! The ids of the view.
+          const Container* ids;
+
+          //! If true, only the tainted expressions are visited.
+          bool taintedOnly;
+
+        public:
+          //! \class const_iterator
+          /*! \brief Iterates over the live expressions of the view. */
+          class const_iterator {
+            private:
+              const SymbolicExpressionView* view;
+              typename Container::const_iterator it;
+              SharedSymbolicExpression current;
+
+              void skip(void) {
+                this->current = nullptr;
+                while (this->it != this->view->ids->end()) {
+                  const WeakSymbolicExpression* expr = this->view->table->find(*this->it);
+                  if (expr != nullptr) {
+                    this->current = expr->lock();
+                    if (this->current != nullptr && (!this->view->taintedOnly || this->current->isTainted))
+                      return;
+                  }
+                  ++this->it;
+                }
+                this->current = nullptr;
+              }
+
+            public:
+              const_iterator(const SymbolicExpressionView* view, typename Container::const_iterator it) : view(view), it(it) {
+                this->skip();
+              }
+
+              const SharedSymbolicExpression& operator*(void) const {
+                return this->current;
+              }
+
+              const_iterator& operator++(void) {
+                ++this->it;
+                this->skip();
+                return *this;
+              }
+
+              bool operator==(const const_iterator& other) const {
+                return this->it == other.it;
+              }
+
+              bool operator!=(const const_iterator& other) const {
+                return this->it != other.it;
+              }
+          };
+
+          //! Constructor. A null `ids` gives an empty view.
+          SymbolicExpressionView(const SymbolicTable<WeakSymbolicExpression>* table, const Container* ids, bool taintedOnly=false)
+            : table(table), ids(ids != nullptr ? ids : &emptyIds()), taintedOnly(taintedOnly) {
+          }
+
+          //! Returns an iterator on the first live expression.
+          const_iterator begin(void) const {
+            return const_iterator(this, this->ids->begin());
+          }
+
+          //! Returns the past-the-end iterator.
+          const_iterator end(void) const {
+            return const_iterator(this, this->ids->end());
+          }
+
+          //! Returns true if the view has no live expression.
+          bool empty(void) const {
+            return this->begin() == this->end();
+          }
+
+        private:
+          //! Returns an empty container, used by empty views.
+          static const Container& emptyIds(void) {
+            static const Container ids;
+            return ids;
+          }
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SYMBOLICEXPRESSIONVIEW_H */
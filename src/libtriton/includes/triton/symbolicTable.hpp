@@ -0,0 +1,272 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SYMBOLICTABLE_H
+#define TRITON_SYMBOLICTABLE_H
+
+#include <bitset>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      /*! \class SymbolicTable
+       *  \brief A dense table indexed by id.
+       *
+       *  \details
+       *  Symbolic expressions and variables get sequential ids, so they are stored into
+       *  fixed-size chunks indexed by id instead of a hash table. A lookup is an indexed
+       *  load, an insertion never rehashes and only allocates once per chunk. A removed
+       *  entry leaves a tombstone and a chunk is released once all its entries are removed.
+       */
+      template <typename T>
+      class SymbolicTable {
+        public:
+          //! Number of entries per chunk (log2).
+          static const triton::usize chunkBits = 12;
+
+          //! Number of entries per chunk.
+          static const triton::usize chunkSize = (1 << chunkBits);
+
+        private:
+          //! A chunk of entries. A cleared bit in `present` is a tombstone.
+          struct Chunk {
+            T entries[chunkSize];
+            std::bitset<chunkSize> present;
+            triton::usize used;
+
+            Chunk() : used(0) {}
+          };
+
+          //! The chunks. A released or not yet allocated chunk is nullptr.
+          std::vector<std::unique_ptr<Chunk>> chunks;
+
+          //! Number of live entries.
+          triton::usize count;
+
+          //! Returns the chunk holding the id, nullptr if there is none.
+          Chunk* getChunk(triton::usize id) const {
+            triton::usize index = (id >> chunkBits);
+            if (index >= this->chunks.size())
+              return nullptr;
+            return this->chunks[index].get();
+          }
+
+        public:
+          //! \class const_iterator
+          /*! \brief Iterates over live entries in id order. Dereferences to a pair (id, entry). */
+          class const_iterator {
+            private:
+              const SymbolicTable* table;
+              triton::usize id;
+
+              void skip(void) {
+                triton::usize end = (this->table->chunks.size() << chunkBits);
+                while (this->id < end) {
+                  const Chunk* chunk = this->table->chunks[this->id >> chunkBits].get();
+                  if (chunk == nullptr || chunk->used == 0) {
+                    this->id = ((this->id >> chunkBits) + 1) << chunkBits;
+                    continue;
+                  }
+                  if (chunk->present[this->id & (chunkSize - 1)])
+                    return;
+                  this->id++;
+                }
+              }
+
+            public:
+              const_iterator(const SymbolicTable* table, triton::usize id) : table(table), id(id) {
+                this->skip();
+              }
+
+              std::pair<triton::usize, const T&> operator*(void) const {
+                return std::pair<triton::usize, const T&>(this->id, this->table->chunks[this->id >> chunkBits]->entries[this->id & (chunkSize - 1)]);
+              }
+
+              const_iterator& operator++(void) {
+                this->id++;
+                this->skip();
+                return *this;
+              }
+
+              bool operator==(const const_iterator& other) const {
+                return this->id == other.id;
+              }
+
+              bool operator!=(const const_iterator& other) const {
+                return this->id != other.id;
+              }
+          };
+
+          //! Constructor.
+          SymbolicTable() : count(0) {}
+
+          //! Constructor by copy.
+          SymbolicTable(const SymbolicTable& other) : count(0) {
+            *this = other;
+          }
+
+          //! Copies a SymbolicTable.
+          SymbolicTable& operator=(const SymbolicTable& other) {
+            if (this == &other)
+              return *this;
+
+            this->chunks.clear();
+            this->chunks.resize(other.chunks.size());
+            for (triton::usize index = 0; index < other.chunks.size(); index++) {
+              if (other.chunks[index] != nullptr)
+                this->chunks[index].reset(new Chunk(*other.chunks[index]));
+            }
+            this->count = other.count;
+
+            return *this;
+          }
+
+          //! Returns an iterator on the first live entry.
+          const_iterator begin(void) const {
+            return const_iterator(this, 0);
+          }
+
+          //! Returns the past-the-end iterator.
+          const_iterator end(void) const {
+            return const_iterator(this, this->chunks.size() << chunkBits);
+          }
+
+          //! Returns the number of live entries.
+          triton::usize size(void) const {
+            return this->count;
+          }
+
+          //! Returns true if there is no live entry.
+          bool empty(void) const {
+            return this->count == 0;
+          }
+
+          //! Returns a pointer on the entry of the id, nullptr if the id is not recorded.
+          const T* find(triton::usize id) const {
+            const Chunk* chunk = this->getChunk(id);
+            if (chunk == nullptr || !chunk->present[id & (chunkSize - 1)])
+              return nullptr;
+            return &chunk->entries[id & (chunkSize - 1)];
+          }
+
+          //! Returns a pointer on the entry of the id, nullptr if the id is not recorded.
+          T* find(triton::usize id) {
+            Chunk* chunk = this->getChunk(id);
+            if (chunk == nullptr || !chunk->present[id & (chunkSize - 1)])
+              return nullptr;
+            return &chunk->entries[id & (chunkSize - 1)];
+          }
+
+          //! Returns true if the id is recorded.
+          bool contains(triton::usize id) const {
+            return this->find(id) != nullptr;
+          }
+
+          //! Records an entry and returns a reference on it.
+          T& insert(triton::usize id, const T& value) {
+            triton::usize index = (id >> chunkBits);
+            triton::usize slot  = (id & (chunkSize - 1));
+
+            if (index >= this->chunks.size())
+              this->chunks.resize(index + 1);
+
+            if (this->chunks[index] == nullptr)
+              this->chunks[index].reset(new Chunk());
+
+            Chunk* chunk = this->chunks[index].get();
+            if (!chunk->present[slot]) {
+              chunk->present[slot] = true;
+              chunk->used++;
+              this->count++;
+            }
+
+            chunk->entries[slot] = value;
+            return chunk->entries[slot];
+          }
+
+          //! Removes the entry of the id. Returns false if the id was not recorded.
+          bool erase(triton::usize id) {
+            triton::usize index = (id >> chunkBits);
+            triton::usize slot  = (id & (chunkSize - 1));
+            Chunk* chunk        = this->getChunk(id);
+
+            if (chunk == nullptr || !chunk->present[slot])
+              return false;
+
+            chunk->entries[slot] = T();
+            chunk->present[slot] = false;
+            chunk->used--;
+            this->count--;
+
+            if (chunk->used == 0)
+              this->chunks[index].reset();
+
+            return true;
+          }
+
+          //! Removes all entries matching the predicate and releases empty chunks.
+          template <typename Predicate>
+          void eraseIf(Predicate predicate) {
+            for (triton::usize index = 0; index < this->chunks.size(); index++) {
+              Chunk* chunk = this->chunks[index].get();
+              if (chunk == nullptr)
+                continue;
+              for (triton::usize slot = 0; slot < chunkSize; slot++) {
+                if (chunk->present[slot] && predicate(chunk->entries[slot])) {
+                  chunk->entries[slot] = T();
+                  chunk->present[slot] = false;
+                  chunk->used--;
+                  this->count--;
+                }
+              }
+              if (chunk->used == 0)
+                this->chunks[index].reset();
+            }
+          }
+
+          //! Removes all entries.
+          void clear(void) {
+            this->chunks.clear();
+            this->count = 0;
+          }
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SYMBOLICTABLE_H */
@@ -8,13 +8,18 @@
 #ifndef TRITON_TAINTENGINE_H
 #define TRITON_TAINTENGINE_H
 
+#include <map>
 #include <set>
+#include <utility>
+#include <vector>
 
 #include <triton/dllexport.hpp>
 #include <triton/memoryAccess.hpp>
 #include <triton/modes.hpp>
 #include <triton/register.hpp>
+#include <triton/shadowMemory.hpp>
 #include <triton/symbolicEngine.hpp>
+#include <triton/taintLabels.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -65,11 +70,44 @@ namespace triton {
           //! Defines if the taint engine is enabled or disabled.
           bool enableFlag;
 
-          //! The set of tainted addresses.
-          std::set<triton::uint64> taintedMemory;
+          //! The shadow of the tainted bytes of memory, and of the sets of labels of the labelled ones.
+          triton::engines::taint::ShadowMemory taintedMemory;
 
-          //! The set of tainted registers. Currently it is an over approximation of the taint.
-          std::set<triton::arch::register_e> taintedRegisters;
+          //! The mask of the tainted bytes (the bit i for the byte i) of the tainted parent registers.
+          std::map<triton::arch::register_e, triton::uint64> taintedRegisters;
+
+          //! The interned sets of labels (see the TAINT_LABELS mode).
+          mutable triton::engines::taint::TaintLabels labels;
+
+          //! The sets of labels of the bytes of the labelled parent registers.
+          std::map<triton::arch::register_e, std::vector<triton::uint32>> registerLabels;
+
+          //! Returns true if the labels are propagated.
+          bool isLabelling(void) const;
+
+          //! Returns the union of the sets of labels of the bytes of a memory, and of its pointer registers if the taint is spread through pointers.
+          triton::uint32 getMemoryLabelSet(const triton::arch::MemoryAccess& mem) const;
+
+          //! Returns the union of the sets of labels of the pointer registers of a memory if the taint is spread through pointers.
+          triton::uint32 getPointerLabelSet(const triton::arch::MemoryAccess& mem) const;
+
+          //! Returns the set of labels of a byte of memory.
+          triton::uint32 getMemoryLabelSet(triton::uint64 addr) const;
+
+          //! Sets the set of labels of the tainted bytes among `size` bytes of memory (0 removes their labels). The untainted bytes have no label.
+          void setMemoryLabelSet(triton::uint64 addr, triton::uint32 size, triton::uint32 set);
+
+          //! Returns the union of the sets of labels of the bytes of a register.
+          triton::uint32 getRegisterLabelSet(const triton::arch::Register& reg) const;
+
+          //! Sets the set of labels of the bytes of a register (0 removes their labels).
+          void setRegisterLabelSet(const triton::arch::Register& reg, triton::uint32 set);
+
+          //! Returns the mask of the bytes of a register into its parent register.
+          static triton::uint64 getRegisterMask(const triton::arch::Register& reg);
+
+          //! Sets the taint and the labels of a written register. As in the symbolic engine, a write of 32 bits or more zeroes the rest of the parent register.
+          bool writeRegister(const triton::arch::Register& regDst, bool flag, triton::uint32 set);
 
         public:
           //! Constructor.
@@ -85,9 +123,12 @@ namespace triton {
           TRITON_EXPORT void enable(bool flag);
 
           //! Returns the tainted addresses.
-          TRITON_EXPORT const std::set<triton::uint64>& getTaintedMemory(void) const;
+          TRITON_EXPORT std::set<triton::uint64> getTaintedMemory(void) const;
+
+          //! Returns the tainted memory as coalesced ranges (address, size), sorted by address.
+          TRITON_EXPORT std::vector<std::pair<triton::uint64, triton::uint64>> getTaintedMemoryRanges(void) const;
 
-          //! Returns the tainted registers.
+          //! Returns the parent registers which have at least one tainted byte.
           TRITON_EXPORT std::set<const triton::arch::Register*> getTaintedRegisters(void) const;
 
           //! Returns true if the taint engine is enabled.
@@ -99,7 +140,10 @@ namespace triton {
           //! Returns true if the memory is tainted.
           TRITON_EXPORT bool isMemoryTainted(const triton::arch::MemoryAccess& mem, bool mode=true) const;
 
-          //! Returns true if the register is tainted.
+          //! Returns true if one of the `size` bytes from `addr` is tainted.
+          TRITON_EXPORT bool isMemoryRangeTainted(triton::uint64 addr, triton::uint64 size) const;
+
+          //! Returns true if one of the bytes of the register is tainted.
           TRITON_EXPORT bool isRegisterTainted(const triton::arch::Register& reg) const;
 
           //! Abstract taint verification. Returns true if the operand is tainted.
@@ -120,15 +164,33 @@ namespace triton {
           //! Taints a memory. Returns TAINTED if the memory has been tainted correctly. Otherwise it returns the last defined state.
           TRITON_EXPORT bool taintMemory(const triton::arch::MemoryAccess& mem);
 
+          //! Taints `size` bytes from `addr`. Returns TAINTED if the range has been tainted correctly. Otherwise it returns the last defined state.
+          TRITON_EXPORT bool taintMemoryRange(triton::uint64 addr, triton::uint64 size);
+
           //! Taints a register. Returns TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
           TRITON_EXPORT bool taintRegister(const triton::arch::Register& reg);
 
+          //! Taints a memory and adds a label to the set of labels of each of its bytes (see the TAINT_LABELS mode). Returns TAINTED if the memory has been tainted correctly. Otherwise it returns the last defined state.
+          TRITON_EXPORT bool taintMemoryWithLabel(const triton::arch::MemoryAccess& mem, triton::uint32 label);
+
+          //! Taints a register and adds a label to its set of labels (see the TAINT_LABELS mode). Returns TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
+          TRITON_EXPORT bool taintRegisterWithLabel(const triton::arch::Register& reg, triton::uint32 label);
+
+          //! Returns the labels (sorted) which flow into the bytes of a memory.
+          TRITON_EXPORT std::vector<triton::uint32> getMemoryTaintLabels(const triton::arch::MemoryAccess& mem) const;
+
+          //! Returns the labels (sorted) which flow into a register.
+          TRITON_EXPORT std::vector<triton::uint32> getRegisterTaintLabels(const triton::arch::Register& reg) const;
+
           //! Untaints an address. Returns !TAINTED if the address has been untainted correctly. Otherwise it returns the last defined state.
           TRITON_EXPORT bool untaintMemory(triton::uint64 addr);
 
           //! Untaints a memory. Returns !TAINTED if the memory has been untainted correctly. Otherwise it returns the last defined state.
           TRITON_EXPORT bool untaintMemory(const triton::arch::MemoryAccess& mem);
 
+          //! Untaints `size` bytes from `addr`. Returns !TAINTED if the range has been untainted correctly. Otherwise it returns the last defined state.
+          TRITON_EXPORT bool untaintMemoryRange(triton::uint64 addr, triton::uint64 size);
+
           //! Untaints a register. Returns !TAINTED if the register has been untainted correctly. Otherwise it returns the last defined state.
           TRITON_EXPORT bool untaintRegister(const triton::arch::Register& reg);
 
@@ -0,0 +1,93 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_TAINTLABELS_H
+#define TRITON_TAINTLABELS_H
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Taint namespace
+    namespace taint {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup taint
+     *  @{
+     */
+
+      /*! \class TaintLabels
+       *  \brief The interned sets of taint labels.
+       *
+       *  \details
+       *  A set of labels (e.g. the offsets of the input bytes) is hash-consed: equal sets share the same id, so a
+       *  tainted byte or register only carries an integer and comparing two sets is comparing their ids. The id 0
+       *  is the empty set. The unions are memoized, the propagation of the same sets costs a single lookup. The
+       *  sets are never released.
+       */
+      class TaintLabels {
+        private:
+          //! The labels of each set (sorted), indexed by id.
+          std::vector<std::vector<triton::uint32>> sets;
+
+          //! The id of each set.
+          std::map<std::vector<triton::uint32>, triton::uint32> ids;
+
+          //! The memoized unions, indexed by the ids of their operands (the smallest one first).
+          std::unordered_map<triton::uint64, triton::uint32> unions;
+
+          //! Returns the id of a sorted set of labels, interning it if needed.
+          triton::uint32 intern(const std::vector<triton::uint32>& labels);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT TaintLabels();
+
+          //! Returns the id of the set made of a single label.
+          TRITON_EXPORT triton::uint32 getSingleton(triton::uint32 label);
+
+          //! Returns the id of the union of two sets.
+          TRITON_EXPORT triton::uint32 merge(triton::uint32 set1, triton::uint32 set2);
+
+          //! Returns the labels of a set, sorted.
+          TRITON_EXPORT const std::vector<triton::uint32>& getLabels(triton::uint32 set) const;
+
+          //! Returns the number of interned sets (the empty set included).
+          TRITON_EXPORT triton::usize getNumberOfSets(void) const;
+
+          //! Releases all the sets but the empty one.
+          TRITON_EXPORT void clear(void);
+      };
+
+    /*! @} End of taint namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TAINTLABELS_H */
@@ -8,7 +8,9 @@
 #ifndef TRITON_TRITONTOZ3AST_H
 #define TRITON_TRITONTOZ3AST_H
 
+#include <string>
 #include <unordered_map>
+#include <vector>
 #include <z3++.h>
 
 #include <triton/ast.hpp>
@@ -33,7 +35,13 @@ namespace triton {
    */
 
     //! \class TritonToZ3Ast
-    /*! \brief Converts a Triton's AST to Z3's AST. */
+    /*! \brief Converts a Triton's AST to Z3's AST.
+     *
+     * \details
+     * Translations are memoized, converting an AST which shares nodes with a previously converted one
+     * only converts the new nodes. The translations and the variables recorded after a `push()` are
+     * dropped by the matching `pop()`, otherwise they live as long as the converter.
+     */
     class TritonToZ3Ast {
       private:
         //! This flag define if the conversion is used to evaluated a node or not.
@@ -48,6 +56,18 @@ namespace triton {
         //! The convert internal process
         z3::expr do_convert(const triton::ast::SharedAbstractNode& node, std::unordered_map<triton::ast::SharedAbstractNode, z3::expr>* output);
 
+        //! The nodes and the variable names recorded into a scope.
+        struct Scope {
+          //! The translated nodes.
+          std::vector<triton::ast::SharedAbstractNode> nodes;
+
+          //! The names of the recorded variables.
+          std::vector<std::string> variables;
+        };
+
+        //! The open scopes, the innermost last.
+        std::vector<Scope> scopes;
+
       protected:
         //! The z3's context.
         z3::context context;
@@ -59,11 +79,26 @@ namespace triton {
         //! The set of symbolic variables contained in the expression.
         std::unordered_map<std::string, triton::engines::symbolic::SharedSymbolicVariable> variables;
 
+        //! The memoized translations.
+        std::unordered_map<triton::ast::SharedAbstractNode, z3::expr> translations;
+
         //! Constructor.
         TRITON_EXPORT TritonToZ3Ast(bool eval=true);
 
+        //! Returns the z3's context.
+        TRITON_EXPORT z3::context& getContext(void);
+
         //! Converts to Z3's AST
         TRITON_EXPORT z3::expr convert(const triton::ast::SharedAbstractNode& node);
+
+        //! Opens a scope of translations.
+        TRITON_EXPORT void push(void);
+
+        //! Drops the translations and the variables recorded since the last `push()`.
+        TRITON_EXPORT void pop(void);
+
+        //! Drops all the translations, the variables and the scopes.
+        TRITON_EXPORT void reset(void);
     };
 
   /*! @} End of ast namespace */
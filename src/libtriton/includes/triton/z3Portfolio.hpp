@@ -0,0 +1,77 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_Z3PORTFOLIO_H
+#define TRITON_Z3PORTFOLIO_H
+
+#include <z3++.h>
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverConfiguration.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \class Z3Portfolio
+       *  \brief Races several z3 configurations on the same query.
+       *
+       *  \details
+       *  Each configuration runs in its own thread and z3 context. The first configuration which
+       *  answers sat or unsat wins, the others are interrupted through their context.
+       */
+      class Z3Portfolio {
+        public:
+          //! Called with each racing context when it starts (true) and once it is done (false), so that it can be interrupted from outside.
+          using ContextTracker = std::function<void(z3::context& ctx, bool racing)>;
+
+          /*!
+           * \brief Races the configurations on a query and returns the index of the winner (the number of configurations if none answered).
+           *
+           * \details Each configuration is bounded by `limits`. `status` receives the answer of the winner (or why none answered)
+           * and `model` its model if `needModel` is true. Once `interrupted` is set, the race stops and answers `INTERRUPTED`
+           * if nobody won; the contexts handed to `track` should be interrupted along with it.
+           */
+          TRITON_EXPORT static triton::usize race(const triton::ast::SharedAbstractNode& node, const std::vector<SolverConfiguration>& configurations, bool needModel, const SolverLimits& limits, triton::engines::solver::status_e& status, std::map<triton::uint32, SolverModel>& model, const std::atomic<bool>* interrupted=nullptr, const ContextTracker& track=nullptr);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_Z3PORTFOLIO_H */
@@ -0,0 +1,129 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_Z3SESSION_H
+#define TRITON_Z3SESSION_H
+
+#include <z3++.h>
+
+#include <map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/pathConstraint.hpp>
+#include <triton/solverConfiguration.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/tritonToZ3Ast.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \class Z3Session
+       *  \brief An incremental z3 session aligned with the path constraints.
+       *
+       *  \details
+       *  The session keeps one z3 context and solver alive. Each path constraint is asserted into its
+       *  own scope, so a query on a prefix of the path only pops the scopes past the prefix, and the
+       *  query itself is checked between a push and a pop. The translations are memoized into the scope
+       *  of their constraint and dropped with it, so a query reuses the translations of the asserted
+       *  prefix only. The solver keeps what it learned from a query to the next one.
+       */
+      class Z3Session {
+        private:
+          //! The translator (it owns the z3 context).
+          triton::ast::TritonToZ3Ast translator;
+
+          //! The z3 solver.
+          z3::solver solver;
+
+          //! The asserted constraints, one scope per constraint.
+          std::vector<triton::ast::SharedAbstractNode> asserted;
+
+          //! Opens a scope of the solver and of the translations.
+          void push(void);
+
+          //! Closes `count` scopes of the solver and of the translations.
+          void pop(triton::usize count=1);
+
+          //! Asserts the query into a new scope and checks it. The scope is left open.
+          z3::check_result check(const triton::ast::SharedAbstractNode& query);
+
+          //! Opens a scope and translates a bitvector expression into it. The scope is left open.
+          z3::expr convertExpression(const triton::ast::SharedAbstractNode& node);
+
+          //! Returns the value of an expression in the model of the last check.
+          triton::uint512 getModelValue(const z3::expr& expr);
+
+          //! Computes the smallest or the greatest value of an expression under the asserted constraints by a binary search.
+          triton::uint512 getBoundValue(const triton::ast::SharedAbstractNode& node, bool maximize, triton::engines::solver::status_e* status);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT Z3Session();
+
+          //! Aligns the session with the `count` first taken constraints of a path. Only the scopes which diverge are popped and asserted again.
+          TRITON_EXPORT void sync(const std::vector<triton::engines::symbolic::PathConstraint>& path, triton::usize count);
+
+          //! Computes a model of the asserted constraints and of a query. The status of the query is written into `status` if it is not null.
+          TRITON_EXPORT std::map<triton::uint32, SolverModel> getModel(const triton::ast::SharedAbstractNode& query, triton::engines::solver::status_e* status=nullptr);
+
+          //! Returns true if the asserted constraints and a query are satisfiable. The status of the query is written into `status` if it is not null.
+          TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& query, triton::engines::solver::status_e* status=nullptr);
+
+          //! Enumerates up to `limit` distinct values of a bitvector expression under the asserted constraints, the models are blocked on the value of the expression only.
+          TRITON_EXPORT std::vector<triton::uint512> getValues(const triton::ast::SharedAbstractNode& node, triton::usize limit, triton::engines::solver::status_e* status=nullptr);
+
+          //! Returns the smallest (unsigned) value of a bitvector expression under the asserted constraints.
+          TRITON_EXPORT triton::uint512 getMinValue(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status=nullptr);
+
+          //! Returns the greatest (unsigned) value of a bitvector expression under the asserted constraints.
+          TRITON_EXPORT triton::uint512 getMaxValue(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status=nullptr);
+
+          //! Sets the limits of each check.
+          TRITON_EXPORT void setLimits(const SolverLimits& limits);
+
+          //! Interrupts the check in progress. May be called from another thread.
+          TRITON_EXPORT void interrupt(void);
+
+          //! Returns the number of asserted constraints.
+          TRITON_EXPORT triton::usize getNumberOfAssertions(void) const;
+
+          //! Removes all the assertions and the memoized translations.
+          TRITON_EXPORT void reset(void);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_Z3SESSION_H */
@@ -10,10 +10,14 @@
 
 #include <list>
 #include <map>
+#include <mutex>
 #include <string>
+#include <z3++.h>
 
 #include <triton/ast.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/solverConfiguration.hpp>
+#include <triton/solverEnums.hpp>
 #include <triton/solverInterface.hpp>
 #include <triton/solverModel.hpp>
 #include <triton/tritonTypes.hpp>
@@ -44,10 +48,51 @@ namespace triton {
       //! \class Z3Solver
       /*! \brief Solver engine using z3. */
       class Z3Solver : public SolverInterface {
+        private:
+          //! Protects `running` and `interrupted`.
+          mutable std::mutex mutex;
+
+          //! The context of the query being solved (nullptr if none).
+          mutable z3::context* running;
+
+          //! True if the query being solved has been interrupted.
+          mutable bool interrupted;
+
+          //! Registers the context of the query being solved (nullptr when it is done).
+          void setRunning(z3::context* ctx) const;
+
+          //! Registers a context as running for the lifetime of the guard, whatever the way the query ends.
+          class RunningGuard {
+            private:
+              const Z3Solver& solver;
+
+            public:
+              RunningGuard(const Z3Solver& solver, z3::context* ctx) : solver(solver) {
+                this->solver.setRunning(ctx);
+              }
+
+              ~RunningGuard() {
+                this->solver.setRunning(nullptr);
+              }
+          };
+
+          //! Returns the status of a check, `INTERRUPTED` if interrupt() has been called meanwhile.
+          triton::engines::solver::status_e getCheckStatus(const z3::solver& solver, z3::check_result result) const;
+
         public:
           //! Constructor.
           TRITON_EXPORT Z3Solver();
 
+          //! Sets the limits of a z3 solver. An unset limit resets the default of z3.
+          TRITON_EXPORT static void setLimits(z3::solver& solver, const SolverLimits& limits);
+
+          //! Returns the status of a check from its result and the reason of an unknown answer.
+          TRITON_EXPORT static triton::engines::solver::status_e getStatus(const z3::solver& solver, z3::check_result result);
+
+          using SolverInterface::getModel;
+          using SolverInterface::getModels;
+          using SolverInterface::isSat;
+
           //! Computes and returns a model from a symbolic constraint.
           /*! \brief map of symbolic variable id -> model
            *
@@ -57,6 +102,9 @@ namespace triton {
            */
           TRITON_EXPORT std::map<triton::uint32, SolverModel> getModel(const triton::ast::SharedAbstractNode& node) const;
 
+          //! Computes and returns a model from a symbolic constraint under `limits`. The status of the query is written into `status` if it is not null.
+          TRITON_EXPORT std::map<triton::uint32, SolverModel> getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, const SolverLimits& limits) const;
+
           //! Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned.
           /*! \brief list of map of symbolic variable id -> model
            *
@@ -66,9 +114,18 @@ namespace triton {
            */
           TRITON_EXPORT std::list<std::map<triton::uint32, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit) const;
 
+          //! Computes and returns several models from a symbolic constraint under `limits`. The status of the query is written into `status` if it is not null.
+          TRITON_EXPORT std::list<std::map<triton::uint32, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, const SolverLimits& limits) const;
+
           //! Returns true if an expression is satisfiable.
           TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node) const;
 
+          //! Returns true if an expression is satisfiable under `limits`. The status of the query is written into `status` if it is not null.
+          TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, const SolverLimits& limits) const;
+
+          //! Interrupts the query being solved. May be called from another thread.
+          TRITON_EXPORT void interrupt(void);
+
           //! Converts a Triton's AST to a Z3's AST, perform a Z3 simplification and returns a Triton's AST.
           TRITON_EXPORT triton::ast::SharedAbstractNode simplify(const triton::ast::SharedAbstractNode& node) const;
 
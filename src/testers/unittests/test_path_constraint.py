@@ -2,7 +2,11 @@
 # coding: utf-8
 """Test Path Constraint."""
 
+import os
+import tempfile
+import threading
 import unittest
+from distutils.spawn import find_executable
 from triton import *
 
 
@@ -37,6 +41,78 @@ class TestPathConstraint(unittest.TestCase):
         self.assertNotEqual(len(self.ctx.getModel(crst)), 0)
         self.assertNotEqual(len(self.ctx.getModel(astCtx.lnot(crst))), 0)
 
+    def test_getPathConstraintsAstPrefix(self):
+        """Test getPathConstraintsAst with a number of constraints"""
+        self.assertEqual(self.ctx.getPathConstraintsAst(0).evaluate(), 1)
+        self.assertTrue(self.ctx.getPathConstraintsAst(1).equalTo(self.ctx.getPathConstraintsAst()))
+        with self.assertRaises(Exception):
+            self.ctx.getPathConstraintsAst(2)
+
+    def test_getFlippedPathConstraintsAst(self):
+        """Test getFlippedPathConstraintsAst"""
+        crst = self.ctx.getFlippedPathConstraintsAst(0)
+        self.assertEqual(crst.evaluate(), 0)
+        self.assertNotEqual(len(self.ctx.getModel(crst)), 0)
+        with self.assertRaises(Exception):
+            self.ctx.getFlippedPathConstraintsAst(1)
+
+    def test_getFlippedPathConstraintsModel(self):
+        """Test the incremental solver session"""
+        model = self.ctx.getFlippedPathConstraintsModel(0)
+        self.assertTrue(self.ctx.isFlippedPathConstraintsSat(0))
+        self.assertEqual(len(model), len(self.ctx.getModel(self.ctx.getFlippedPathConstraintsAst(0))))
+
+        # The model satisfies the negation of the branch
+        self.assertNotEqual(model[0].getValue() & 0x3fffffff, model[1].getValue() & 0x3fffffff)
+
+        self.ctx.resetSolverSession()
+        self.assertTrue(self.ctx.isFlippedPathConstraintsSat(0))
+        self.assertRaises(TypeError, self.ctx.getFlippedPathConstraintsModel, 1)
+
+    def test_solveAllBranchFlips(self):
+        """Test solveAllBranchFlips"""
+        streamed = dict()
+        def cb(index, model):
+            streamed[index] = model
+
+        models = self.ctx.solveAllBranchFlips(2, 1000, cb)
+        self.assertEqual(list(models.keys()), [0])
+        self.assertEqual(list(streamed.keys()), [0])
+        self.assertEqual(len(models[0]), len(self.ctx.getFlippedPathConstraintsModel(0)))
+        self.assertEqual(len(self.ctx.solveAllBranchFlips()), 1)
+
+    def test_getPathValues(self):
+        """Test the enumeration of the values of an expression under the path"""
+        ast = self.ctx.getAstContext()
+        x = ast.variable(self.ctx.getSymbolicVariableFromId(0))
+        y = ast.variable(self.ctx.getSymbolicVariableFromId(1))
+
+        # Many inputs share each value, only the values are enumerated
+        expr = ast.bvadd(ast.bvand(x, ast.bv(3, 32)), ast.bv(0x1000, 32))
+        values, status = self.ctx.getPathValues(expr, 10, True)
+        self.assertEqual(sorted(values), [0x1000, 0x1001, 0x1002, 0x1003])
+        self.assertEqual(status, SOLVER_STATE.SAT)
+        self.assertEqual(len(self.ctx.getPathValues(expr, 2)), 2)
+        self.assertEqual(self.ctx.getPathMinValue(expr), 0x1000)
+        self.assertEqual(self.ctx.getPathMaxValue(expr, True), (0x1003, SOLVER_STATE.SAT))
+
+        # The path constrains the low bits of eax and ebx to be equal
+        mask = ast.bv(0x3fffffff, 32)
+        self.assertEqual(self.ctx.getPathValues(ast.bvsub(ast.bvand(y, mask), ast.bvand(x, mask)), 10), [0])
+        self.assertRaises(TypeError, self.ctx.getPathValues, ast.equal(x, y), 10)
+
+    @unittest.skipUnless(find_executable("z3"), "requires the z3 binary")
+    def test_smtLibSolver(self):
+        """Test an external solver process"""
+        self.ctx.setSmtLibSolver(["z3", "-in"])
+        crst = self.ctx.getFlippedPathConstraintsAst(0)
+        model, status = self.ctx.getModel(crst, True)
+        self.assertEqual(status, SOLVER_STATE.SAT)
+        self.assertNotEqual(model[0].getValue() & 0x3fffffff, model[1].getValue() & 0x3fffffff)
+        self.assertEqual(len(self.ctx.getModels(crst, 3)), 3)
+        self.assertFalse(self.ctx.isSat(self.ctx.getAstContext().land([crst, self.ctx.getPathConstraintsAst()])))
+        self.assertRaises(TypeError, self.ctx.setSmtLibSolver, [])
+
     def test_getPathConstraints(self):
         """Test getPathConstraints"""
         pco = self.ctx.getPathConstraints()
@@ -65,3 +141,377 @@ class TestPathConstraint(unittest.TestCase):
         self.assertEqual(pc[0]['dstAddr'], 91)
         self.assertEqual(pc[1]['dstAddr'], 23)
 
+
+    def test_forwardSlicePathConstraints(self):
+        eax = self.ctx.getSymbolicVariableFromId(0)
+        self.assertEqual(len(self.ctx.forwardSlicePathConstraints(eax)), 1)
+
+        # ecx = ecx ^ edx does not reach the branch condition
+        ecx = self.ctx.getSymbolicRegister(self.ctx.registers.ecx)
+        self.assertEqual(len(self.ctx.forwardSlicePathConstraints(ecx)), 0)
+
+    def test_forwardSliceExpressions(self):
+        eax = self.ctx.getSymbolicVariableFromId(0)
+        zf  = self.ctx.getSymbolicRegister(self.ctx.registers.zf)
+        fwd = self.ctx.forwardSliceExpressions(eax)
+
+        self.assertIn(zf.getId(), fwd)
+        self.assertIn(self.ctx.getSymbolicRegister(self.ctx.registers.eax).getId(), fwd)
+        self.assertNotIn(self.ctx.getSymbolicRegister(self.ctx.registers.ecx).getId(), fwd)
+
+        # Forward and backward slices must agree
+        for eid, expr in fwd.items():
+            self.assertIn(eid, self.ctx.forwardSliceExpressions(expr))
+        self.assertIn(self.ctx.getSymbolicRegister(self.ctx.registers.eax).getId(), self.ctx.sliceExpressions(zf))
+
+    def test_slicesAfterSetAst(self):
+        astCtx = self.ctx.getAstContext()
+        eax = self.ctx.getSymbolicRegister(self.ctx.registers.eax)
+        ecx = self.ctx.getSymbolicRegister(self.ctx.registers.ecx)
+
+        # The user makes ecx depend on eax
+        ecx.setAst(astCtx.reference(eax) ^ ecx.getAst())
+        self.assertIn(eax.getId(), self.ctx.sliceExpressions(ecx))
+        self.assertIn(ecx.getId(), self.ctx.forwardSliceExpressions(eax))
+        self.assertIn(ecx.getId(), self.ctx.forwardSliceExpressions(self.ctx.getSymbolicVariableFromId(0)))
+
+    def test_constraintsIndependence(self):
+        """Test the CONSTRAINTS_INDEPENDENCE mode"""
+        self.ctx.enableMode(MODE.CONSTRAINTS_INDEPENDENCE, True)
+        astCtx = self.ctx.getAstContext()
+
+        # ecx does not share any variable with the branch and is satisfied by its concrete value
+        var  = self.ctx.convertRegisterToSymbolicVariable(self.ctx.registers.ecx)
+        crst = astCtx.land([self.ctx.getFlippedPathConstraintsAst(0), astCtx.variable(var) == self.ctx.getConcreteVariableValue(var)])
+
+        model = self.ctx.getModel(crst)
+        self.assertIn(var.getId(), model)
+        self.assertEqual(model[var.getId()].getValue(), self.ctx.getConcreteVariableValue(var))
+        self.assertIn(0, model)
+
+        # An unsatisfiable cluster makes the whole conjunction unsatisfiable
+        crst = astCtx.land([crst, astCtx.variable(var) != self.ctx.getConcreteVariableValue(var)])
+        self.assertEqual(len(self.ctx.getModel(crst)), 0)
+
+    def test_solverCache(self):
+        """Test the solver cache"""
+        self.assertEqual(self.ctx.getSolverCacheCapacity(), 0)
+        self.ctx.setSolverCacheCapacity(4096)
+        crst = self.ctx.getFlippedPathConstraintsAst(0)
+
+        model = self.ctx.getModel(crst)
+        self.assertEqual(self.ctx.getSolverCacheStatistics()["misses"], 1)
+
+        # Same query, answered by the cache
+        self.assertEqual(self.ctx.getModel(crst)[0].getValue(), model[0].getValue())
+        self.assertEqual(self.ctx.getSolverCacheStatistics()["hits"], 1)
+
+        # isSat shares the entries of getModel
+        self.assertTrue(self.ctx.isSat(crst))
+        self.assertEqual(self.ctx.getSolverCacheStatistics()["misses"], 1)
+
+        self.ctx.setSolverCacheCapacity(0)
+        self.assertEqual(self.ctx.getSolverCacheCapacity(), 0)
+        self.ctx.getModel(crst)
+        self.assertEqual(self.ctx.getSolverCacheStatistics()["misses"], 1)
+
+    def test_solverCacheSubset(self):
+        """Test the models of the subsets answered by the solver cache"""
+        astCtx = self.ctx.getAstContext()
+        self.ctx.setSolverCacheCapacity(4096)
+
+        var  = self.ctx.convertRegisterToSymbolicVariable(self.ctx.registers.ecx)
+        crst = self.ctx.getFlippedPathConstraintsAst(0)
+        self.assertIn(var.getId(), self.ctx.getModel(astCtx.land([crst, astCtx.variable(var) == 7])))
+
+        # The model of the larger set is restricted to the variables of the query
+        model = self.ctx.getModel(crst)
+        self.assertEqual(self.ctx.getSolverCacheStatistics()["satSubsetHits"], 1)
+        self.assertNotIn(var.getId(), model)
+        self.assertIn(0, model)
+
+    def test_solverModelCompletion(self):
+        """Test the SOLVER_MODEL_COMPLETION mode"""
+        astCtx = self.ctx.getAstContext()
+        var  = self.ctx.convertRegisterToSymbolicVariable(self.ctx.registers.ecx)
+        crst = astCtx.land([self.ctx.getFlippedPathConstraintsAst(0), astCtx.lor([astCtx.variable(var) == 1, astCtx.variable(var) != 1])])
+
+        self.ctx.enableMode(MODE.SOLVER_MODEL_COMPLETION, True)
+        model = self.ctx.getModel(crst)
+        self.assertEqual(model[var.getId()].getValue(), self.ctx.getConcreteVariableValue(var))
+
+    def test_solverPersistentCache(self):
+        """Test the persistent solver cache"""
+        fd, path = tempfile.mkstemp()
+        os.close(fd)
+
+        try:
+            self.ctx.openSolverPersistentCache(path)
+            self.assertTrue(self.ctx.isSolverPersistentCacheOpened())
+            model = self.ctx.getModel(self.ctx.getFlippedPathConstraintsAst(0))
+            self.assertEqual(self.ctx.getSolverPersistentCacheStatistics()["misses"], 1)
+            self.ctx.closeSolverPersistentCache()
+
+            # Same query in another run, with a different numbering of the variables
+            ctx = TritonContext()
+            ctx.setArchitecture(ARCH.X86)
+            ctx.convertRegisterToSymbolicVariable(ctx.registers.esi)
+            eax = ctx.convertRegisterToSymbolicVariable(ctx.registers.eax)
+            ebx = ctx.convertRegisterToSymbolicVariable(ctx.registers.ebx)
+            ctx.processing(Instruction(b"\x25\xff\xff\xff\x3f"))
+            ctx.processing(Instruction(b"\x81\xe3\xff\xff\xff\x3f"))
+            ctx.processing(Instruction(b"\x31\xD8"))
+            ctx.processing(Instruction(b"\x0F\x84\x55\x00\x00\x00"))
+
+            ctx.openSolverPersistentCache(path)
+            other = ctx.getModel(ctx.getFlippedPathConstraintsAst(0))
+            self.assertEqual(ctx.getSolverPersistentCacheStatistics()["hits"], 1)
+            self.assertEqual(other[eax.getId()].getValue(), model[0].getValue())
+            self.assertEqual(other[ebx.getId()].getValue(), model[1].getValue())
+        finally:
+            os.remove(path)
+            if os.path.exists(path + ".lock"):
+                os.remove(path + ".lock")
+
+    def test_solverPortfolio(self):
+        """Test the portfolio mode"""
+        self.ctx.setSolverCacheCapacity(0)
+        self.ctx.setSolverPortfolio([{"name": "default"}, {"name": "qfbv", "tactic": "qfbv"}, {"name": "seed", "seed": 42}])
+        self.assertEqual(len(self.ctx.getSolverPortfolio()), 3)
+
+        model = self.ctx.getModel(self.ctx.getFlippedPathConstraintsAst(0))
+        self.assertNotEqual(len(model), 0)
+        self.assertIn(self.ctx.getSolverPortfolioWinner(), ["default", "qfbv", "seed"])
+        self.assertEqual(sum(self.ctx.getSolverPortfolioWins()), 1)
+
+        self.ctx.setSolverPortfolio([])
+        self.assertEqual(len(self.ctx.getSolverPortfolioWins()), 0)
+
+    def hardQuery(self):
+        """Returns a factorization query z3 does not answer quickly"""
+        ast = self.ctx.getAstContext()
+        x = ast.variable(self.ctx.newSymbolicVariable(64))
+        y = ast.variable(self.ctx.newSymbolicVariable(64))
+        return ast.land([
+            x * y == ast.bv(12345678912345678911, 64),
+            x != ast.bv(1, 64),
+            y != ast.bv(1, 64),
+            x * x * x + y * y == ast.bv(987654321987, 64),
+        ])
+
+    def test_solverLimits(self):
+        """Test the limits and the status of the queries"""
+        model, status = self.ctx.getModel(self.ctx.getFlippedPathConstraintsAst(0), True)
+        self.assertNotEqual(len(model), 0)
+        self.assertEqual(status, SOLVER_STATE.SAT)
+
+        sat, status = self.ctx.isFlippedPathConstraintsSat(0, True)
+        self.assertTrue(sat)
+        self.assertEqual(status, SOLVER_STATE.SAT)
+
+        hard = self.hardQuery()
+        self.ctx.setSolverLimits(1)
+        self.assertEqual(self.ctx.getSolverLimits()["timeout"], 1)
+        model, status = self.ctx.getModel(hard, True)
+        self.assertEqual(len(model), 0)
+        self.assertEqual(status, SOLVER_STATE.TIMEOUT)
+
+        # A timeout is not cached as unsat
+        self.ctx.setSolverLimits(0)
+        sat, status = self.ctx.isSat(hard, True, 1)
+        self.assertFalse(sat)
+        self.assertEqual(status, SOLVER_STATE.TIMEOUT)
+        self.assertEqual(self.ctx.getSolverCacheStatistics()["unsatSupersetHits"], 0)
+
+    def test_interruptSolver(self):
+        """Test the interruption of a query from another thread"""
+        done = threading.Event()
+
+        def interrupt():
+            while not done.wait(0.05):
+                self.ctx.interruptSolver()
+
+        thread = threading.Thread(target=interrupt)
+        thread.start()
+        try:
+            model, status = self.ctx.getModel(self.hardQuery(), True)
+        finally:
+            done.set()
+            thread.join()
+
+        self.assertEqual(len(model), 0)
+        self.assertEqual(status, SOLVER_STATE.INTERRUPTED)
+
+    def test_solverRecording(self):
+        """Test the capture of the solver queries"""
+        fd, path = tempfile.mkstemp()
+        os.close(fd)
+
+        try:
+            self.ctx.startSolverRecording(path)
+            self.assertTrue(self.ctx.isSolverRecording())
+            self.ctx.getModel(self.ctx.getFlippedPathConstraintsAst(0))
+            self.ctx.stopSolverRecording()
+            self.assertFalse(self.ctx.isSolverRecording())
+
+            with open(path) as f:
+                capture = f.read()
+            self.assertIn("; @query 0 getModel", capture)
+            self.assertIn("; @status sat", capture)
+            self.assertIn("(check-sat)", capture)
+            self.assertTrue(capture.endswith("; @end\n"))
+
+            # A new recording continues the numbering and quotes the aliases which are not simple symbols
+            self.ctx.getSymbolicVariable(0).setAlias("my var")
+            self.ctx.startSolverRecording(path)
+            self.ctx.getModel(self.ctx.getFlippedPathConstraintsAst(0))
+            self.ctx.stopSolverRecording()
+
+            with open(path) as f:
+                capture = f.read()
+            self.assertIn("; @query 1 getModel", capture)
+            self.assertIn("(declare-fun |my var| ", capture)
+        finally:
+            os.remove(path)
+
+    def test_solverLocalSearch(self):
+        """Test the local search tried before the solver"""
+        astCtx = self.ctx.getAstContext()
+        self.ctx.enableMode(MODE.SOLVER_LOCAL_SEARCH, True)
+        self.ctx.setSolverLocalSearchBudget(100)
+        self.assertEqual(self.ctx.getSolverLocalSearchBudget(), 100)
+
+        crst = self.ctx.getFlippedPathConstraintsAst(0)
+        model = self.ctx.getModel(crst)
+        self.assertNotEqual(model[0].getValue() & 0x3fffffff, model[1].getValue() & 0x3fffffff)
+        self.assertEqual(self.ctx.getSolverLocalSearchStatistics()["solved"], 1)
+
+        # A failed search falls back to the solver
+        self.assertEqual(len(self.ctx.getModel(astCtx.land([crst, astCtx.lnot(crst)]))), 0)
+        stats = self.ctx.getSolverLocalSearchStatistics()
+        self.assertEqual(stats["queries"], 2)
+        self.assertEqual(stats["solved"], 1)
+
+    def test_solverIntervals(self):
+        """Test the decision of the linear comparisons without the solver"""
+        astCtx = self.ctx.getAstContext()
+        self.ctx.enableMode(MODE.SOLVER_INTERVALS, True)
+        x = astCtx.variable(self.ctx.getSymbolicVariableFromId(0))
+        y = astCtx.variable(self.ctx.getSymbolicVariableFromId(1))
+
+        crst = astCtx.land([
+            astCtx.bvugt(x, astCtx.bv(0x30, 32)),
+            astCtx.bvule(x, astCtx.bv(0x39, 32)),
+            astCtx.equal(astCtx.zx(32, y), astCtx.bvadd(astCtx.zx(32, x), astCtx.bv(1, 64))),
+        ])
+        model = self.ctx.getModel(crst)
+        self.assertTrue(0x30 < model[0].getValue() <= 0x39)
+        self.assertEqual(model[1].getValue(), model[0].getValue() + 1)
+
+        self.assertFalse(self.ctx.isSat(astCtx.land([astCtx.bvugt(x, astCtx.bv(10, 32)), astCtx.bvult(x, astCtx.bv(5, 32))])))
+
+        # Outside of the fragment, the query is sent to the solver
+        self.assertNotEqual(len(self.ctx.getModel(self.ctx.getFlippedPathConstraintsAst(0))), 0)
+
+        stats = self.ctx.getSolverIntervalStatistics()
+        self.assertEqual(stats["queries"], 3)
+        self.assertEqual(stats["sat"], 1)
+        self.assertEqual(stats["unsat"], 1)
+
+    def test_solverModelReuse(self):
+        """Test the concrete values and the recent models tried before the solver"""
+        self.ctx.enableMode(MODE.SOLVER_MODEL_REUSE, True)
+
+        # The concrete values satisfy the taken path
+        self.assertTrue(self.ctx.isSat(self.ctx.getPathConstraintsAst()))
+        self.assertEqual(self.ctx.getSolverModelPoolStatistics()["concreteHits"], 1)
+
+        # The model of the flip is found by the solver, then reused
+        crst = self.ctx.getFlippedPathConstraintsAst(0)
+        model = self.ctx.getModel(crst)
+        self.ctx.clearSolverCache()
+        other = self.ctx.getModel(crst)
+        self.assertEqual(model[0].getValue(), other[0].getValue())
+        self.assertEqual(model[1].getValue(), other[1].getValue())
+
+        stats = self.ctx.getSolverModelPoolStatistics()
+        self.assertEqual(stats["queries"], 3)
+        self.assertEqual(stats["poolHits"], 1)
+
+    def test_solverPreprocessing(self):
+        """Test the rewriting of the queries before the solver"""
+        astCtx = self.ctx.getAstContext()
+        self.ctx.enableMode(MODE.SOLVER_PREPROCESSING, True)
+        x = astCtx.variable(self.ctx.getSymbolicVariableFromId(0))
+        y = astCtx.variable(self.ctx.getSymbolicVariableFromId(1))
+
+        # x is substituted, the duplicate and the weaker bound are removed
+        check = astCtx.bvugt(astCtx.bvadd(x, y), astCtx.bv(0x100, 32))
+        crst = astCtx.land([
+            astCtx.equal(x, astCtx.bv(0x41, 32)),
+            check,
+            check,
+            astCtx.bvult(y, astCtx.bv(0x1000, 32)),
+            astCtx.bvult(y, astCtx.bv(0x2000, 32)),
+        ])
+        model = self.ctx.getModel(crst)
+        self.assertEqual(model[0].getValue(), 0x41)
+        self.assertTrue(0x100 - 0x41 < model[1].getValue() < 0x1000)
+
+        # Answered without the solver
+        self.assertFalse(self.ctx.isSat(astCtx.land([astCtx.equal(x, astCtx.bv(1, 32)), astCtx.equal(x, astCtx.bv(2, 32))])))
+        model = self.ctx.getModel(astCtx.land([astCtx.bvuge(y, astCtx.bv(7, 32)), astCtx.bvule(y, astCtx.bv(7, 32))]))
+        self.assertEqual(model[1].getValue(), 7)
+
+        stats = self.ctx.getSolverPreprocessingStatistics()
+        self.assertEqual(stats["queries"], 3)
+        self.assertEqual(stats["duplicates"], 1)
+        self.assertEqual(stats["substitutions"], 2)
+        self.assertEqual(stats["implied"], 1)
+        self.assertEqual(stats["answered"], 2)
+
+    def test_optimisticSolving(self):
+        """Test the optimistic fallbacks of an unsat branch flip"""
+        ctx = TritonContext()
+        ctx.setArchitecture(ARCH.X86)
+
+        trace = [
+            b"\x83\xfb\x00",                  # cmp ebx, 0
+            b"\x0f\x85\x10\x00\x00\x00",      # jne 0x10
+            b"\x39\xd8",                      # cmp eax, ebx
+            b"\x0f\x87\x10\x00\x00\x00",      # ja 0x10
+            b"\x83\xf8\x00",                  # cmp eax, 0
+            b"\x0f\x85\x10\x00\x00\x00",      # jne 0x10
+        ]
+
+        ctx.convertRegisterToSymbolicVariable(ctx.registers.eax)
+        ctx.convertRegisterToSymbolicVariable(ctx.registers.ebx)
+
+        for opcodes in trace:
+            ctx.processing(Instruction(opcodes))
+        self.assertEqual(len(ctx.getPathConstraints()), 3)
+
+        # eax != 0 contradicts eax <= ebx == 0
+        model, status, optimistic = ctx.getFlippedPathConstraintsModel(2, True, True)
+        self.assertEqual(len(model), 0)
+        self.assertEqual(status, SOLVER_STATE.UNSAT)
+        self.assertFalse(optimistic)
+
+        # The dependent prefix keeps eax <= ebx and drops ebx == 0
+        ctx.setSolverOptimisticStrategy(OPTIMISTIC.DEPENDENT)
+        self.assertEqual(ctx.getSolverOptimisticStrategy(), OPTIMISTIC.DEPENDENT)
+        model, status, optimistic = ctx.getFlippedPathConstraintsModel(2, True, True)
+        self.assertEqual(status, SOLVER_STATE.SAT)
+        self.assertTrue(optimistic)
+        self.assertNotEqual(model[0].getValue(), 0)
+        self.assertLessEqual(model[0].getValue(), model[1].getValue())
+
+        ctx.setSolverOptimisticStrategy(OPTIMISTIC.LAST)
+        model, optimistic = ctx.getFlippedPathConstraintsModel(2, False, True)
+        self.assertTrue(optimistic)
+        self.assertNotEqual(model[0].getValue(), 0)
+
+        # A model of the whole query is complete
+        model, optimistic = ctx.getFlippedPathConstraintsModel(0, False, True)
+        self.assertNotEqual(len(model), 0)
+        self.assertFalse(optimistic)
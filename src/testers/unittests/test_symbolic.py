@@ -90,6 +90,38 @@ class TestSymbolic(unittest.TestCase):
             self.Triton.assignSymbolicExpressionToRegister(expr1, self.Triton.registers.rax)
 
 
+    def test_memory_budget(self):
+        """Check that the memory budget concretizes the least recently used expressions."""
+        self.assertEqual(self.Triton.getMemoryBudget(), 0)
+        self.Triton.convertRegisterToSymbolicVariable(self.Triton.registers.rax)
+        self.Triton.convertRegisterToSymbolicVariable(self.Triton.registers.rbx)
+
+        # cmp rax, 5 ; jz +0
+        for opcode in [b"\x48\x83\xf8\x05", b"\x74\x00"]:
+            self.Triton.processing(Instruction(opcode))
+
+        self.Triton.setMemoryBudget(1)
+        self.Triton.enforceMemoryBudget()
+        self.assertEqual(self.Triton.getMemoryBudget(), 1)
+
+        stats = self.Triton.getEvictionStatistics()
+        self.assertEqual(stats["passes"], 1)
+        self.assertGreater(stats["evictedRegisters"], 0)
+        self.assertGreater(stats["releasedExpressions"], 0)
+
+        # The path constraint keeps its flag symbolic
+        regs = self.Triton.getSymbolicRegisters()
+        self.assertIn(self.Triton.registers.zf.getId(), regs)
+        self.assertNotIn(self.Triton.registers.rip.getId(), regs)
+
+        # The unread symbolic input is kept
+        self.assertIn(self.Triton.registers.rbx.getId(), regs)
+
+        # The budget cannot be met, no pass runs until the usage changes
+        self.Triton.enforceMemoryBudget()
+        self.assertEqual(self.Triton.getEvictionStatistics()["passes"], 1)
+
+
 class TestSymbolicBuilding(unittest.TestCase):
 
     """Testing symbolic building."""
@@ -84,3 +84,19 @@ class TestSymbolicExpression(unittest.TestCase):
         self.expr1.setComment("test")
         self.assertEqual(self.expr1.getComment(), "test")
 
+
+    def test_getSymbolicExpressionsAtAddress(self):
+        """Test getSymbolicExpressionsAtAddress"""
+        for inst in [self.inst1, self.inst2]:
+            ids = [e.getId() for e in self.ctx.getSymbolicExpressionsAtAddress(inst.getAddress())]
+            self.assertEqual(ids, [e.getId() for e in inst.getSymbolicExpressions()])
+        self.assertEqual(len(self.ctx.getSymbolicExpressionsAtAddress(0xdead)), 0)
+
+    def test_getSymbolicExpressionsOfKind(self):
+        """Test getSymbolicExpressionsOfKind"""
+        mem = self.ctx.getSymbolicExpressionsOfKind(SYMBOLIC.MEMORY_EXPRESSION)
+        self.assertIn(self.expr2.getId(), [e.getId() for e in mem])
+        for e in mem:
+            self.assertTrue(e.isMemory())
+        for e in self.ctx.getSymbolicExpressionsOfKind(SYMBOLIC.REGISTER_EXPRESSION):
+            self.assertTrue(e.isRegister())
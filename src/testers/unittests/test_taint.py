@@ -85,6 +85,63 @@ class TestTaint(unittest.TestCase):
         self.assertFalse(Triton.isRegisterTainted(Triton.registers.eax))
         self.assertFalse(Triton.isRegisterTainted(Triton.registers.ax))
 
+    def test_taint_sub_register(self):
+        """Check the byte-precise taint of the registers."""
+        Triton = TritonContext()
+        Triton.setArchitecture(ARCH.X86_64)
+
+        Triton.taintRegister(Triton.registers.al)
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.al))
+        self.assertFalse(Triton.isRegisterTainted(Triton.registers.ah))
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.ax))
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.rax))
+
+        # mov bl, al
+        Triton.processing(Instruction(b"\x88\xc3"))
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.bl))
+        self.assertFalse(Triton.isRegisterTainted(Triton.registers.bh))
+
+        # mov bh, al
+        Triton.processing(Instruction(b"\x88\xc7"))
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.bh))
+
+        # mov bl, 1
+        Triton.processing(Instruction(b"\xb3\x01"))
+        self.assertFalse(Triton.isRegisterTainted(Triton.registers.bl))
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.bh))
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.rbx))
+
+        # mov dx, 1 keeps the upper bytes of rdx
+        Triton.taintRegister(Triton.registers.rdx)
+        Triton.processing(Instruction(b"\x66\xba\x01\x00"))
+        self.assertFalse(Triton.isRegisterTainted(Triton.registers.dx))
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.edx))
+
+        # mov ecx, 1 zeroes the upper bytes of rcx
+        Triton.taintRegister(Triton.registers.rcx)
+        Triton.processing(Instruction(b"\xb9\x01\x00\x00\x00"))
+        self.assertFalse(Triton.isRegisterTainted(Triton.registers.rcx))
+
+        # add cl, al taints cl only
+        Triton.processing(Instruction(b"\x00\xc1"))
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.cl))
+        self.assertFalse(Triton.isRegisterTainted(Triton.registers.ch))
+
+        Triton.untaintRegister(Triton.registers.al)
+        self.assertFalse(Triton.isRegisterTainted(Triton.registers.rax))
+
+        # The labels are byte-precise too
+        Triton.enableMode(MODE.TAINT_LABELS, True)
+        Triton.taintRegisterWithLabel(Triton.registers.al, 1)
+        Triton.taintRegisterWithLabel(Triton.registers.ah, 2)
+        self.assertEqual(Triton.getRegisterTaintLabels(Triton.registers.al), [1])
+        self.assertEqual(Triton.getRegisterTaintLabels(Triton.registers.ah), [2])
+        self.assertEqual(Triton.getRegisterTaintLabels(Triton.registers.rax), [1, 2])
+
+        # mov bh, ah
+        Triton.processing(Instruction(b"\x88\xe7"))
+        self.assertEqual(Triton.getRegisterTaintLabels(Triton.registers.bh), [2])
+
     def test_taint_assignement_memory_immediate(self):
         """Check tainting assignment memory <- immediate."""
         Triton = TritonContext()
@@ -429,6 +486,99 @@ class TestTaint(unittest.TestCase):
         self.assertTrue(0x4003 in m)
         self.assertFalse(0x5000 in m)
 
+    def test_taint_memory_across_pages(self):
+        """Taint and untaint accesses which cross pages"""
+        Triton = TritonContext()
+        Triton.setArchitecture(ARCH.X86_64)
+
+        Triton.taintMemory(MemoryAccess(0x1ffc, 8))
+        self.assertTrue(Triton.isMemoryTainted(MemoryAccess(0x1ff8, 8)))
+        self.assertTrue(Triton.isMemoryTainted(0x2003))
+        self.assertFalse(Triton.isMemoryTainted(0x2004))
+        self.assertEqual(len(Triton.getTaintedMemory()), 8)
+
+        Triton.taintMemory(MemoryAccess(0xfffffffffffffffc, 4))
+        self.assertTrue(Triton.isMemoryTainted(0xffffffffffffffff))
+
+        Triton.untaintMemory(MemoryAccess(0x1ffe, 4))
+        self.assertTrue(Triton.isMemoryTainted(0x1ffd))
+        self.assertFalse(Triton.isMemoryTainted(MemoryAccess(0x1ffe, 4)))
+        self.assertTrue(Triton.isMemoryTainted(0x2002))
+        self.assertEqual(len(Triton.getTaintedMemory()), 8)
+
+    def test_taint_memory_range(self):
+        """Taint and untaint ranges of memory"""
+        Triton = TritonContext()
+        Triton.setArchitecture(ARCH.X86_64)
+
+        self.assertEqual(Triton.getTaintedMemoryRanges(), [])
+        self.assertTrue(Triton.taintMemoryRange(0x10000, 0x100000))
+        self.assertTrue(Triton.isMemoryRangeTainted(0x0, 0x10001))
+        self.assertFalse(Triton.isMemoryRangeTainted(0x0, 0x10000))
+        self.assertTrue(Triton.isMemoryTainted(MemoryAccess(0x10fffc, 4)))
+        self.assertFalse(Triton.isMemoryTainted(0x110000))
+
+        self.assertFalse(Triton.untaintMemoryRange(0x20000, 0x1000))
+        self.assertFalse(Triton.isMemoryRangeTainted(0x20000, 0x1000))
+        Triton.taintMemory(0x200000)
+        self.assertEqual(Triton.getTaintedMemoryRanges(), [(0x10000, 0x10000), (0x21000, 0xef000), (0x200000, 1)])
+
+        self.assertFalse(Triton.untaintMemoryRange(0, 0xffffffffffffffff))
+        self.assertEqual(Triton.getTaintedMemoryRanges(), [])
+        self.assertEqual(len(Triton.getTaintedMemory()), 0)
+
+    def test_taint_labels(self):
+        """Check the propagation of the taint labels"""
+        ctx = TritonContext()
+        ctx.setArchitecture(ARCH.X86_64)
+        ctx.enableMode(MODE.TAINT_LABELS, True)
+        ctx.setConcreteRegisterValue(ctx.registers.rdi, 0x1000)
+
+        # The labels are the offsets of the input bytes
+        for i in range(16):
+            ctx.taintMemoryWithLabel(0x1000 + i, i)
+        self.assertEqual(ctx.getMemoryTaintLabels(0x1003), [3])
+        self.assertEqual(ctx.getMemoryTaintLabels(MemoryAccess(0x1000, 4)), [0, 1, 2, 3])
+
+        inst = Instruction(b"\x8b\x07") # mov eax, dword ptr [rdi]
+        ctx.processing(inst)
+        self.assertEqual(ctx.getRegisterTaintLabels(ctx.registers.rax), [0, 1, 2, 3])
+
+        inst = Instruction(b"\x0f\xb7\x5f\x08") # movzx ebx, word ptr [rdi + 8]
+        ctx.processing(inst)
+        self.assertEqual(ctx.getRegisterTaintLabels(ctx.registers.rbx), [8, 9])
+
+        inst = Instruction(b"\x48\x01\xd8") # add rax, rbx
+        ctx.processing(inst)
+        self.assertEqual(ctx.getRegisterTaintLabels(ctx.registers.rax), [0, 1, 2, 3, 8, 9])
+
+        inst = Instruction(b"\x48\x89\x47\x20") # mov qword ptr [rdi + 0x20], rax
+        ctx.processing(inst)
+        self.assertEqual(ctx.getMemoryTaintLabels(0x1020), [0, 1, 2, 3, 8, 9])
+        self.assertEqual(ctx.getMemoryTaintLabels(0x1027), [0, 1, 2, 3, 8, 9])
+
+        # An untainted source clears the labels
+        inst = Instruction(b"\xb8\x00\x00\x00\x00") # mov eax, 0
+        ctx.processing(inst)
+        self.assertFalse(ctx.isRegisterTainted(ctx.registers.rax))
+        self.assertEqual(ctx.getRegisterTaintLabels(ctx.registers.rax), [])
+
+        ctx.untaintMemory(MemoryAccess(0x1020, 8))
+        self.assertEqual(ctx.getMemoryTaintLabels(0x1020), [])
+
+        # Without the mode, the labels are not propagated and the assigned destinations lose theirs
+        ctx.enableMode(MODE.TAINT_LABELS, False)
+        inst = Instruction(b"\x48\x8b\x1f") # mov rbx, qword ptr [rdi]
+        ctx.processing(inst)
+        self.assertTrue(ctx.isRegisterTainted(ctx.registers.rbx))
+        self.assertEqual(ctx.getRegisterTaintLabels(ctx.registers.rbx), [])
+
+        inst = Instruction(b"\x48\x89\x1f") # mov qword ptr [rdi], rbx
+        ctx.processing(inst)
+        self.assertTrue(ctx.isMemoryTainted(0x1000))
+        self.assertEqual(ctx.getMemoryTaintLabels(MemoryAccess(0x1000, 8)), [])
+        self.assertEqual(ctx.getMemoryTaintLabels(0x1008), [8])
+
     def test_taint_set_register(self):
         """Set taint register"""
         Triton = TritonContext()
@@ -0,0 +1,222 @@
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+/*
+** Replays a capture of solver queries (see TritonContext::startSolverRecording)
+** against one or several z3 configurations and reports latency distributions.
+**
+** Usage: triton-solver-bench [-t timeout_ms] [-r repeat] <capture> [name[:tactic[:seed]] ...]
+**
+** Output:
+**
+**  configuration       queries     sat   unsat unknown  errors      min      p50      p90      p99      max     mean    total
+**  recorded                 42      30      12       0       0    0.112    0.840    3.221   12.004   12.004    1.402   58.898
+**  default                  42      30      12       0       0    0.098    0.771    2.987   11.480   11.480    1.301   54.642
+**
+** Times are in milliseconds. An error is an answer which contradicts the recorded sat/unsat answer.
+*/
+
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <z3++.h>
+
+#include <triton/solverConfiguration.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverRecorder.hpp>
+#include <triton/z3Solver.hpp>
+
+using namespace triton;
+using namespace triton::engines::solver;
+
+
+struct result {
+  std::string         name;
+  usize               sat;
+  usize               unsat;
+  usize               unknown;
+  usize               errors;
+  std::vector<double> times;
+
+  result(const std::string& name) : name(name), sat(0), unsat(0), unknown(0), errors(0) {}
+};
+
+
+static void usage(const char* program) {
+  std::cerr << "Usage: " << program << " [-t timeout_ms] [-r repeat] <capture> [name[:tactic[:seed]] ...]" << std::endl;
+  std::exit(1);
+}
+
+
+static SolverConfiguration parseConfiguration(const std::string& desc) {
+  SolverConfiguration config;
+  size_t first  = desc.find(':');
+  size_t second = (first == std::string::npos) ? std::string::npos : desc.find(':', first + 1);
+
+  config.name = desc.substr(0, first);
+  if (first != std::string::npos)
+    config.tactic = desc.substr(first + 1, second == std::string::npos ? std::string::npos : second - first - 1);
+  if (second != std::string::npos)
+    config.seed = static_cast<uint32>(std::strtoul(desc.substr(second + 1).c_str(), nullptr, 0));
+
+  /* "default" is the configuration used by the Z3Solver interface */
+  if (config.tactic == "default")
+    config.tactic.clear();
+
+  return config;
+}
+
+
+static status_e replay(const SolverRecord& record, const SolverConfiguration& config, const SolverLimits& limits, double& time) {
+  z3::context ctx;
+  z3::solver solver = config.tactic.empty() ? z3::solver(ctx) : z3::tactic(ctx, config.tactic.c_str()).mk_solver();
+
+  Z3Solver::setLimits(solver, limits);
+  if (config.seed) {
+    z3::params p(ctx);
+    p.set("random_seed", config.seed);
+    solver.set(p);
+  }
+
+  solver.from_string(record.smt.c_str());
+
+  auto start = std::chrono::steady_clock::now();
+  z3::check_result res = solver.check();
+  time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+  return Z3Solver::getStatus(solver, res);
+}
+
+
+static void account(result& res, status_e status, status_e expected, double time) {
+  switch (status) {
+    case SAT:   res.sat++;     break;
+    case UNSAT: res.unsat++;   break;
+    default:    res.unknown++; break;
+  }
+
+  if ((status == SAT && expected == UNSAT) || (status == UNSAT && expected == SAT))
+    res.errors++;
+
+  res.times.push_back(time);
+}
+
+
+static double percentile(const std::vector<double>& sorted, double p) {
+  if (sorted.empty())
+    return 0;
+  size_t index = static_cast<size_t>(p * (sorted.size() - 1) + 0.5);
+  return sorted[index];
+}
+
+
+static void report(const result& res) {
+  std::vector<double> sorted = res.times;
+  double total = 0;
+
+  std::sort(sorted.begin(), sorted.end());
+  for (double t : sorted)
+    total += t;
+
+  std::cout << std::left  << std::setw(20) << res.name << std::right
+            << std::setw(8) << sorted.size()
+            << std::setw(8) << res.sat
+            << std::setw(8) << res.unsat
+            << std::setw(8) << res.unknown
+            << std::setw(8) << res.errors
+            << std::fixed << std::setprecision(3)
+            << std::setw(9) << (sorted.empty() ? 0 : sorted.front())
+            << std::setw(9) << percentile(sorted, 0.50)
+            << std::setw(9) << percentile(sorted, 0.90)
+            << std::setw(9) << percentile(sorted, 0.99)
+            << std::setw(9) << (sorted.empty() ? 0 : sorted.back())
+            << std::setw(9) << (sorted.empty() ? 0 : total / sorted.size())
+            << std::setw(9) << total
+            << std::endl;
+}
+
+
+int main(int ac, const char *av[]) {
+  std::vector<SolverConfiguration> configs;
+  std::vector<SolverRecord> records;
+  std::string capture;
+  uint32 timeout = 0;
+  uint32 repeat  = 1;
+
+  for (int i = 1; i < ac; i++) {
+    std::string arg = av[i];
+    if (arg == "-t" && i + 1 < ac)
+      timeout = static_cast<uint32>(std::strtoul(av[++i], nullptr, 0));
+    else if (arg == "-r" && i + 1 < ac)
+      repeat = static_cast<uint32>(std::strtoul(av[++i], nullptr, 0));
+    else if (arg.size() && arg[0] == '-')
+      usage(av[0]);
+    else if (capture.empty())
+      capture = arg;
+    else
+      configs.push_back(parseConfiguration(arg));
+  }
+
+  if (capture.empty() || repeat == 0)
+    usage(av[0]);
+
+  if (configs.empty())
+    configs.push_back(parseConfiguration("default"));
+
+  try {
+    records = SolverRecorder::load(capture);
+  }
+  catch (const std::exception& e) {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+
+  std::cout << std::left  << std::setw(20) << "configuration" << std::right
+            << std::setw(8) << "queries"
+            << std::setw(8) << "sat"
+            << std::setw(8) << "unsat"
+            << std::setw(8) << "unknown"
+            << std::setw(8) << "errors"
+            << std::setw(9) << "min"
+            << std::setw(9) << "p50"
+            << std::setw(9) << "p90"
+            << std::setw(9) << "p99"
+            << std::setw(9) << "max"
+            << std::setw(9) << "mean"
+            << std::setw(9) << "total"
+            << std::endl;
+
+  /* The answers and times observed when the capture has been recorded */
+  result recorded("recorded");
+  for (const auto& record : records)
+    account(recorded, record.status, record.status, record.time / 1000.0);
+  report(recorded);
+
+  for (const auto& config : configs) {
+    result res(config.name);
+    for (const auto& record : records) {
+      for (uint32 i = 0; i < repeat; i++) {
+        double time = 0;
+        status_e status = UNKNOWN;
+        try {
+          status = replay(record, config, SolverLimits(timeout), time);
+        }
+        catch (const z3::exception& e) {
+          std::cerr << "query " << record.id << ": " << e.msg() << std::endl;
+        }
+        account(res, status, record.status, time);
+      }
+    }
+    report(res);
+  }
+
+  return 0;
+}